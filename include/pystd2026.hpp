@@ -49,6 +49,9 @@ template<class T> constexpr remove_reference_t<T> &&move(T &&t) noexcept {
     return static_cast<typename remove_reference<T>::type &&>(t);
 }
 
+// Only for use in unevaluated contexts like decltype.
+template<class T> T &&declval() noexcept;
+
 template<class T> struct remove_cv {
     typedef T type;
 };
@@ -128,6 +131,7 @@ template<class T> constexpr bool is_floating_point_v = is_floating_point<T>::val
 template<class T> struct is_integral_base : ::pystd2026::false_type {};
 template<> struct is_integral_base<bool> : ::pystd2026::true_type {};
 template<> struct is_integral_base<char> : ::pystd2026::true_type {};
+template<> struct is_integral_base<signed char> : ::pystd2026::true_type {};
 template<> struct is_integral_base<short> : ::pystd2026::true_type {};
 template<> struct is_integral_base<int> : ::pystd2026::true_type {};
 template<> struct is_integral_base<long> : ::pystd2026::true_type {};
@@ -153,6 +157,15 @@ template<typename T> struct is_unsigned : is_unsigned_base<remove_cv_t<remove_re
 
 template<class T> constexpr bool is_unsigned_v = is_unsigned<T>::value;
 
+template<class T> constexpr bool is_trivially_copyable_v = __is_trivially_copyable(T);
+
+template<typename T> struct is_pointer_base : ::pystd2026::false_type {};
+template<typename T> struct is_pointer_base<T *> : ::pystd2026::true_type {};
+
+template<typename T> struct is_pointer : is_pointer_base<remove_cv_t<T>> {};
+
+template<class T> constexpr bool is_pointer_v = is_pointer<T>::value;
+
 template<typename T>
 constexpr T &&forward(typename ::pystd2026::remove_reference<T>::type &t) noexcept {
     return static_cast<T &&>(t);
@@ -335,7 +348,7 @@ public:
     Expected(Expected<V, E> &&o) noexcept : state{o.state} {
         if(o.has_value()) {
             new(content) V(::pystd2026::move(o.value()));
-        } else {
+        } else if(o.has_error()) {
             new(content) E(::pystd2026::move(o.error()));
         }
     }
@@ -352,7 +365,7 @@ public:
         if(this != &o) {
             destroy();
             if(o.has_value()) {
-                new(content) V(::pystd2026::move(*reinterpret_cast<V *>(content)));
+                new(content) V(::pystd2026::move(*reinterpret_cast<V *>(o.content)));
                 state = UnionState::Value;
             } else if(o.has_error()) {
                 new(content) E(::pystd2026::move(*reinterpret_cast<E *>(o.content)));
@@ -365,12 +378,19 @@ public:
     }
 
     V &value() {
-        if(*this) {
+        if(!has_value()) {
             abort();
         }
         return *reinterpret_cast<V *>(content);
     }
 
+    const V &value() const {
+        if(!has_value()) {
+            abort();
+        }
+        return *reinterpret_cast<const V *>(content);
+    }
+
     E &error() {
         if(!has_error()) {
             abort();
@@ -378,6 +398,13 @@ public:
         return *reinterpret_cast<E *>(content);
     }
 
+    const E &error() const {
+        if(!has_error()) {
+            abort();
+        }
+        return *reinterpret_cast<const E *>(content);
+    }
+
 private:
     void destroy() {
         if(state == UnionState::Value) {
@@ -1241,7 +1268,7 @@ public:
         reserve(size() + num_copies);
         T *obj = objptr(size());
         for(size_t i = 0; i < num_copies; ++i) {
-            new(obj) T{};
+            new(obj + i) T{};
         }
         num_entries += num_copies;
     }
@@ -1529,6 +1556,7 @@ public:
     friend class U8String;
     friend class U8Match;
     friend class U8StringView;
+    friend class WhitespaceTokenizer;
 
     ValidU8Iterator() noexcept = default;
 
@@ -1602,6 +1630,12 @@ class CStringView;
 typedef bool (*CStringViewCallback)(const CStringView &piece, void *ctx);
 
 class CString;
+
+struct CharSeparator;
+struct SubstringSeparator;
+template<typename View, typename Separator> class SeparatorSplitRange;
+template<typename View, typename Predicate> class PredicateSplitRange;
+
 // No embedded null chars
 // NOT guaranteed to be null terminated.
 class CStringView {
@@ -1635,6 +1669,9 @@ public:
 
     size_t find(CStringView substr) const;
 
+    size_t rfind(char c) const;
+    size_t rfind(CStringView substr) const;
+
     char at(size_t index) const { return (*this)[index]; }
 
     char unsafe_at(size_t index) const { return buf[index]; }
@@ -1654,6 +1691,15 @@ public:
 
     void split(CStringViewCallback cb, void *ctx) const;
 
+    // Lazy splitting that yields views into this string and does not
+    // allocate. Splitting at a separator keeps empty pieces like
+    // Python's str.split(sep). Splitting with a predicate skips them
+    // like str.split() does.
+    SeparatorSplitRange<CStringView, CharSeparator> split_view(char separator) const;
+    SeparatorSplitRange<CStringView, SubstringSeparator> split_view(CStringView separator) const;
+    template<typename Predicate>
+    PredicateSplitRange<CStringView, Predicate> split_view_if(const Predicate &is_split_char) const;
+
     template<typename Hasher> void feed_hash(Hasher &h) const { h.feed_bytes(buf, bufsize); }
 
 private:
@@ -1761,6 +1807,11 @@ public:
 
     void split_by(char c, CStringViewCallback cb, void *ctx) const;
 
+    SeparatorSplitRange<CStringView, CharSeparator> split_view(char separator) const;
+    SeparatorSplitRange<CStringView, SubstringSeparator> split_view(CStringView separator) const;
+    template<typename Predicate>
+    PredicateSplitRange<CStringView, Predicate> split_view_if(const Predicate &is_split_char) const;
+
     bool is_empty() const {
         // The buffer always has a null terminator.
         return bytes.size() == 1;
@@ -1937,13 +1988,94 @@ private:
     uint32_t strsize; // This could even be a uint16_t to save space.
 };
 
+// General categories, in the order of the Unicode standard.
+enum class UnicodeCategory : uint8_t {
+    Lu,
+    Ll,
+    Lt,
+    Lm,
+    Lo,
+    Mn,
+    Mc,
+    Me,
+    Nd,
+    Nl,
+    No,
+    Pc,
+    Pd,
+    Ps,
+    Pe,
+    Pi,
+    Pf,
+    Po,
+    Sm,
+    Sc,
+    Sk,
+    So,
+    Zs,
+    Zl,
+    Zp,
+    Cc,
+    Cf,
+    Cs,
+    Co,
+    Cn,
+};
+
+UnicodeCategory unicode_category(uint32_t codepoint) noexcept;
+// The White_Space property.
+bool is_unicode_whitespace(uint32_t codepoint) noexcept;
+// Same as Python's str.isalpha().
+bool is_unicode_alpha(uint32_t codepoint) noexcept;
+// Same as Python's str.isnumeric().
+bool is_unicode_numeric(uint32_t codepoint) noexcept;
+
+// A set of ASCII characters.
+class AsciiBitmap {
+public:
+    constexpr explicit AsciiBitmap(const char *chars) noexcept : bits{0, 0} {
+        for(; *chars; ++chars) {
+            const auto c = (unsigned char)*chars;
+            if(c < 128) {
+                bits[c >> 6] |= uint64_t(1) << (c & 63);
+            }
+        }
+    }
+
+    constexpr bool contains(uint32_t c) const noexcept {
+        return c < 128 && (bits[c >> 6] >> (c & 63)) & 1;
+    }
+
+private:
+    uint64_t bits[2];
+};
+
+// Splitting predicates that have a static ascii_bitmap member
+// classify ASCII characters with it without decoding them.
+struct IsAsciiWhitespace {
+    // Also what split_ascii and WhitespaceTokenizer split on.
+    static constexpr AsciiBitmap ascii_bitmap{" \t\n\r"};
+    bool operator()(uint32_t codepoint) const noexcept { return ascii_bitmap.contains(codepoint); }
+};
+
+struct IsUnicodeWhitespace {
+    static constexpr AsciiBitmap ascii_bitmap{" \t\n\v\f\r"};
+    bool operator()(uint32_t codepoint) const noexcept {
+        return codepoint < 128 ? ascii_bitmap.contains(codepoint)
+                               : is_unicode_whitespace(codepoint);
+    }
+};
+
 class U8String;
 
 class U8StringSplitClosure_temp;
 
+template<typename View> struct SplitTraits;
+
 class U8StringView {
 public:
     friend class U8StringSplitClosure_temp;
+    friend struct SplitTraits<U8StringView>;
 
     U8StringView() noexcept {}
 
@@ -1981,7 +2113,14 @@ public:
     U8String upper() const;
     U8String lower() const;
 
+    // These return byte offsets, not codepoint indexes.
+    // A match of valid UTF-8 within valid UTF-8 always
+    // starts and ends at codepoint boundaries.
+    size_t find(const U8StringView &substr) const;
+    size_t rfind(const U8StringView &substr) const;
+
     size_t size_bytes() const noexcept { return stop.buf - start.buf; }
+    size_t size_codepoints() const noexcept;
 
     const char *data() const noexcept { return (const char *)start.buf; }
 
@@ -1993,18 +2132,322 @@ public:
 
     U8StringSplitClosure_temp split_ascii();
 
+    // Same semantics as the CStringView versions. The predicate gets
+    // codepoints. Separator characters must be ASCII so that pieces
+    // always end at codepoint boundaries.
+    SeparatorSplitRange<U8StringView, CharSeparator> split_view(char separator) const;
+    SeparatorSplitRange<U8StringView, SubstringSeparator>
+    split_view(const U8StringView &separator) const;
+    SeparatorSplitRange<U8StringView, SubstringSeparator> split_view(const char *separator) const;
+    template<typename Predicate>
+    PredicateSplitRange<U8StringView, Predicate> split_view_if(const Predicate &is_split_char) const;
+
+    // Calls cb with every non-empty piece between codepoints for which
+    // is_split_char returns true, until cb returns false. Both are
+    // template arguments so that they can be inlined.
+    template<typename Callback, typename Predicate>
+    void split(const Callback &cb, const Predicate &is_split_char) const {
+        const unsigned char *i = start.buf;
+        const unsigned char *const end = stop.buf;
+        uint32_t char_size;
+        while(i != end) {
+            while(i != end && is_split_at(i, char_size, is_split_char)) {
+                i += char_size;
+            }
+            if(i == end) {
+                break;
+            }
+            const unsigned char *piece_start = i;
+            while(i != end && !is_split_at(i, char_size, is_split_char)) {
+                i += char_size;
+            }
+            if(!cb(U8StringView(ValidU8Iterator(piece_start), ValidU8Iterator(i)))) {
+                break;
+            }
+        }
+    }
+
 private:
+    template<typename Predicate>
+    static bool
+    is_split_at(const unsigned char *loc, uint32_t &char_size, const Predicate &is_split_char) {
+        if(*loc < 0x80) {
+            char_size = 1;
+            if constexpr(requires { Predicate::ascii_bitmap; }) {
+                return Predicate::ascii_bitmap.contains(*loc);
+            } else {
+                return is_split_char(*loc);
+            }
+        }
+        ValidU8Iterator it(loc);
+        const auto codepoint = *it;
+        ++it;
+        char_size = it.buf - loc;
+        return is_split_char(codepoint);
+    }
+
+    static U8StringView from_valid_range(const char *start, const char *stop) {
+        return U8StringView(ValidU8Iterator((const unsigned char *)start),
+                            ValidU8Iterator((const unsigned char *)stop));
+    }
+
     ValidU8Iterator start;
     ValidU8Iterator stop;
 };
 
+// Creates pieces of the right type for the lazy splitters.
+template<> struct SplitTraits<CStringView> {
+    static CStringView piece(const char *start, const char *stop) {
+        return CStringView(start, size_t(stop - start));
+    }
+
+    template<typename Predicate>
+    static bool is_split_at(const char *loc, size_t &char_size, const Predicate &is_split_char) {
+        char_size = 1;
+        return is_split_char(*loc);
+    }
+};
+
+template<> struct SplitTraits<U8StringView> {
+    static U8StringView piece(const char *start, const char *stop) {
+        return U8StringView::from_valid_range(start, stop);
+    }
+
+    template<typename Predicate>
+    static bool is_split_at(const char *loc, size_t &char_size, const Predicate &is_split_char) {
+        uint32_t codepoint_size;
+        const bool result =
+            U8StringView::is_split_at((const unsigned char *)loc, codepoint_size, is_split_char);
+        char_size = codepoint_size;
+        return result;
+    }
+};
+
+struct CharSeparator {
+    char c;
+
+    size_t size() const { return 1; }
+
+    const char *find(const char *start, const char *stop) const {
+        if(start == stop) {
+            return stop;
+        }
+        auto *loc = (const char *)memchr(start, c, stop - start);
+        return loc ? loc : stop;
+    }
+};
+
+struct SubstringSeparator {
+    CStringView separator;
+
+    size_t size() const { return separator.size(); }
+
+    const char *find(const char *start, const char *stop) const {
+        const size_t offset = CStringView(start, size_t(stop - start)).find(separator);
+        return offset == (size_t)-1 ? stop : start + offset;
+    }
+};
+
+struct SplitSentinel {};
+
+template<typename View, typename Separator> class SeparatorSplitRange {
+public:
+    class Iterator {
+    public:
+        Iterator(const char *start, const char *stop, const Separator &separator)
+            : piece_start{start}, text_end{stop}, separator{separator} {
+            piece_end = separator.find(piece_start, text_end);
+        }
+
+        View operator*() const { return SplitTraits<View>::piece(piece_start, piece_end); }
+
+        Iterator &operator++() {
+            if(piece_end == text_end) {
+                finished = true;
+            } else {
+                piece_start = piece_end + separator.size();
+                piece_end = separator.find(piece_start, text_end);
+            }
+            return *this;
+        }
+
+        bool operator==(SplitSentinel) const { return finished; }
+
+    private:
+        const char *piece_start;
+        const char *piece_end;
+        const char *text_end;
+        Separator separator;
+        bool finished = false;
+    };
+
+    SeparatorSplitRange(const char *start, const char *stop, const Separator &separator)
+        : text_start{start}, text_end{stop}, separator{separator} {
+        if(separator.size() == 0) {
+            bootstrap_throw("Empty separator in split.");
+        }
+    }
+
+    Iterator begin() const { return Iterator(text_start, text_end, separator); }
+    SplitSentinel end() const { return SplitSentinel{}; }
+
+private:
+    const char *text_start;
+    const char *text_end;
+    Separator separator;
+};
+
+template<typename View, typename Predicate> class PredicateSplitRange {
+public:
+    class Iterator {
+    public:
+        Iterator(const char *start, const char *stop, const Predicate *is_split_char)
+            : text_end{stop}, is_split_char{is_split_char} {
+            find_piece(start);
+        }
+
+        View operator*() const { return SplitTraits<View>::piece(piece_start, piece_end); }
+
+        Iterator &operator++() {
+            find_piece(piece_end);
+            return *this;
+        }
+
+        bool operator==(SplitSentinel) const { return piece_start == text_end; }
+
+    private:
+        void find_piece(const char *i) {
+            size_t char_size;
+            while(i != text_end && SplitTraits<View>::is_split_at(i, char_size, *is_split_char)) {
+                i += char_size;
+            }
+            piece_start = i;
+            while(i != text_end && !SplitTraits<View>::is_split_at(i, char_size, *is_split_char)) {
+                i += char_size;
+            }
+            piece_end = i;
+        }
+
+        const char *piece_start;
+        const char *piece_end;
+        const char *text_end;
+        const Predicate *is_split_char;
+    };
+
+    PredicateSplitRange(const char *start, const char *stop, const Predicate &is_split_char)
+        : text_start{start}, text_end{stop}, is_split_char{is_split_char} {}
+
+    // The iterators point to the predicate stored in this object.
+    Iterator begin() const { return Iterator(text_start, text_end, &is_split_char); }
+    SplitSentinel end() const { return SplitSentinel{}; }
+
+private:
+    const char *text_start;
+    const char *text_end;
+    Predicate is_split_char;
+};
+
+inline SeparatorSplitRange<CStringView, CharSeparator> CStringView::split_view(char separator) const {
+    return SeparatorSplitRange<CStringView, CharSeparator>(begin(), end(), CharSeparator{separator});
+}
+
+inline SeparatorSplitRange<CStringView, SubstringSeparator>
+CStringView::split_view(CStringView separator) const {
+    return SeparatorSplitRange<CStringView, SubstringSeparator>(
+        begin(), end(), SubstringSeparator{separator});
+}
+
+template<typename Predicate>
+PredicateSplitRange<CStringView, Predicate>
+CStringView::split_view_if(const Predicate &is_split_char) const {
+    return PredicateSplitRange<CStringView, Predicate>(begin(), end(), is_split_char);
+}
+
+inline SeparatorSplitRange<CStringView, CharSeparator> CString::split_view(char separator) const {
+    return view().split_view(separator);
+}
+
+inline SeparatorSplitRange<CStringView, SubstringSeparator>
+CString::split_view(CStringView separator) const {
+    return view().split_view(separator);
+}
+
+template<typename Predicate>
+PredicateSplitRange<CStringView, Predicate>
+CString::split_view_if(const Predicate &is_split_char) const {
+    return view().split_view_if(is_split_char);
+}
+
+inline SeparatorSplitRange<U8StringView, CharSeparator>
+U8StringView::split_view(char separator) const {
+    if((unsigned char)separator >= 0x80) {
+        bootstrap_throw("Split separator character must be ASCII.");
+    }
+    return SeparatorSplitRange<U8StringView, CharSeparator>(
+        data(), data() + size_bytes(), CharSeparator{separator});
+}
+
+inline SeparatorSplitRange<U8StringView, SubstringSeparator>
+U8StringView::split_view(const U8StringView &separator) const {
+    return SeparatorSplitRange<U8StringView, SubstringSeparator>(
+        data(), data() + size_bytes(), SubstringSeparator{separator.raw_view()});
+}
+
+inline SeparatorSplitRange<U8StringView, SubstringSeparator>
+U8StringView::split_view(const char *separator) const {
+    return split_view(U8StringView(separator, strlen(separator)));
+}
+
+template<typename Predicate>
+PredicateSplitRange<U8StringView, Predicate>
+U8StringView::split_view_if(const Predicate &is_split_char) const {
+    return PredicateSplitRange<U8StringView, Predicate>(
+        data(), data() + size_bytes(), is_split_char);
+}
+
 // Currently handles only whitespace splitting.
 
+struct PieceLocation {
+    size_t offset;
+    size_t size;
+};
+
+// Splits text at ASCII whitespace, giving the same pieces as
+// CStringView::split and U8StringView::split_ascii. The input is
+// classified 64 bytes at a time and pieces are appended to the given
+// vector in batches of at most max_pieces. A return value of zero
+// means that the text has been exhausted.
+class WhitespaceTokenizer {
+public:
+    WhitespaceTokenizer() noexcept = default;
+    explicit WhitespaceTokenizer(CStringView text) noexcept
+        : buf{text.data()}, bufsize{text.size()} {}
+    explicit WhitespaceTokenizer(const U8StringView &text) noexcept
+        : buf{text.data()}, bufsize{text.size_bytes()} {}
+
+    size_t next_batch(Vector<PieceLocation> &out, size_t max_pieces);
+    size_t next_batch(Vector<CStringView> &out, size_t max_pieces);
+    // Only valid if the tokenizer was created from an U8StringView.
+    size_t next_batch(Vector<U8StringView> &out, size_t max_pieces);
+
+private:
+    friend class CStringView;
+
+    // Defined in the source file. Callback gets the location of
+    // each piece and returns false to stop.
+    template<typename Callback> size_t tokenize(const Callback &cb, size_t max_pieces);
+
+    const char *buf = nullptr;
+    size_t bufsize = 0;
+    size_t offset = 0;
+};
+
+// Hands out the pieces of a WhitespaceTokenizer one at a time.
 class U8StringSplitClosure_temp {
 public:
-    U8StringSplitClosure_temp() noexcept : original{}, current{original.start} {};
-    explicit U8StringSplitClosure_temp(U8StringView original_string) noexcept
-        : original{::pystd2026::move(original_string)}, current{original.start} {}
+    U8StringSplitClosure_temp() noexcept = default;
+    explicit U8StringSplitClosure_temp(const U8StringView &original_string) noexcept
+        : tokenizer{original_string} {}
 
     U8StringSplitClosure_temp(U8StringSplitClosure_temp &&o) noexcept = default;
 
@@ -2012,8 +2455,9 @@ public:
     Optional<U8StringView> next();
 
 private:
-    U8StringView original;
-    ValidU8Iterator current;
+    WhitespaceTokenizer tokenizer;
+    Vector<U8StringView> batch;
+    size_t next_piece = 0;
 };
 
 typedef bool (*U8StringViewCallback)(const U8StringView &piece, void *ctx);
@@ -2021,8 +2465,15 @@ typedef bool (*IsSplittingCharacter)(uint32_t codepoint);
 
 class U8String {
 public:
+    friend class U8StringView;
+    template<typename T> friend struct FormatSink;
+
     U8String() noexcept = default;
-    U8String(U8String &&o) noexcept = default;
+    U8String(U8String &&o) noexcept
+        : cstring{move(o.cstring)}, codepoint_index{move(o.codepoint_index)},
+          num_codepoints{o.num_codepoints} {
+        o.num_codepoints = (size_t)-1;
+    }
     U8String(const U8String &o) noexcept = default;
     U8String(Bytes incoming);
     explicit U8String(const U8StringView &view);
@@ -2034,6 +2485,15 @@ public:
 
     U8String substr(size_t offset, size_t length) const;
 
+    // Codepoint indexed access. Long strings get a sparse index of
+    // byte offsets that is built on first use and discarded when the
+    // string is modified. Building it changes internal state, so
+    // these are not safe to call from multiple threads at once.
+    size_t size_codepoints() const;
+    // Byte offset of the codepoint with the given index.
+    size_t codepoint_offset(size_t index) const;
+    U8StringView slice_codepoints(size_t start, size_t count = -1) const;
+
     U8StringView view() const;
 
     template<typename Seq> U8String join(const Seq &sequence) const {
@@ -2059,10 +2519,16 @@ public:
     void operator=(U8String &&o) noexcept {
         if(this != &o) {
             cstring = move(o.cstring);
+            codepoint_index = move(o.codepoint_index);
+            num_codepoints = o.num_codepoints;
+            o.num_codepoints = (size_t)-1;
         }
     }
 
-    void operator=(const U8StringView &o) noexcept { cstring = CString(o.data(), o.size_bytes()); }
+    void operator=(const U8StringView &o) noexcept {
+        cstring = CString(o.data(), o.size_bytes());
+        invalidate_codepoint_index();
+    }
 
     // FIXME. These currently do ASCIIbetical sorting. Fix to do codepoints instead.
     bool operator==(const U8String &o) const { return cstring == o.cstring; }
@@ -2082,6 +2548,26 @@ public:
 
     void split(U8StringViewCallback cb, IsSplittingCharacter is_split_char, void *ctx) const;
 
+    template<typename Callback, typename Predicate>
+    void split(const Callback &cb, const Predicate &is_split_char) const {
+        view().split(cb, is_split_char);
+    }
+
+    SeparatorSplitRange<U8StringView, CharSeparator> split_view(char separator) const {
+        return view().split_view(separator);
+    }
+    SeparatorSplitRange<U8StringView, SubstringSeparator>
+    split_view(const U8StringView &separator) const {
+        return view().split_view(separator);
+    }
+    SeparatorSplitRange<U8StringView, SubstringSeparator> split_view(const char *separator) const {
+        return view().split_view(separator);
+    }
+    template<typename Predicate>
+    PredicateSplitRange<U8StringView, Predicate> split_view_if(const Predicate &is_split_char) const {
+        return view().split_view_if(is_split_char);
+    }
+
     ValidU8Iterator cbegin() const {
         return ValidU8Iterator((const unsigned char *)cstring.data());
     }
@@ -2108,19 +2594,103 @@ public:
     bool contains(const U8StringView &view) const;
     bool overlaps(const U8StringView &view) const;
 
+    size_t find(const U8StringView &substr) const { return view().find(substr); }
+    size_t rfind(const U8StringView &substr) const { return view().rfind(substr); }
+
     ::pystd2026::U8String upper() const { return view().upper(); }
 
     ::pystd2026::U8String lower() const { return view().lower(); }
 
+    // Reuse the existing buffer. Only reallocates if case
+    // conversion changes the byte length of the string.
+    void upper_inplace();
+    void lower_inplace();
+
     void reserve(size_t size_in_bytes) noexcept { cstring.reserve(size_in_bytes); }
 
 private:
+    void build_codepoint_index() const;
+    void invalidate_codepoint_index() noexcept {
+        codepoint_index.clear();
+        num_codepoints = (size_t)-1;
+    }
+
     CString cstring;
-    // Store length in codepoints.
+    // Byte offset of every CODEPOINT_INDEX_INTERVAL:th codepoint.
+    mutable Vector<size_t> codepoint_index;
+    mutable size_t num_codepoints = (size_t)-1;
+};
+
+// Comparisons that ignore case without allocating. The CStringView
+// versions fold only ASCII letters. The U8StringView versions use
+// simple (one codepoint to one codepoint) Unicode case folding, so
+// for example "ß" and "SS" are not equal. Compare returns a negative
+// value, zero or a positive value like strcmp.
+bool equals_ignoring_case(CStringView a, CStringView b);
+int compare_ignoring_case(CStringView a, CStringView b);
+bool equals_ignoring_case(const U8StringView &a, const U8StringView &b);
+int compare_ignoring_case(const U8StringView &a, const U8StringView &b);
+
+constexpr size_t CASEFOLD_CHUNK_SIZE = 64;
+
+// Write the case folded form of the start of [text, end) to buf,
+// which must have room for CASEFOLD_CHUNK_SIZE bytes. Text is
+// advanced past the consumed input. Returns the number of bytes
+// written.
+size_t casefold_ascii_chunk(const char *&text, const char *end, char *buf);
+size_t casefold_utf8_chunk(const char *&text, const char *end, char *buf);
+
+// Strings that are equal ignoring case get the same hash. The folded
+// bytes may be fed in differently sized chunks than feed_hash would use,
+// so the hasher must give the same result however its input is split.
+template<typename Hasher> void feed_hash_ignoring_case(Hasher &h, CStringView text) {
+    char buf[CASEFOLD_CHUNK_SIZE];
+    const char *i = text.data();
+    const char *const end = i + text.size();
+    while(i != end) {
+        h.feed_bytes(buf, casefold_ascii_chunk(i, end, buf));
+    }
+}
+
+template<typename Hasher> void feed_hash_ignoring_case(Hasher &h, const U8StringView &text) {
+    char buf[CASEFOLD_CHUNK_SIZE];
+    const char *i = text.data();
+    const char *const end = i + text.size_bytes();
+    while(i != end) {
+        h.feed_bytes(buf, casefold_utf8_chunk(i, end, buf));
+    }
+}
+
+// Wraps a string so that it compares and hashes ignoring case, for
+// example to be used as a HashMap key. String can be CString,
+// CStringView, U8String or U8StringView.
+template<typename String> class CaseInsensitive {
+public:
+    CaseInsensitive() noexcept = default;
+    CaseInsensitive(String s) noexcept : str{::pystd2026::move(s)} {}
+
+    const String &get() const noexcept { return str; }
+
+    bool operator==(const CaseInsensitive &o) const {
+        return equals_ignoring_case(view_of(str), view_of(o.str));
+    }
+
+    template<typename Hasher> void feed_hash(Hasher &h) const {
+        feed_hash_ignoring_case(h, view_of(str));
+    }
+
+private:
+    static CStringView view_of(CStringView v) { return v; }
+    static CStringView view_of(const CString &s) { return s.view(); }
+    static const U8StringView &view_of(const U8StringView &v) { return v; }
+    static U8StringView view_of(const U8String &s) { return s.view(); }
+
+    String str;
 };
 
 class PyException {
 public:
+    PyException() noexcept = default;
     explicit PyException(const char *msg);
     explicit PyException(U8String msg) : message{msg} {}
 
@@ -2178,6 +2748,71 @@ private:
     EncodingPolicy policy;
 };
 
+// Collects output in a large buffer and hands it to the operating
+// system with as few system calls as possible. Data that does not fit
+// in the buffer is written together with the buffered data using a
+// single writev. Output is written when the buffer fills up, on flush
+// and when the writer is destroyed.
+class BufferedWriter final {
+public:
+    static constexpr size_t DEFAULT_BUFFER_SIZE = 1024 * 1024;
+
+    // The file descriptor is not closed by the writer.
+    explicit BufferedWriter(int fd, size_t buffer_size = DEFAULT_BUFFER_SIZE);
+    // Creates the file or truncates an existing one.
+    explicit BufferedWriter(const char *path, size_t buffer_size = DEFAULT_BUFFER_SIZE);
+    // Flushes, but can not report errors. Call flush to see them.
+    ~BufferedWriter();
+
+    BufferedWriter(const BufferedWriter &) = delete;
+    BufferedWriter &operator=(const BufferedWriter &) = delete;
+
+    void write(const char *data, size_t data_size) {
+        if(data_size <= buf.size() - used) {
+            memcpy(buf.get() + used, data, data_size);
+            used += data_size;
+        } else {
+            write_overflowing(data, data_size);
+        }
+    }
+
+    void write(char c) {
+        if(used == buf.size()) {
+            flush();
+        }
+        buf.get()[used++] = c;
+    }
+
+    void write(CStringView text) { write(text.data(), text.size()); }
+    void write(const U8StringView &text) { write(text.data(), text.size_bytes()); }
+    void write(const Bytes &bytes) { write(bytes.data(), bytes.size()); }
+
+    // Writes all pieces one after the other. Big pieces are not copied
+    // to the buffer but passed to writev as they are.
+    void write_pieces(Span<const CStringView> pieces);
+
+    // Makes room for at least this many bytes if the buffer is big
+    // enough for them.
+    void reserve(size_t size) {
+        if(size > buf.size() - used) {
+            flush();
+        }
+    }
+
+    void flush();
+
+    size_t buffer_size() const { return buf.size(); }
+    size_t buffered_size() const { return used; }
+
+private:
+    void write_overflowing(const char *data, size_t data_size);
+
+    unique_arr<char> buf;
+    size_t used = 0;
+    int fd;
+    bool owns_fd;
+};
+
 class Range {
 public:
     Range() noexcept : Range(0) {};
@@ -2188,6 +2823,11 @@ public:
 
     Optional<int64_t> next();
 
+    // Number of values not yet returned by next.
+    size_t size() const;
+    // The value that next would return after index other calls.
+    int64_t operator[](size_t index) const { return i + (int64_t)index * step; }
+
     Range &operator=(const Range &o) noexcept = default;
 
 private:
@@ -2256,35 +2896,149 @@ private:
     unique_ptr<GlobResultInternal> p;
 };
 
+enum class MMapAccess : uint8_t {
+    Normal,
+    Sequential,
+    Random,
+};
+
+struct MMapOptions {
+    // Reads the whole window in while mapping, so that accessing it
+    // later causes no page faults.
+    bool populate = false;
+    MMapAccess access = MMapAccess::Normal;
+    // Starts reading the window in the background.
+    bool will_need = false;
+    // Asks for transparent huge pages where the system supports them.
+    bool huge_pages = false;
+    // The part of the file to map. The offset does not need to be
+    // page aligned. A length of zero maps to the end of the file.
+    uint64_t offset = 0;
+    uint64_t length = 0;
+    // Maps the file shared and writable, so that changes go to the
+    // file. The file must be opened for writing.
+    bool writable = false;
+};
+
 class MMapping {
 public:
-    MMapping() noexcept : buf{nullptr}, bufsize{0} {};
-    MMapping(void *buf_, size_t bufsize_) : buf{buf_}, bufsize(bufsize_) {}
+    MMapping() noexcept : buf{nullptr}, bufsize{0}, data_offset{0}, writable{false} {};
+    // Data starts at data_offset bytes from the start of the mapping,
+    // which is needed for windows that are not page aligned.
+    MMapping(void *buf_, size_t bufsize_, size_t data_offset_ = 0, bool writable_ = false)
+        : buf{buf_}, bufsize(bufsize_), data_offset{data_offset_}, writable{writable_} {}
     MMapping(const MMapping &) = delete;
-    MMapping(MMapping &&o) noexcept : buf{o.buf}, bufsize{o.bufsize} {
+    MMapping(MMapping &&o) noexcept
+        : buf{o.buf}, bufsize{o.bufsize}, data_offset{o.data_offset}, writable{o.writable} {
         o.buf = nullptr;
         o.bufsize = 0;
+        o.data_offset = 0;
+        o.writable = false;
     }
     ~MMapping();
 
-    Span<const char> span() const { return Span{(const char *)buf, bufsize}; }
+    Span<const char> span() const {
+        return Span{(const char *)buf + data_offset, bufsize - data_offset};
+    }
+
+    // Throws if the mapping is not writable.
+    Span<char> writable_span();
+
+    bool is_writable() const { return writable; }
+
+    // Changes the expected access pattern of the whole mapping.
+    void advise(MMapAccess access) const;
+
+    // Waits until changes to a writable mapping are in the file.
+    void flush();
 
     MMapping &operator=(MMapping &&o) noexcept {
         if(this != &o) {
+            unmap();
             buf = o.buf;
             bufsize = o.bufsize;
+            data_offset = o.data_offset;
+            writable = o.writable;
             o.buf = nullptr;
             o.bufsize = 0;
+            o.data_offset = 0;
+            o.writable = false;
         }
         return *this;
     }
 
 private:
+    void unmap() noexcept;
+
     void *buf;
     size_t bufsize;
+    size_t data_offset;
+    bool writable;
 };
 
+// These return an empty optional if the file can not be mapped, is
+// empty or the requested window does not fit in it.
 Optional<MMapping> mmap_file(const char *path);
+Optional<MMapping> mmap_file(const char *path, const MMapOptions &options);
+// The file descriptor is not closed. It may be closed while the
+// mapping is still in use.
+Optional<MMapping> mmap_file(int fd, const MMapOptions &options = MMapOptions{});
+
+// Writes a file through a shared mapping, without write calls or
+// intermediate buffers. When the data outgrows the file, the file is
+// extended with ftruncate and the mapping with mremap, doubling the
+// capacity. Closing truncates the file to the size that was written.
+class GrowableMapping final {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 1024 * 1024;
+
+    // Creates the file or truncates an existing one.
+    explicit GrowableMapping(const char *path, size_t initial_capacity = DEFAULT_CAPACITY);
+    // Closes, but can not report errors. Call close to see them.
+    ~GrowableMapping();
+
+    GrowableMapping(const GrowableMapping &) = delete;
+    GrowableMapping &operator=(const GrowableMapping &) = delete;
+
+    void append(const char *data, size_t data_size) {
+        memcpy(extend(data_size), data, data_size);
+    }
+
+    void append(CStringView text) { append(text.data(), text.size()); }
+
+    // Grows the data by the given amount and returns a pointer to the
+    // new bytes for the caller to fill. The pointer is valid until the
+    // next call that changes the size.
+    char *extend(size_t amount) {
+        if(fd < 0 || amount > capacity - used) {
+            grow(amount);
+        }
+        char *result = buf + used;
+        used += amount;
+        return result;
+    }
+
+    void resize(size_t new_size);
+
+    // Empty after close.
+    Span<char> span() { return fd < 0 ? Span<char>() : Span<char>(buf, used); }
+    size_t size() const { return used; }
+
+    // Waits until the data written so far is in the file.
+    void flush();
+
+    // Truncates the file to its final size and releases everything.
+    // Does nothing if already closed.
+    void close();
+
+private:
+    void grow(size_t amount);
+
+    char *buf = nullptr;
+    size_t used = 0;
+    size_t capacity = 0;
+    int fd = -1;
+};
 
 template<typename T> class Stack {
 public:
@@ -2311,6 +3065,47 @@ private:
     Vector<T> backing;
 };
 
+enum class ParseError : uint8_t {
+    Empty,
+    InvalidCharacter,
+    OutOfRange,
+};
+
+// Parse the sign and digits of an integer. The view must contain
+// nothing else, no whitespace and no base prefix. Base must be
+// between 2 and 36.
+Expected<uint64_t, ParseError> parse_integer_magnitude(CStringView text, int base, bool &is_negative);
+
+template<typename T> Expected<T, ParseError> parse_int(CStringView text, int base = 10) {
+    static_assert(is_integral_v<T> && !is_same_v<T, bool>);
+    constexpr bool is_signed = T(-1) < T(0);
+    constexpr uint64_t max_value = is_signed ? (uint64_t(1) << (sizeof(T) * 8 - 1)) - 1 : T(-1);
+    bool is_negative;
+    auto magnitude = parse_integer_magnitude(text, base, is_negative);
+    if(!magnitude) {
+        return magnitude.error();
+    }
+    const uint64_t m = magnitude.value();
+    if(is_negative) {
+        if(m == 0) {
+            return T(0);
+        }
+        if(!is_signed || m - 1 > max_value) {
+            return ParseError::OutOfRange;
+        }
+        return T(-T(m - 1) - 1);
+    }
+    if(m > max_value) {
+        return ParseError::OutOfRange;
+    }
+    return T(m);
+}
+
+// Accepts the same syntax as Python's float() apart from whitespace
+// and underscores. Out of range values become infinity or zero.
+// Correctly rounded and independent of the locale.
+Expected<double, ParseError> parse_float(CStringView text);
+
 typedef void (*StringCFormatCallback)(const char *buf, size_t bufsize, void *ctx);
 CString cformat(const char *format, ...);
 void cformat_with_cb(StringCFormatCallback cb, void *ctx, const char *format, va_list ap);
@@ -2448,6 +3243,8 @@ struct UnicodeConversionResult {
 
 UnicodeConversionResult uppercase_unicode(uint32_t codepoint);
 UnicodeConversionResult lowercase_unicode(uint32_t codepoint);
+// Simple case folding, maps case variants of a letter to the same codepoint.
+uint32_t casefold_unicode(uint32_t codepoint);
 
 // The C++ standard mandates that spaceship comparing
 // builtin types returns a std::something, which we don't
@@ -2687,6 +3484,11 @@ constexpr size_t insertion_sort_limit =
 template<BasicIterator It, typename Comparator>
 void insertion_sort_has_sentinel(It begin, It end, const Comparator &cmp) {
     using ValueType = ::pystd2026::remove_reference_t<decltype(*begin)>;
+    // Introsort may pass in an empty range when everything
+    // on the right side is equal to the pivot.
+    if(begin == end) {
+        return;
+    }
     // This should be faster, but according to measurements it is not.
     constexpr bool is_cheap_to_copy = false;
     // ::pystd2026::is_integral_v<ValueType> || ::pystd2026::is_floating_point_v<ValueType>;
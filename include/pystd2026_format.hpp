@@ -0,0 +1,514 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 Jussi Pakkanen
+
+#pragma once
+
+#include <pystd2026.hpp>
+
+// Python str.format style formatting where the format string is
+// parsed and checked against the argument types at compile time.
+//
+// Replacement fields are {} or {:spec} where spec is
+//
+//   [[fill]align][sign][#][0][width][.precision][type]
+//
+// Arguments are consumed in order, explicit indexes are not
+// supported. Use {{ and }} for literal braces.
+
+namespace pystd2026 {
+
+enum class FormatArgType : uint8_t {
+    Unsupported,
+    Bool,
+    Char,
+    SignedInt,
+    UnsignedInt,
+    Float,
+    CStr,
+    ByteString,
+    U8Str,
+};
+
+template<typename T> struct FormatArgTypeOf {
+    static constexpr FormatArgType value = [] {
+        if constexpr(is_same_v<T, bool>) {
+            return FormatArgType::Bool;
+        } else if constexpr(is_same_v<T, char>) {
+            return FormatArgType::Char;
+        } else if constexpr(is_integral_v<T>) {
+            return T(-1) < T(0) ? FormatArgType::SignedInt : FormatArgType::UnsignedInt;
+        } else if constexpr(is_same_v<T, float> || is_same_v<T, double>) {
+            return FormatArgType::Float;
+        } else if constexpr(is_same_v<T, const char *> || is_same_v<T, char *>) {
+            return FormatArgType::CStr;
+        } else if constexpr(is_same_v<T, CString> || is_same_v<T, CStringView>) {
+            return FormatArgType::ByteString;
+        } else if constexpr(is_same_v<T, U8String> || is_same_v<T, U8StringView>) {
+            return FormatArgType::U8Str;
+        } else {
+            return FormatArgType::Unsupported;
+        }
+    }();
+};
+
+template<size_t N> struct FormatArgTypeOf<char[N]> {
+    static constexpr FormatArgType value = FormatArgType::CStr;
+};
+
+template<typename T>
+constexpr FormatArgType format_arg_type = FormatArgTypeOf<remove_cvref_t<T>>::value;
+
+struct FormatSpec {
+    char fill = ' ';
+    // One of '<', '>', '^' or zero for the type's default.
+    char align = 0;
+    // One of '+', '-', ' ' or zero.
+    char sign = 0;
+    char type = 0;
+    bool alternate = false;
+    bool zero_pad = false;
+    uint32_t width = 0;
+    int32_t precision = -1;
+};
+
+struct FormatField {
+    // The replacement field is at [start, end) in the format string.
+    uint32_t start = 0;
+    uint32_t end = 0;
+    FormatSpec spec;
+};
+
+const uint32_t FORMAT_MAX_WIDTH = 1 << 20;
+const int32_t FORMAT_MAX_PRECISION = 64;
+
+// Not constexpr on purpose. Calling it during constant
+// evaluation makes compilation fail with this message.
+void format_string_error(const char *message);
+
+template<typename... Args> class FormatString {
+public:
+    consteval FormatString(const char *format) : text{format} { parse(); }
+
+    const char *text;
+    uint32_t text_size = 0;
+    uint32_t literal_size = 0;
+    bool has_escapes = false;
+    // The last entry marks the end of the format string.
+    FormatField fields[sizeof...(Args) + 1]{};
+
+private:
+    consteval void parse() {
+        constexpr FormatArgType arg_types[] = {format_arg_type<Args>..., FormatArgType::Unsupported};
+        size_t num_fields = 0;
+        uint32_t i = 0;
+        while(text[i] != '\0') {
+            if(text[i] == '{' && text[i + 1] != '{') {
+                if(num_fields == sizeof...(Args)) {
+                    format_string_error("More replacement fields than arguments.");
+                }
+                if(arg_types[num_fields] == FormatArgType::Unsupported) {
+                    format_string_error("Unsupported argument type.");
+                }
+                FormatField &field = fields[num_fields];
+                field.start = i;
+                ++i;
+                if(text[i] == ':') {
+                    i = parse_spec(i + 1, field.spec, arg_types[num_fields]);
+                }
+                if(text[i] != '}') {
+                    format_string_error("Replacement field is not terminated with '}'.");
+                }
+                ++i;
+                field.end = i;
+                ++num_fields;
+            } else if(text[i] == '{' || text[i] == '}') {
+                if(text[i + 1] != text[i]) {
+                    format_string_error("Single '}' in format string.");
+                }
+                has_escapes = true;
+                ++literal_size;
+                i += 2;
+            } else {
+                ++literal_size;
+                ++i;
+            }
+        }
+        if(num_fields != sizeof...(Args)) {
+            format_string_error("Fewer replacement fields than arguments.");
+        }
+        text_size = i;
+        fields[num_fields].start = i;
+        fields[num_fields].end = i;
+    }
+
+    static constexpr bool is_align_char(char c) { return c == '<' || c == '>' || c == '^'; }
+
+    static constexpr bool is_digit(char c) { return c >= '0' && c <= '9'; }
+
+    static constexpr bool is_one_of(char c, const char *options) {
+        for(; *options; ++options) {
+            if(c == *options) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    consteval uint32_t parse_spec(uint32_t i, FormatSpec &spec, FormatArgType arg_type) {
+        bool has_fill = false;
+        if(text[i] != '\0' && is_align_char(text[i + 1])) {
+            if(text[i] == '{' || text[i] == '}') {
+                format_string_error("Braces can not be used as fill characters.");
+            }
+            spec.fill = text[i];
+            spec.align = text[i + 1];
+            has_fill = true;
+            i += 2;
+        } else if(is_align_char(text[i])) {
+            spec.align = text[i];
+            ++i;
+        }
+        if(is_one_of(text[i], "+- ")) {
+            spec.sign = text[i];
+            ++i;
+        }
+        if(text[i] == '#') {
+            spec.alternate = true;
+            ++i;
+        }
+        if(text[i] == '0') {
+            spec.zero_pad = true;
+            if(!has_fill) {
+                spec.fill = '0';
+            }
+            ++i;
+        }
+        while(is_digit(text[i])) {
+            spec.width = 10 * spec.width + (text[i] - '0');
+            if(spec.width > FORMAT_MAX_WIDTH) {
+                format_string_error("Field width is too large.");
+            }
+            ++i;
+        }
+        if(text[i] == '.') {
+            ++i;
+            if(!is_digit(text[i])) {
+                format_string_error("Precision is missing after '.'.");
+            }
+            spec.precision = 0;
+            while(is_digit(text[i])) {
+                spec.precision = 10 * spec.precision + (text[i] - '0');
+                if(spec.precision > FORMAT_MAX_PRECISION) {
+                    format_string_error("Precision is too large.");
+                }
+                ++i;
+            }
+        }
+        if(text[i] != '}' && text[i] != '\0') {
+            spec.type = text[i];
+            ++i;
+        }
+        validate_spec(spec, arg_type);
+        return i;
+    }
+
+    static consteval void validate_spec(const FormatSpec &spec, FormatArgType arg_type) {
+        const bool is_numeric_spec = spec.sign || spec.alternate || spec.zero_pad;
+        switch(arg_type) {
+        case FormatArgType::Char:
+            if(spec.type == 0 || spec.type == 'c') {
+                if(is_numeric_spec || spec.precision >= 0) {
+                    format_string_error("Invalid format specifier for a character.");
+                }
+                return;
+            }
+            [[fallthrough]];
+        case FormatArgType::SignedInt:
+        case FormatArgType::UnsignedInt:
+            if(!is_one_of(spec.type, "bdoxX") && spec.type != 0) {
+                format_string_error("Invalid presentation type for an integer.");
+            }
+            if(spec.precision >= 0) {
+                format_string_error("Precision is not allowed for integers.");
+            }
+            return;
+        case FormatArgType::Float:
+            if(!is_one_of(spec.type, "eEfFgG%") && spec.type != 0) {
+                format_string_error("Invalid presentation type for a floating point number.");
+            }
+            return;
+        case FormatArgType::Bool:
+        case FormatArgType::CStr:
+        case FormatArgType::ByteString:
+        case FormatArgType::U8Str:
+            if(spec.type != 0 && spec.type != 's') {
+                format_string_error("Invalid presentation type for a string.");
+            }
+            if(is_numeric_spec || spec.precision >= 0) {
+                format_string_error("Invalid format specifier for a string.");
+            }
+            return;
+        case FormatArgType::Unsupported:
+            format_string_error("Unsupported argument type.");
+        }
+    }
+};
+
+template<typename T> struct FormatTypeIdentity {
+    using type = T;
+};
+
+// Keeps the format string from taking part in template argument deduction.
+template<typename... Args>
+using FormatStringFor = FormatString<typename FormatTypeIdentity<Args>::type...>;
+
+// Large enough for any number with FORMAT_MAX_PRECISION, not
+// counting padding.
+const size_t FORMATTED_NUMBER_BUF_SIZE = 400;
+
+struct FormattedNumber {
+    char buf[FORMATTED_NUMBER_BUF_SIZE];
+    uint32_t size = 0;
+    // Sign and base prefix, zero padding goes after these.
+    uint32_t prefix_size = 0;
+};
+
+void format_integer(FormattedNumber &result,
+                    uint64_t magnitude,
+                    bool is_negative,
+                    const FormatSpec &spec);
+
+// Without a presentation type or precision, prints the shortest
+// representation that parses back to the same value, like Python's
+// repr. A precision without a type is the same as 'g'.
+void format_float(FormattedNumber &result, double value, const FormatSpec &spec);
+
+template<typename T> struct FormatSink;
+
+template<> struct FormatSink<CString> {
+    CString &out;
+
+    void reserve(size_t extra) { out.reserve(out.size() + extra + 1); }
+    void append(const char *buf, size_t bufsize) { out.append(buf, bufsize); }
+};
+
+template<> struct FormatSink<Bytes> {
+    Bytes &out;
+
+    void reserve(size_t extra) { out.reserve(out.size() + extra); }
+    void append(const char *buf, size_t bufsize) { out.append(buf, buf + bufsize); }
+};
+
+// Arguments must be validated before appending anything.
+template<> struct FormatSink<U8String> {
+    explicit FormatSink(U8String &out_) : out{out_} { out.invalidate_codepoint_index(); }
+
+    void reserve(size_t extra) { out.cstring.reserve(out.size_bytes() + extra + 1); }
+    void append(const char *buf, size_t bufsize) { out.cstring.append(buf, bufsize); }
+
+    U8String &out;
+};
+
+// Formats straight into the writer's buffer.
+template<> struct FormatSink<BufferedWriter> {
+    BufferedWriter &out;
+
+    void reserve(size_t extra) { out.reserve(extra); }
+    void append(const char *buf, size_t bufsize) { out.write(buf, bufsize); }
+};
+
+template<typename Sink> void format_fill(Sink &sink, char fill, size_t count) {
+    char block[32];
+    memset(block, fill, sizeof(block));
+    while(count > 0) {
+        const size_t chunk = count < sizeof(block) ? count : sizeof(block);
+        sink.append(block, chunk);
+        count -= chunk;
+    }
+}
+
+// text_width is the width of the text in characters.
+template<typename Sink>
+void format_padded(Sink &sink,
+                   const FormatSpec &spec,
+                   char default_align,
+                   const char *text,
+                   size_t text_size,
+                   size_t text_width) {
+    if(spec.width <= text_width) {
+        sink.append(text, text_size);
+        return;
+    }
+    const size_t padding = spec.width - text_width;
+    const char align = spec.align ? spec.align : default_align;
+    const size_t before = align == '>' ? padding : (align == '^' ? padding / 2 : 0);
+    format_fill(sink, spec.fill, before);
+    sink.append(text, text_size);
+    format_fill(sink, spec.fill, padding - before);
+}
+
+template<typename Sink>
+void format_number(Sink &sink, const FormatSpec &spec, const FormattedNumber &number) {
+    if(spec.zero_pad && spec.align == 0 && spec.width > number.size) {
+        sink.append(number.buf, number.prefix_size);
+        format_fill(sink, '0', spec.width - number.size);
+        sink.append(number.buf + number.prefix_size, number.size - number.prefix_size);
+    } else {
+        format_padded(sink, spec, '>', number.buf, number.size, number.size);
+    }
+}
+
+inline U8StringView format_u8_view(const U8String &str) { return str.view(); }
+inline U8StringView format_u8_view(const U8StringView &str) { return str; }
+
+template<typename Sink, typename T>
+void format_value(Sink &sink, const FormatSpec &spec, const T &value) {
+    constexpr FormatArgType arg_type = format_arg_type<T>;
+    FormattedNumber number;
+    if constexpr(arg_type == FormatArgType::Bool) {
+        const CStringView text = value ? CStringView("True") : CStringView("False");
+        format_padded(sink, spec, '<', text.data(), text.size(), text.size());
+        return;
+    } else if constexpr(arg_type == FormatArgType::Char) {
+        if(spec.type == 0 || spec.type == 'c') {
+            format_padded(sink, spec, '<', &value, 1, 1);
+            return;
+        }
+        format_integer(number, (unsigned char)value, false, spec);
+    } else if constexpr(arg_type == FormatArgType::SignedInt) {
+        const bool is_negative = value < 0;
+        const uint64_t magnitude = is_negative ? uint64_t(0) - uint64_t(value) : uint64_t(value);
+        format_integer(number, magnitude, is_negative, spec);
+    } else if constexpr(arg_type == FormatArgType::UnsignedInt) {
+        format_integer(number, value, false, spec);
+    } else if constexpr(arg_type == FormatArgType::Float) {
+        format_float(number, value, spec);
+    } else if constexpr(arg_type == FormatArgType::CStr) {
+        const size_t size = strlen(value);
+        format_padded(sink, spec, '<', value, size, size);
+        return;
+    } else if constexpr(arg_type == FormatArgType::ByteString) {
+        format_padded(sink, spec, '<', value.data(), value.size(), value.size());
+        return;
+    } else if constexpr(arg_type == FormatArgType::U8Str) {
+        const U8StringView view = format_u8_view(value);
+        const size_t width = spec.width > 0 ? view.size_codepoints() : 0;
+        format_padded(sink, spec, '<', view.data(), view.size_bytes(), width);
+        return;
+    }
+    format_number(sink, spec, number);
+}
+
+template<typename T> size_t format_size_estimate(const FormatSpec &spec, const T &value) {
+    constexpr FormatArgType arg_type = format_arg_type<T>;
+    size_t estimate = 0;
+    if constexpr(arg_type == FormatArgType::Bool) {
+        estimate = 5;
+    } else if constexpr(arg_type == FormatArgType::Char) {
+        estimate = 3;
+    } else if constexpr(arg_type == FormatArgType::SignedInt ||
+                        arg_type == FormatArgType::UnsignedInt) {
+        estimate = 20;
+    } else if constexpr(arg_type == FormatArgType::Float) {
+        estimate = 24 + (spec.precision > 0 ? spec.precision : 0);
+    } else if constexpr(arg_type == FormatArgType::CStr) {
+        estimate = strlen(value);
+    } else if constexpr(arg_type == FormatArgType::ByteString) {
+        estimate = value.size();
+    } else if constexpr(arg_type == FormatArgType::U8Str) {
+        estimate = format_u8_view(value).size_bytes();
+    }
+    return estimate > spec.width ? estimate : spec.width;
+}
+
+// Throws if the argument would produce invalid UTF-8.
+template<typename T> void format_validate_utf8(const FormatSpec &spec, const T &value) {
+    constexpr FormatArgType arg_type = format_arg_type<T>;
+    if constexpr(arg_type == FormatArgType::Char) {
+        if(spec.type == 0 || spec.type == 'c') {
+            (void)U8StringView(&value, 1);
+        }
+    } else if constexpr(arg_type == FormatArgType::CStr) {
+        (void)U8StringView(value, strlen(value));
+    } else if constexpr(arg_type == FormatArgType::ByteString) {
+        (void)U8StringView(value.data(), value.size());
+    }
+}
+
+template<typename Sink, typename... Args>
+void format_literal(Sink &sink, const FormatString<Args...> &fmt, size_t start, size_t end) {
+    if(!fmt.has_escapes) {
+        sink.append(fmt.text + start, end - start);
+        return;
+    }
+    // The parser has verified that all braces are doubled.
+    size_t run_start = start;
+    for(size_t i = start; i < end; ++i) {
+        if(fmt.text[i] == '{' || fmt.text[i] == '}') {
+            sink.append(fmt.text + run_start, i + 1 - run_start);
+            ++i;
+            run_start = i + 1;
+        }
+    }
+    sink.append(fmt.text + run_start, end - run_start);
+}
+
+template<typename Sink, typename... Args>
+void format_with_sink(Sink &sink, const FormatString<Args...> &fmt, const Args &...args) {
+    size_t estimate = fmt.literal_size;
+    size_t field = 0;
+    ((estimate += format_size_estimate(fmt.fields[field++].spec, args)), ...);
+    sink.reserve(estimate);
+
+    size_t literal_start = 0;
+    field = 0;
+    [[maybe_unused]] auto format_field = [&](const auto &arg) {
+        const FormatField &f = fmt.fields[field++];
+        format_literal(sink, fmt, literal_start, f.start);
+        format_value(sink, f.spec, arg);
+        literal_start = f.end;
+    };
+    (format_field(args), ...);
+    format_literal(sink, fmt, literal_start, fmt.text_size);
+}
+
+template<typename... Args>
+void format_to(CString &out, FormatStringFor<Args...> fmt, const Args &...args) {
+    FormatSink<CString> sink{out};
+    format_with_sink(sink, fmt, args...);
+}
+
+template<typename... Args>
+void format_to(Bytes &out, FormatStringFor<Args...> fmt, const Args &...args) {
+    FormatSink<Bytes> sink{out};
+    format_with_sink(sink, fmt, args...);
+}
+
+template<typename... Args>
+void format_to(U8String &out, FormatStringFor<Args...> fmt, const Args &...args) {
+    size_t field = 0;
+    (format_validate_utf8(fmt.fields[field++].spec, args), ...);
+    FormatSink<U8String> sink{out};
+    format_with_sink(sink, fmt, args...);
+}
+
+template<typename... Args>
+void format_to(BufferedWriter &out, FormatStringFor<Args...> fmt, const Args &...args) {
+    FormatSink<BufferedWriter> sink{out};
+    format_with_sink(sink, fmt, args...);
+}
+
+// Like Python's print, ends the output with a newline.
+template<typename... Args>
+void print(BufferedWriter &out, FormatStringFor<Args...> fmt, const Args &...args) {
+    format_to(out, fmt, args...);
+    out.write('\n');
+}
+
+template<typename... Args> CString format(FormatStringFor<Args...> fmt, const Args &...args) {
+    CString result;
+    format_to(result, fmt, args...);
+    return result;
+}
+
+} // namespace pystd2026
@@ -8,6 +8,12 @@
 
 namespace pystd2026 {
 
+// Blocks while the value at address equals expected. May return
+// spuriously, so callers must check their condition in a loop.
+void futex_wait(uint32_t *address, uint32_t expected);
+void futex_wake(uint32_t *address, uint32_t num_waiters);
+void futex_wake_all(uint32_t *address);
+
 template<typename T>
 concept Lockable = requires(T a) {
     a.lock();
@@ -35,6 +41,8 @@ public:
 
     ~LockGuard() { m.unlock(); }
 
+    T &lockable() const { return m; }
+
     LockGuard(const LockGuard &) = delete;
     LockGuard &operator=(const LockGuard &) = delete;
 
@@ -42,9 +50,747 @@ private:
     T &m;
 };
 
+constexpr size_t CACHE_LINE_SIZE = 64;
+
+enum class MemoryOrder : int {
+    Relaxed = __ATOMIC_RELAXED,
+    Acquire = __ATOMIC_ACQUIRE,
+    Release = __ATOMIC_RELEASE,
+    AcqRel = __ATOMIC_ACQ_REL,
+    SeqCst = __ATOMIC_SEQ_CST,
+};
+
+// Atomic integers, booleans and pointers. Every operation takes an
+// explicit memory order, defaulting to sequential consistency.
+template<typename T> class Atomic final {
+public:
+    static_assert(is_integral_v<T> || is_pointer_v<T>);
+
+    constexpr Atomic() noexcept : value{} {}
+    constexpr explicit Atomic(T initial) noexcept : value{initial} {}
+    Atomic(const Atomic &) = delete;
+    Atomic &operator=(const Atomic &) = delete;
+
+    T load(MemoryOrder order = MemoryOrder::SeqCst) const noexcept {
+        return __atomic_load_n(&value, (int)order);
+    }
+
+    void store(T desired, MemoryOrder order = MemoryOrder::SeqCst) noexcept {
+        __atomic_store_n(&value, desired, (int)order);
+    }
+
+    T exchange(T desired, MemoryOrder order = MemoryOrder::SeqCst) noexcept {
+        return __atomic_exchange_n(&value, desired, (int)order);
+    }
+
+    // On failure expected is updated to the current value.
+    bool compare_exchange_strong(T &expected,
+                                 T desired,
+                                 MemoryOrder success = MemoryOrder::SeqCst,
+                                 MemoryOrder failure = MemoryOrder::SeqCst) noexcept {
+        return __atomic_compare_exchange_n(
+            &value, &expected, desired, false, (int)success, (int)failure);
+    }
+
+    // May fail spuriously, use in a loop.
+    bool compare_exchange_weak(T &expected,
+                               T desired,
+                               MemoryOrder success = MemoryOrder::SeqCst,
+                               MemoryOrder failure = MemoryOrder::SeqCst) noexcept {
+        return __atomic_compare_exchange_n(
+            &value, &expected, desired, true, (int)success, (int)failure);
+    }
+
+    // These return the previous value.
+    T fetch_add(T amount, MemoryOrder order = MemoryOrder::SeqCst) noexcept
+        requires(is_integral_v<T> && !is_same_v<T, bool>)
+    {
+        return __atomic_fetch_add(&value, amount, (int)order);
+    }
+
+    T fetch_sub(T amount, MemoryOrder order = MemoryOrder::SeqCst) noexcept
+        requires(is_integral_v<T> && !is_same_v<T, bool>)
+    {
+        return __atomic_fetch_sub(&value, amount, (int)order);
+    }
+
+    T fetch_and(T mask, MemoryOrder order = MemoryOrder::SeqCst) noexcept
+        requires(is_integral_v<T>)
+    {
+        return __atomic_fetch_and(&value, mask, (int)order);
+    }
+
+    T fetch_or(T mask, MemoryOrder order = MemoryOrder::SeqCst) noexcept
+        requires(is_integral_v<T>)
+    {
+        return __atomic_fetch_or(&value, mask, (int)order);
+    }
+
+    T fetch_xor(T mask, MemoryOrder order = MemoryOrder::SeqCst) noexcept
+        requires(is_integral_v<T>)
+    {
+        return __atomic_fetch_xor(&value, mask, (int)order);
+    }
+
+    // For passing to futex_wait and futex_wake.
+    T *address() noexcept { return &value; }
+
+private:
+    alignas(sizeof(T)) T value;
+};
+
+inline void atomic_thread_fence(MemoryOrder order) noexcept { __atomic_thread_fence((int)order); }
+
+// Tells the CPU that we are in a spin loop.
+inline void cpu_relax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    asm volatile("yield");
+#endif
+}
+
+// For very short critical sections only. Waiting burns CPU.
+class SpinLock final {
+public:
+    SpinLock() noexcept = default;
+    SpinLock(const SpinLock &) = delete;
+    SpinLock &operator=(const SpinLock &) = delete;
+
+    void lock() noexcept {
+        while(locked.exchange(true, MemoryOrder::Acquire)) {
+            // Spin on a plain load so that the cache line stays shared.
+            while(locked.load(MemoryOrder::Relaxed)) {
+                cpu_relax();
+            }
+        }
+    }
+
+    bool try_lock() noexcept {
+        return !locked.load(MemoryOrder::Relaxed) && !locked.exchange(true, MemoryOrder::Acquire);
+    }
+
+    void unlock() noexcept { locked.store(false, MemoryOrder::Release); }
+
+private:
+    Atomic<bool> locked;
+};
+
+// Spins for a while and then sleeps on a futex. Lock and unlock never
+// throw and do no system calls when the lock is not contended.
+class FastMutex final {
+public:
+    FastMutex() noexcept = default;
+    FastMutex(const FastMutex &) = delete;
+    FastMutex &operator=(const FastMutex &) = delete;
+
+    void lock() noexcept {
+        uint32_t expected = UNLOCKED;
+        if(!state.compare_exchange_strong(
+               expected, LOCKED, MemoryOrder::Acquire, MemoryOrder::Relaxed)) {
+            lock_contended();
+        }
+    }
+
+    bool try_lock() noexcept {
+        uint32_t expected = UNLOCKED;
+        return state.compare_exchange_strong(
+            expected, LOCKED, MemoryOrder::Acquire, MemoryOrder::Relaxed);
+    }
+
+    void unlock() noexcept {
+        if(state.exchange(UNLOCKED, MemoryOrder::Release) == LOCKED_WITH_WAITERS) {
+            futex_wake(state.address(), 1);
+        }
+    }
+
+private:
+    static constexpr uint32_t UNLOCKED = 0;
+    static constexpr uint32_t LOCKED = 1;
+    static constexpr uint32_t LOCKED_WITH_WAITERS = 2;
+
+    void lock_contended() noexcept;
+
+    Atomic<uint32_t> state;
+};
+
+template<typename T>
+concept SharedLockable = requires(T a) {
+    a.lock_shared();
+    a.unlock_shared();
+};
+
+template<SharedLockable T> class SharedLockGuard final {
+public:
+    explicit SharedLockGuard(T &m_) : m{m_} { m.lock_shared(); }
+
+    ~SharedLockGuard() { m.unlock_shared(); }
+
+    T &lockable() const { return m; }
+
+    SharedLockGuard(const SharedLockGuard &) = delete;
+    SharedLockGuard &operator=(const SharedLockGuard &) = delete;
+
+private:
+    T &m;
+};
+
+// Reader-writer lock. Any number of readers may hold it at the same
+// time, writers get exclusive access. A waiting writer stops new readers
+// from entering, so a steady stream of readers can not starve writers.
+// The read side fast path is a single compare and swap.
+class SharedMutex final {
+public:
+    SharedMutex() noexcept = default;
+    SharedMutex(const SharedMutex &) = delete;
+    SharedMutex &operator=(const SharedMutex &) = delete;
+
+    void lock() noexcept {
+        uint32_t expected = 0;
+        if(!state.compare_exchange_strong(
+               expected, WRITER, MemoryOrder::Acquire, MemoryOrder::Relaxed)) {
+            lock_contended();
+        }
+    }
+
+    bool try_lock() noexcept;
+
+    void unlock() noexcept {
+        state.fetch_and(~WRITER, MemoryOrder::SeqCst);
+        wake_sleepers();
+    }
+
+    void lock_shared() noexcept {
+        if(!try_lock_shared()) {
+            lock_shared_contended();
+        }
+    }
+
+    bool try_lock_shared() noexcept {
+        uint32_t current = state.load(MemoryOrder::Relaxed);
+        while((current & (WRITER | WRITER_WAITING)) == 0) {
+            if(state.compare_exchange_weak(
+                   current, current + 1, MemoryOrder::Acquire, MemoryOrder::Relaxed)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void unlock_shared() noexcept {
+        const uint32_t previous = state.fetch_sub(1, MemoryOrder::SeqCst);
+        // Only a writer can be waiting for the last reader to leave.
+        if((previous & READER_MASK) == 1 && (previous & WRITER_WAITING) != 0) {
+            wake_sleepers();
+        }
+    }
+
+private:
+    static constexpr uint32_t WRITER = uint32_t(1) << 31;
+    static constexpr uint32_t WRITER_WAITING = uint32_t(1) << 30;
+    static constexpr uint32_t READER_MASK = WRITER_WAITING - 1;
+
+    void lock_contended() noexcept;
+    void lock_shared_contended() noexcept;
+    void sleep_while(uint32_t current) noexcept;
+    void wake_sleepers() noexcept;
+
+    // Reader count in the low bits and the writer flags in the top ones.
+    Atomic<uint32_t> state;
+    Atomic<uint32_t> sleepers;
+};
+
+// Reader-writer lock for data that is read all the time and written
+// almost never. Threads are spread over one reader counter per CPU,
+// each on its own cache line, so readers do not bounce a shared line
+// between cores. The price is paid by writers, who must wait for every
+// counter to drain.
+class BigReaderLock final {
+public:
+    BigReaderLock();
+    BigReaderLock(const BigReaderLock &) = delete;
+    BigReaderLock &operator=(const BigReaderLock &) = delete;
+
+    void lock() noexcept;
+    void unlock() noexcept;
+
+    void lock_shared() noexcept;
+    void unlock_shared() noexcept;
+
+private:
+    struct alignas(CACHE_LINE_SIZE) ReaderSlot {
+        Atomic<uint32_t> readers;
+    };
+
+    ReaderSlot &slot_for_this_thread() noexcept;
+
+    unique_arr<ReaderSlot> slots;
+    FastMutex writer_mutex;
+    Atomic<uint32_t> writer_active;
+};
+
+// Epoch based memory reclamation for data structures whose readers
+// take no locks. A writer unlinks an object from the structure and
+// retires it. It is freed once every reader that might still see it
+// has left its read section.
+//
+// Entering a read section only announces the current epoch in a
+// counter of the reader's own, readers never wait. Writers flip the
+// epoch and wait for the counters of the previous one to drain. This
+// wait is called a grace period.
+class EpochDomain final {
+public:
+    EpochDomain();
+    // There must be no readers left. Frees all retired objects.
+    ~EpochDomain();
+    EpochDomain(const EpochDomain &) = delete;
+    EpochDomain &operator=(const EpochDomain &) = delete;
+
+    // Returns a token that must be passed to the matching exit.
+    // Read sections can nest.
+    uint32_t enter() noexcept {
+        ReaderSlot &slot = slot_for_this_thread();
+        const uint32_t token = epoch.load(MemoryOrder::Relaxed) & 1;
+        // Sequentially consistent so that the writer scanning the
+        // counters sees us before we read anything it has unlinked.
+        slot.readers[token].fetch_add(1, MemoryOrder::SeqCst);
+        return token;
+    }
+
+    void exit(uint32_t token) noexcept {
+        slot_for_this_thread().readers[token].fetch_sub(1, MemoryOrder::Release);
+    }
+
+    // Retired objects are collected in batches. Whoever retires the
+    // last object of a batch waits for a grace period and frees the
+    // batch, so retire must not be called inside a read section.
+    template<typename T> void retire(T *object) {
+        retire(object, [](void *p) { delete static_cast<T *>(p); });
+    }
+
+    void retire(void *object, void (*deleter)(void *));
+
+    // Returns once every read section that was active when it was
+    // called has ended.
+    void synchronize() noexcept;
+
+    // Waits for a grace period and frees all objects retired before
+    // the call.
+    void collect();
+
+    size_t num_retired() const noexcept { return retired_count.load(MemoryOrder::Relaxed); }
+
+private:
+    static constexpr size_t RETIRE_BATCH_SIZE = 64;
+
+    // Threads may share a slot, so it counts readers rather than
+    // storing the epoch of one.
+    struct alignas(CACHE_LINE_SIZE) ReaderSlot {
+        Atomic<uint32_t> readers[2];
+    };
+
+    struct RetiredObject {
+        void *object;
+        void (*deleter)(void *);
+    };
+
+    ReaderSlot &slot_for_this_thread() noexcept;
+    void wait_for_readers(uint32_t parity) noexcept;
+    static void free_objects(Vector<RetiredObject> &objects);
+
+    unique_arr<ReaderSlot> slots;
+    Atomic<uint32_t> epoch;
+    FastMutex synchronize_mutex;
+    FastMutex retired_mutex;
+    Vector<RetiredObject> retired;
+    Atomic<size_t> retired_count;
+};
+
+// Keeps objects retired to the domain alive for its lifetime.
+class EpochReadGuard final {
+public:
+    explicit EpochReadGuard(EpochDomain &domain_) noexcept
+        : domain{domain_}, token{domain_.enter()} {}
+
+    ~EpochReadGuard() { domain.exit(token); }
+
+    EpochReadGuard(const EpochReadGuard &) = delete;
+    EpochReadGuard &operator=(const EpochReadGuard &) = delete;
+
+private:
+    EpochDomain &domain;
+    uint32_t token;
+};
+
+
+// Rounds the requested capacity of a bounded queue up to a power of two.
+inline size_t bounded_queue_capacity(size_t requested) {
+    if(requested > (size_t(1) << 40)) {
+        throw PyException("Queue capacity too large.");
+    }
+    size_t capacity = 2;
+    while(capacity < requested) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+template<typename T> struct QueueSlot {
+    alignas(T) unsigned char storage[sizeof(T)];
+
+    T *object() noexcept { return reinterpret_cast<T *>(storage); }
+};
+
+// Bounded ring buffer for exactly one producer thread and one consumer
+// thread. Neither side ever waits for the other, a full or empty queue
+// just makes the operation fail.
+template<WellBehaved T> class SpscQueue final {
+public:
+    explicit SpscQueue(size_t requested_capacity)
+        : mask{bounded_queue_capacity(requested_capacity) - 1}, slots{mask + 1} {}
+
+    ~SpscQueue() {
+        for(size_t i = head.load(MemoryOrder::Relaxed); i != tail.load(MemoryOrder::Relaxed);
+            ++i) {
+            slot(i)->~T();
+        }
+    }
+
+    SpscQueue(const SpscQueue &) = delete;
+    SpscQueue &operator=(const SpscQueue &) = delete;
+
+    size_t capacity() const noexcept { return mask + 1; }
+
+    // Producer side.
+
+    bool try_push(const T &item) {
+        const size_t t = tail.load(MemoryOrder::Relaxed);
+        if(free_slots(t, 1) == 0) {
+            return false;
+        }
+        new(slot(t)) T(item);
+        tail.store(t + 1, MemoryOrder::Release);
+        return true;
+    }
+
+    bool try_push(T &&item) noexcept {
+        const size_t t = tail.load(MemoryOrder::Relaxed);
+        if(free_slots(t, 1) == 0) {
+            return false;
+        }
+        new(slot(t)) T(::pystd2026::move(item));
+        tail.store(t + 1, MemoryOrder::Release);
+        return true;
+    }
+
+    // Moves as many items from the front of the span as fit and
+    // returns their count.
+    size_t try_push_batch(Span<T> items) noexcept {
+        const size_t t = tail.load(MemoryOrder::Relaxed);
+        size_t count = free_slots(t, items.size());
+        if(count > items.size()) {
+            count = items.size();
+        }
+        for(size_t i = 0; i < count; ++i) {
+            new(slot(t + i)) T(::pystd2026::move(items.data()[i]));
+        }
+        tail.store(t + count, MemoryOrder::Release);
+        return count;
+    }
+
+    // Consumer side.
+
+    Optional<T> try_pop() noexcept {
+        const size_t h = head.load(MemoryOrder::Relaxed);
+        if(available_items(h, 1) == 0) {
+            return Optional<T>();
+        }
+        Optional<T> result(::pystd2026::move(*slot(h)));
+        slot(h)->~T();
+        head.store(h + 1, MemoryOrder::Release);
+        return result;
+    }
+
+    // Moves items into the front of the span and returns their count.
+    size_t try_pop_batch(Span<T> out) noexcept {
+        const size_t h = head.load(MemoryOrder::Relaxed);
+        size_t count = available_items(h, out.size());
+        if(count > out.size()) {
+            count = out.size();
+        }
+        for(size_t i = 0; i < count; ++i) {
+            out.data()[i] = ::pystd2026::move(*slot(h + i));
+            slot(h + i)->~T();
+        }
+        head.store(h + count, MemoryOrder::Release);
+        return count;
+    }
+
+private:
+    T *slot(size_t index) noexcept { return slots.get()[index & mask].object(); }
+
+    // Each side keeps a private copy of the other side's index and only
+    // rereads the shared one when the copy says there is not enough room.
+    size_t free_slots(size_t t, size_t wanted) noexcept {
+        if(capacity() - (t - cached_head) < wanted) {
+            cached_head = head.load(MemoryOrder::Acquire);
+        }
+        return capacity() - (t - cached_head);
+    }
+
+    size_t available_items(size_t h, size_t wanted) noexcept {
+        if(cached_tail - h < wanted) {
+            cached_tail = tail.load(MemoryOrder::Acquire);
+        }
+        return cached_tail - h;
+    }
+
+    const size_t mask;
+    unique_arr<QueueSlot<T>> slots;
+    alignas(CACHE_LINE_SIZE) Atomic<size_t> head;
+    size_t cached_tail = 0;
+    alignas(CACHE_LINE_SIZE) Atomic<size_t> tail;
+    size_t cached_head = 0;
+};
+
+// Bounded queue for any number of producers and consumers, after
+// Dmitry Vyukov's design. Every cell has a sequence number that tells
+// which lap of the ring may next write or read it, so producers and
+// consumers only contend on their own index.
+template<WellBehaved T> class MpmcQueue final {
+public:
+    explicit MpmcQueue(size_t requested_capacity)
+        : mask{bounded_queue_capacity(requested_capacity) - 1}, cells{mask + 1} {
+        for(size_t i = 0; i <= mask; ++i) {
+            cells[i].sequence.store(i, MemoryOrder::Relaxed);
+        }
+    }
+
+    ~MpmcQueue() {
+        while(try_pop()) {
+        }
+    }
+
+    MpmcQueue(const MpmcQueue &) = delete;
+    MpmcQueue &operator=(const MpmcQueue &) = delete;
+
+    size_t capacity() const noexcept { return mask + 1; }
+
+    bool try_push(const T &item) {
+        T copy(item);
+        return try_push(::pystd2026::move(copy));
+    }
+
+    bool try_push(T &&item) noexcept {
+        size_t pos;
+        if(claim(enqueue_pos, 0, 1, pos) == 0) {
+            return false;
+        }
+        Cell &c = cell(pos);
+        new(c.slot.object()) T(::pystd2026::move(item));
+        c.sequence.store(pos + 1, MemoryOrder::Release);
+        return true;
+    }
+
+    // Claims a run of consecutive cells with a single compare and swap.
+    // Moves as many items from the front of the span as fit and returns
+    // their count.
+    size_t try_push_batch(Span<T> items) noexcept {
+        size_t pos;
+        const size_t count = claim(enqueue_pos, 0, items.size(), pos);
+        for(size_t i = 0; i < count; ++i) {
+            Cell &c = cell(pos + i);
+            new(c.slot.object()) T(::pystd2026::move(items.data()[i]));
+            c.sequence.store(pos + i + 1, MemoryOrder::Release);
+        }
+        return count;
+    }
+
+    Optional<T> try_pop() noexcept {
+        size_t pos;
+        if(claim(dequeue_pos, 1, 1, pos) == 0) {
+            return Optional<T>();
+        }
+        Cell &c = cell(pos);
+        Optional<T> result(::pystd2026::move(*c.slot.object()));
+        c.slot.object()->~T();
+        c.sequence.store(pos + mask + 1, MemoryOrder::Release);
+        return result;
+    }
+
+    // Moves items into the front of the span and returns their count.
+    size_t try_pop_batch(Span<T> out) noexcept {
+        size_t pos;
+        const size_t count = claim(dequeue_pos, 1, out.size(), pos);
+        for(size_t i = 0; i < count; ++i) {
+            Cell &c = cell(pos + i);
+            out.data()[i] = ::pystd2026::move(*c.slot.object());
+            c.slot.object()->~T();
+            c.sequence.store(pos + i + mask + 1, MemoryOrder::Release);
+        }
+        return count;
+    }
+
+private:
+    struct Cell {
+        Atomic<size_t> sequence;
+        QueueSlot<T> slot;
+    };
+
+    Cell &cell(size_t pos) noexcept { return cells.unsafe_at(pos & mask); }
+
+    // A cell at position pos is ready for us when its sequence number is
+    // pos + lag. Claims up to max_count ready cells starting from the
+    // index and returns how many were claimed, zero if the first one is
+    // not ready because the queue is full or empty.
+    size_t claim(Atomic<size_t> &index, size_t lag, size_t max_count, size_t &pos) noexcept {
+        if(max_count == 0) {
+            return 0;
+        }
+        pos = index.load(MemoryOrder::Relaxed);
+        while(true) {
+            const auto first_diff =
+                (intptr_t)cell(pos).sequence.load(MemoryOrder::Acquire) - (intptr_t)(pos + lag);
+            if(first_diff < 0) {
+                return 0;
+            }
+            if(first_diff > 0) {
+                // Someone else claimed this cell, catch up.
+                pos = index.load(MemoryOrder::Relaxed);
+                continue;
+            }
+            size_t count = 1;
+            while(count < max_count &&
+                  cell(pos + count).sequence.load(MemoryOrder::Acquire) == pos + count + lag) {
+                ++count;
+            }
+            if(index.compare_exchange_weak(
+                   pos, pos + count, MemoryOrder::Relaxed, MemoryOrder::Relaxed)) {
+                return count;
+            }
+        }
+    }
+
+    const size_t mask;
+    unique_arr<Cell> cells;
+    alignas(CACHE_LINE_SIZE) Atomic<size_t> enqueue_pos;
+    alignas(CACHE_LINE_SIZE) Atomic<size_t> dequeue_pos;
+};
+
+// Waiting releases the lock held by the guard and takes it again
+// before returning. Waits can wake up spuriously, the predicate
+// versions loop until the predicate holds. Notifying without
+// waiters does not enter the kernel.
+class ConditionVariable final {
+public:
+    ConditionVariable() noexcept = default;
+    ConditionVariable(const ConditionVariable &) = delete;
+    ConditionVariable &operator=(const ConditionVariable &) = delete;
+
+    template<Lockable T> void wait(LockGuard<T> &guard) {
+        T &m = guard.lockable();
+        const uint32_t observed = __atomic_load_n(&sequence, __ATOMIC_SEQ_CST);
+        __atomic_add_fetch(&waiters, 1, __ATOMIC_SEQ_CST);
+        m.unlock();
+        futex_wait(&sequence, observed);
+        __atomic_sub_fetch(&waiters, 1, __ATOMIC_SEQ_CST);
+        m.lock();
+    }
+
+    template<Lockable T, typename Predicate>
+    void wait(LockGuard<T> &guard, const Predicate &condition) {
+        while(!condition()) {
+            wait(guard);
+        }
+    }
+
+    void notify_one();
+    void notify_all();
+
+private:
+    uint32_t sequence = 0;
+    uint32_t waiters = 0;
+};
+
+class Semaphore final {
+public:
+    explicit Semaphore(uint32_t initial_count = 0) noexcept : count{initial_count} {}
+    Semaphore(const Semaphore &) = delete;
+    Semaphore &operator=(const Semaphore &) = delete;
+
+    void acquire();
+    bool try_acquire();
+    void release(uint32_t amount = 1);
+
+private:
+    uint32_t count;
+    uint32_t waiters = 0;
+};
+
+// A single use countdown. Waiting returns once the count reaches zero.
+class Latch final {
+public:
+    explicit Latch(uint32_t expected) noexcept : count{expected} {}
+    Latch(const Latch &) = delete;
+    Latch &operator=(const Latch &) = delete;
+
+    void count_down(uint32_t amount = 1);
+    bool try_wait() const { return __atomic_load_n(&count, __ATOMIC_ACQUIRE) == 0; }
+    void wait();
+    void arrive_and_wait(uint32_t amount = 1) {
+        count_down(amount);
+        wait();
+    }
+
+private:
+    uint32_t count;
+};
+
+// A reusable rendezvous for a fixed number of threads.
+class Barrier final {
+public:
+    explicit Barrier(uint32_t num_threads);
+    Barrier(const Barrier &) = delete;
+    Barrier &operator=(const Barrier &) = delete;
+
+    void arrive_and_wait();
+
+private:
+    const uint32_t num_threads;
+    uint32_t remaining;
+    uint32_t generation = 0;
+};
+
+struct ThreadOptions {
+    // CPUs the thread may run on, empty means no restriction.
+    Vector<int> cpu_affinity;
+    // Zero means the system default.
+    size_t stack_size = 0;
+    // At most 15 bytes, empty means the name is inherited.
+    CString name;
+};
+
+// The CPUs of a NUMA node, for use as a thread's affinity.
+Vector<int> numa_node_cpus(int node);
+
 class Thread final {
 public:
     Thread(void *(*thread_main_func)(void *), void *ctx);
+    Thread(void *(*thread_main_func)(void *), void *ctx, const ThreadOptions &options);
+
+    // The callable is moved to the heap and freed by the new thread
+    // when it finishes. It must not throw.
+    template<typename F>
+    explicit Thread(F fn, const ThreadOptions &options = ThreadOptions{}) {
+        auto *closure = new ThreadClosure<F>{::pystd2026::move(fn)};
+        try {
+            start(ThreadClosure<F>::run, closure, options);
+        } catch(...) {
+            delete closure;
+            throw;
+        }
+    }
+
     ~Thread();
 
     Thread(const Thread &) = delete;
@@ -54,7 +800,503 @@ public:
     void detach();
 
 private:
+    template<typename F> struct ThreadClosure {
+        F fn;
+
+        static void *run(void *ctx) {
+            unique_ptr<ThreadClosure> self(static_cast<ThreadClosure *>(ctx));
+            try {
+                self->fn();
+            } catch(...) {
+                internal_failure("Thread function threw an exception.");
+            }
+            return nullptr;
+        }
+    };
+
+    void start(void *(*thread_main_func)(void *), void *ctx, const ThreadOptions &options);
+
     pthread_t thread;
     bool thread_is_finalized = false;
 };
+
+// A type erased callable for ThreadPool. Small trivially copyable
+// callables, such as lambdas that capture references and scalars,
+// are stored inline. Other callables are moved to the heap.
+class PoolTask final {
+public:
+    static constexpr size_t INLINE_SIZE = 7 * sizeof(void *);
+
+    PoolTask() noexcept = default;
+
+    template<typename F> static PoolTask create(F &&f) {
+        using Callable = remove_cv_t<remove_reference_t<F>>;
+        PoolTask task;
+        if constexpr(sizeof(Callable) <= INLINE_SIZE && alignof(Callable) <= alignof(void *) &&
+                     is_trivially_copyable_v<Callable>) {
+            new(task.storage) Callable(::pystd2026::forward<F>(f));
+            task.invoker = [](void *storage) { (*static_cast<Callable *>(storage))(); };
+        } else {
+            Callable *heap_callable = new Callable(::pystd2026::forward<F>(f));
+            memcpy(task.storage, &heap_callable, sizeof(heap_callable));
+            task.invoker = [](void *storage) {
+                Callable *c;
+                memcpy(&c, storage, sizeof(c));
+                unique_ptr<Callable> owner(c);
+                (*c)();
+            };
+        }
+        return task;
+    }
+
+    // Every task must be run exactly once.
+    void run() { invoker(storage); }
+
+    bool is_empty() const { return invoker == nullptr; }
+
+private:
+    void (*invoker)(void *) = nullptr;
+    alignas(void *) unsigned char storage[INLINE_SIZE];
+};
+
+struct ThreadPoolState;
+
+// Each worker has a deque of its own. Tasks submitted from a worker
+// go to its deque and are run newest first, idle workers steal the
+// oldest tasks from the others. Tasks submitted from other threads
+// go to a shared queue. Tasks must not throw.
+class ThreadPool final {
+public:
+    // Zero means one worker per online CPU.
+    explicit ThreadPool(size_t num_workers = 0);
+    // Waits for all tasks to finish.
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    template<typename F> void submit(F &&f) {
+        submit_task(PoolTask::create(::pystd2026::forward<F>(f)));
+    }
+
+    void submit_task(const PoolTask &task);
+
+    // Blocks until all submitted tasks, including the ones they
+    // submit in turn, have finished. The calling thread runs tasks
+    // while it waits.
+    void wait_idle();
+
+    // Runs one pending task on the calling thread. Returns false if
+    // none was available.
+    bool run_pending_task();
+
+    size_t num_workers() const;
+
+    // Runs pending tasks on the calling thread until the latch is
+    // released. When none are left the rest of the work is running
+    // elsewhere, so it sleeps on the latch instead of spinning.
+    void wait_for(Latch &latch);
+
+private:
+    unique_ptr<ThreadPoolState> state;
+};
+
+// A pool with one worker per CPU, created on first use.
+ThreadPool &default_thread_pool();
+
+// The split into chunks depends only on the number of items, so
+// results do not depend on the number of workers or on timing.
+constexpr size_t PARALLEL_MIN_CHUNK_ITEMS = 1024;
+constexpr size_t PARALLEL_MAX_CHUNKS = 1024;
+
+constexpr size_t parallel_chunk_count(size_t num_items) {
+    const size_t count = (num_items + PARALLEL_MIN_CHUNK_ITEMS - 1) / PARALLEL_MIN_CHUNK_ITEMS;
+    return count < PARALLEL_MAX_CHUNKS ? count : PARALLEL_MAX_CHUNKS;
+}
+
+// Calls body(first, last, chunk_index) for every chunk of the items
+// in [0, num_items) and returns when all of them have finished.
+template<typename Body> class ParallelChunks final {
+public:
+    ParallelChunks(ThreadPool &pool_, size_t num_items_, const Body &body_)
+        : pool{pool_}, body{body_}, num_items{num_items_},
+          num_chunks{parallel_chunk_count(num_items_)}, remaining((uint32_t)num_chunks) {}
+
+    void run() {
+        if(num_chunks == 0) {
+            return;
+        }
+        if(num_chunks == 1) {
+            body(0, num_items, 0);
+            return;
+        }
+        pool.submit([this] { run_chunks(0, num_chunks); });
+        pool.wait_for(remaining);
+    }
+
+private:
+    size_t chunk_start(size_t chunk) const {
+        const size_t base = num_items / num_chunks;
+        const size_t extra = num_items % num_chunks;
+        return chunk * base + (chunk < extra ? chunk : extra);
+    }
+
+    // Splits in halves so that idle workers steal big pieces.
+    void run_chunks(size_t first, size_t last) {
+        while(last - first > 1) {
+            const size_t middle = first + (last - first) / 2;
+            pool.submit([this, middle, last] { run_chunks(middle, last); });
+            last = middle;
+        }
+        body(chunk_start(first), chunk_start(first + 1), first);
+        remaining.count_down();
+    }
+
+    ThreadPool &pool;
+    const Body &body;
+    size_t num_items;
+    size_t num_chunks;
+    Latch remaining;
+};
+
+template<typename T, typename F> void parallel_for(ThreadPool &pool, Span<T> items, const F &fn) {
+    T *data = items.data();
+    auto body = [data, &fn](size_t first, size_t last, size_t) {
+        for(size_t i = first; i < last; ++i) {
+            fn(data[i]);
+        }
+    };
+    ParallelChunks<decltype(body)>(pool, items.size(), body).run();
+}
+
+template<typename F> void parallel_for(ThreadPool &pool, const Range &range, const F &fn) {
+    auto body = [&range, &fn](size_t first, size_t last, size_t) {
+        for(size_t i = first; i < last; ++i) {
+            fn(range[i]);
+        }
+    };
+    ParallelChunks<decltype(body)>(pool, range.size(), body).run();
+}
+
+// Returns combine(...combine(combine(init, p0), p1)..., pn) where the
+// partial results p are folds of map over consecutive chunks. The
+// order of combine calls is always the same for the same number of
+// items, so floating point results are reproducible.
+template<typename T, typename R, typename Map, typename Combine>
+R parallel_reduce(
+    ThreadPool &pool, Span<T> items, R init, const Map &map, const Combine &combine) {
+    T *data = items.data();
+    Vector<R> partials;
+    const size_t num_chunks = parallel_chunk_count(items.size());
+    for(size_t i = 0; i < num_chunks; ++i) {
+        partials.push_back(init);
+    }
+    auto body = [data, &partials, &map, &combine](size_t first, size_t last, size_t chunk) {
+        R accumulated = map(data[first]);
+        for(size_t i = first + 1; i < last; ++i) {
+            accumulated = combine(::pystd2026::move(accumulated), map(data[i]));
+        }
+        partials[chunk] = ::pystd2026::move(accumulated);
+    };
+    ParallelChunks<decltype(body)>(pool, items.size(), body).run();
+    R result = ::pystd2026::move(init);
+    for(auto &partial : partials) {
+        result = combine(::pystd2026::move(result), ::pystd2026::move(partial));
+    }
+    return result;
+}
+
+template<typename T, typename F> void parallel_for(Span<T> items, const F &fn) {
+    parallel_for(default_thread_pool(), items, fn);
+}
+
+template<typename F> void parallel_for(const Range &range, const F &fn) {
+    parallel_for(default_thread_pool(), range, fn);
+}
+
+template<typename T, typename R, typename Map, typename Combine>
+R parallel_reduce(Span<T> items, R init, const Map &map, const Combine &combine) {
+    return parallel_reduce(default_thread_pool(), items, ::pystd2026::move(init), map, combine);
+}
+
+// Loads the files concurrently and returns their contents in the same
+// order as the paths. A file that can not be read gives an empty
+// optional. Workers take the next unread path as they go, so a few
+// slow files do not hold up the rest.
+Vector<Optional<Bytes>> load_many(ThreadPool &pool, Span<Path> paths);
+
+// Uses a pool of its own. Loading is bound by I/O latency rather than
+// CPU, so on a cold cache more threads than CPUs can help. Zero means
+// one thread per CPU.
+Vector<Optional<Bytes>> load_many(Span<Path> paths, size_t num_threads = 0);
+
+template<WellBehaved T> class Future;
+
+// Shared between a Promise and its Future. The result is written once
+// and a single continuation can be attached to run when it arrives.
+template<WellBehaved T> struct FutureState final {
+    Mutex mutex;
+    uint32_t ready = 0;
+    int32_t references = 1;
+    PoolTask continuation;
+    Expected<T, PyException> result;
+
+    void add_reference() { __atomic_add_fetch(&references, 1, __ATOMIC_RELAXED); }
+
+    void release() {
+        if(__atomic_sub_fetch(&references, 1, __ATOMIC_ACQ_REL) == 0) {
+            delete this;
+        }
+    }
+
+    bool is_ready() const { return __atomic_load_n(&ready, __ATOMIC_ACQUIRE) != 0; }
+
+    void wait() {
+        while(!is_ready()) {
+            futex_wait(&ready, 0);
+        }
+    }
+
+    void complete(Expected<T, PyException> &&r) {
+        PoolTask next;
+        {
+            LockGuard<Mutex> lg(mutex);
+            if(ready) {
+                throw PyException("Promise already has a result.");
+            }
+            result = ::pystd2026::move(r);
+            __atomic_store_n(&ready, 1, __ATOMIC_RELEASE);
+            next = continuation;
+        }
+        futex_wake_all(&ready);
+        if(!next.is_empty()) {
+            next.run();
+        }
+    }
+
+    // The task runs on the thread that provides the result, or
+    // immediately if it is already there.
+    void on_ready(const PoolTask &task) {
+        {
+            LockGuard<Mutex> lg(mutex);
+            if(!ready) {
+                continuation = task;
+                return;
+            }
+        }
+        PoolTask now = task;
+        now.run();
+    }
+};
+
+// The producing side of a Future. A promise that is destroyed
+// without a result sets an error instead.
+template<WellBehaved T> class Promise final {
+public:
+    Promise() : state{new FutureState<T>} {}
+    Promise(Promise &&o) noexcept : state{o.state} { o.state = nullptr; }
+    ~Promise() {
+        if(state) {
+            if(!state->is_ready()) {
+                state->complete(PyException("Promise destroyed without a result."));
+            }
+            state->release();
+        }
+    }
+
+    Promise(const Promise &) = delete;
+    Promise &operator=(const Promise &) = delete;
+
+    // Can only be called once.
+    Future<T> get_future();
+
+    void set_value(T value) { state->complete(::pystd2026::move(value)); }
+    void set_error(PyException error) { state->complete(::pystd2026::move(error)); }
+
+private:
+    FutureState<T> *state;
+    bool future_taken = false;
+};
+
+// A result that becomes available later. Errors are delivered as
+// values, exceptions never cross threads. Futures are move only and
+// get, then and when_all consume them.
+template<WellBehaved T> class Future final {
+public:
+    Future() noexcept = default;
+    Future(Future &&o) noexcept : state{o.state} { o.state = nullptr; }
+    ~Future() {
+        if(state) {
+            state->release();
+        }
+    }
+
+    Future(const Future &) = delete;
+    Future &operator=(const Future &) = delete;
+
+    Future &operator=(Future &&o) noexcept {
+        if(this != &o) {
+            if(state) {
+                state->release();
+            }
+            state = o.state;
+            o.state = nullptr;
+        }
+        return *this;
+    }
+
+    bool is_valid() const { return state != nullptr; }
+
+    bool is_ready() const { return checked_state()->is_ready(); }
+
+    void wait() const { checked_state()->wait(); }
+
+    // Waits by running tasks from the pool, so that a pool task can
+    // wait for the result of another without a deadlock.
+    void wait(ThreadPool &pool) const {
+        auto *s = checked_state();
+        while(!s->is_ready()) {
+            if(!pool.run_pending_task()) {
+                s->wait();
+            }
+        }
+    }
+
+    Expected<T, PyException> get() {
+        wait();
+        return take_result();
+    }
+
+    Expected<T, PyException> get(ThreadPool &pool) {
+        wait(pool);
+        return take_result();
+    }
+
+    // Runs fn with the value in the pool once it is available. An
+    // error is passed on without calling fn.
+    template<typename F> auto then(ThreadPool &pool, F fn) {
+        using U = decltype(fn(::pystd2026::declval<T>()));
+        Promise<U> next;
+        Future<U> next_future = next.get_future();
+        FutureState<T> *s = take_state();
+        s->on_ready(PoolTask::create(
+            [s, &pool, next = ::pystd2026::move(next), fn = ::pystd2026::move(fn)]() mutable {
+                pool.submit([s, next = ::pystd2026::move(next), fn = ::pystd2026::move(fn)]() mutable {
+                    if(s->result.has_value()) {
+                        try {
+                            next.set_value(fn(::pystd2026::move(s->result.value())));
+                        } catch(const PyException &e) {
+                            next.set_error(e);
+                        }
+                    } else {
+                        next.set_error(::pystd2026::move(s->result.error()));
+                    }
+                    s->release();
+                });
+            }));
+        return next_future;
+    }
+
+private:
+    friend class Promise<T>;
+    template<WellBehaved U> friend Future<Vector<U>> when_all(Vector<Future<U>> futures);
+
+    explicit Future(FutureState<T> *s) noexcept : state{s} {}
+
+    FutureState<T> *checked_state() const {
+        if(!state) {
+            throw PyException("Future has no state.");
+        }
+        return state;
+    }
+
+    FutureState<T> *take_state() {
+        auto *s = checked_state();
+        state = nullptr;
+        return s;
+    }
+
+    Expected<T, PyException> take_result() {
+        auto *s = take_state();
+        Expected<T, PyException> r = ::pystd2026::move(s->result);
+        s->release();
+        return r;
+    }
+
+    FutureState<T> *state = nullptr;
+};
+
+template<WellBehaved T> Future<T> Promise<T>::get_future() {
+    if(future_taken) {
+        throw PyException("Future already taken from promise.");
+    }
+    future_taken = true;
+    state->add_reference();
+    return Future<T>(state);
+}
+
+// Runs fn in the pool. A PyException thrown by fn becomes the error
+// of the returned future.
+template<typename F> auto async(ThreadPool &pool, F fn) {
+    using T = decltype(fn());
+    Promise<T> promise;
+    Future<T> future = promise.get_future();
+    pool.submit([promise = ::pystd2026::move(promise), fn = ::pystd2026::move(fn)]() mutable {
+        try {
+            promise.set_value(fn());
+        } catch(const PyException &e) {
+            promise.set_error(e);
+        }
+    });
+    return future;
+}
+
+// Completes when all inputs have. The values are in input order. If
+// any input fails, the error of the first failed one is returned.
+template<WellBehaved T> Future<Vector<T>> when_all(Vector<Future<T>> futures) {
+    struct Gathered {
+        Promise<Vector<T>> promise;
+        Vector<T> values;
+        Vector<Optional<PyException>> errors;
+        int64_t remaining;
+    };
+    auto *gathered = new Gathered;
+    Future<Vector<T>> result = gathered->promise.get_future();
+    gathered->remaining = (int64_t)futures.size() + 1;
+    for(size_t i = 0; i < futures.size(); ++i) {
+        gathered->values.push_back(T{});
+        gathered->errors.push_back(Optional<PyException>{});
+    }
+    // Completes the result when the last input has arrived. The
+    // extra count keeps that from happening during registration.
+    auto finish_one = [](Gathered *g) {
+        if(__atomic_sub_fetch(&g->remaining, 1, __ATOMIC_ACQ_REL) != 0) {
+            return;
+        }
+        for(auto &e : g->errors) {
+            if(e) {
+                g->promise.set_error(::pystd2026::move(e.value()));
+                delete g;
+                return;
+            }
+        }
+        g->promise.set_value(::pystd2026::move(g->values));
+        delete g;
+    };
+    for(size_t i = 0; i < futures.size(); ++i) {
+        FutureState<T> *s = futures[i].take_state();
+        s->on_ready(PoolTask::create([s, gathered, i, finish_one] {
+            if(s->result.has_value()) {
+                gathered->values[i] = ::pystd2026::move(s->result.value());
+            } else {
+                gathered->errors[i] = ::pystd2026::move(s->result.error());
+            }
+            s->release();
+            finish_one(gathered);
+        }));
+    }
+    finish_one(gathered);
+    return result;
+}
+
 } // namespace pystd2026
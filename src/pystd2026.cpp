@@ -14,6 +14,11 @@
 #include <windows.h>
 #else
 #include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
 #endif
 
 namespace pystd2026 {
@@ -22,9 +27,7 @@ void bootstrap_throw(const char *msg) { throw PyException(msg); }
 
 namespace {
 
-bool is_ascii_whitespace(uint32_t c) {
-    return c == ' ' || c == '\n' || c == '\n' || c == '\t' || c == '\r';
-}
+bool is_ascii_whitespace(uint32_t c) { return IsAsciiWhitespace::ascii_bitmap.contains(c); }
 
 struct UtfDecodeStep {
     uint32_t byte1_data_mask;
@@ -113,6 +116,86 @@ uint32_t unpack_one(const unsigned char *valid_utf8, const UtfDecodeStep &par) {
     return unpacked;
 }
 
+const char *reverse_find_byte(const char *buf, size_t bufsize, char c) {
+    if(bufsize == 0) {
+        return nullptr;
+    }
+#if defined(__GLIBC__)
+    return (const char *)memrchr(buf, c, bufsize);
+#else
+    for(size_t i = bufsize; i > 0; --i) {
+        if(buf[i - 1] == c) {
+            return buf + i - 1;
+        }
+    }
+    return nullptr;
+#endif
+}
+
+// The libc implementations of memchr, memrchr and memmem are
+// vectorized (and memmem uses the Two-Way algorithm on glibc),
+// so use them rather than rolling our own.
+const char *find_bytes(const char *haystack,
+                       size_t haystack_size,
+                       const char *needle,
+                       size_t needle_size) {
+    if(needle_size == 0) {
+        return haystack;
+    }
+    if(needle_size > haystack_size) {
+        return nullptr;
+    }
+#if defined(__GLIBC__)
+    return (const char *)memmem(haystack, haystack_size, needle, needle_size);
+#else
+    const char *const last_start = haystack + haystack_size - needle_size;
+    const char *i = haystack;
+    while(i <= last_start) {
+        auto *candidate = (const char *)memchr(i, needle[0], last_start - i + 1);
+        if(!candidate) {
+            return nullptr;
+        }
+        if(memcmp(candidate, needle, needle_size) == 0) {
+            return candidate;
+        }
+        i = candidate + 1;
+    }
+    return nullptr;
+#endif
+}
+
+const char *reverse_find_bytes(const char *haystack,
+                               size_t haystack_size,
+                               const char *needle,
+                               size_t needle_size) {
+    if(needle_size == 0) {
+        return haystack + haystack_size;
+    }
+    if(needle_size > haystack_size) {
+        return nullptr;
+    }
+    // Scan for the last byte of the needle and only compare the
+    // rest if the first byte matches as well.
+    const char first = needle[0];
+    const char last = needle[needle_size - 1];
+    size_t search_end = haystack_size;
+    while(true) {
+        auto *candidate = reverse_find_byte(
+            haystack + needle_size - 1, search_end - (needle_size - 1), last);
+        if(!candidate) {
+            return nullptr;
+        }
+        auto *match_start = candidate - (needle_size - 1);
+        if(*match_start == first && memcmp(match_start, needle, needle_size) == 0) {
+            return match_start;
+        }
+        search_end = candidate - haystack;
+        if(search_end < needle_size) {
+            return nullptr;
+        }
+    }
+}
+
 ValidU8Iterator::CharInfo extract_one_codepoint(const unsigned char *buf) {
     UtfDecodeStep par;
     // clang-format off
@@ -141,6 +224,300 @@ ValidU8Iterator::CharInfo extract_one_codepoint(const unsigned char *buf) {
     return ValidU8Iterator::CharInfo{unpack_one(buf, par), 1 + par.num_subsequent_bytes};
 }
 
+size_t encode_codepoint(uint32_t codepoint, unsigned char *buf) {
+    if(codepoint < 0x80) {
+        buf[0] = codepoint;
+        return 1;
+    } else if(codepoint < 0x800) {
+        buf[0] = 0xC0 | (codepoint >> 6 & 0x1F);
+        buf[1] = 0x80 | (codepoint & 0x3F);
+        return 2;
+    } else if(codepoint < 0x10000) {
+        buf[0] = 0xE0 | (codepoint >> 12 & 0x0F);
+        buf[1] = 0x80 | (codepoint >> 6 & 0x3F);
+        buf[2] = 0x80 | (codepoint & 0x3F);
+        return 3;
+    } else if(codepoint < 0x110000) {
+        buf[0] = 0xF0 | (codepoint >> 18 & 0x07);
+        buf[1] = 0x80 | (codepoint >> 12 & 0x3F);
+        buf[2] = 0x80 | (codepoint >> 6 & 0x3F);
+        buf[3] = 0x80 | (codepoint & 0x3F);
+        return 4;
+    }
+    throw PyException("Unicode codepoint > 0x110000.");
+}
+
+// Bit i of the result is set if buf[i] is ASCII whitespace.
+uint64_t whitespace_mask_partial(const char *buf, size_t bufsize) {
+    uint64_t mask = 0;
+    for(size_t i = 0; i < bufsize; ++i) {
+        if(is_ascii_whitespace(buf[i])) {
+            mask |= uint64_t(1) << i;
+        }
+    }
+    return mask;
+}
+
+const size_t WHITESPACE_BLOCK_SIZE = 64;
+
+// Sets the high bit of every byte that equals c.
+uint64_t swar_equal_bytes(uint64_t word, uint8_t c) {
+    const uint64_t low_bits = 0x7F7F7F7F7F7F7F7F;
+    const uint64_t x = word ^ (0x0101010101010101 * c);
+    return ~(((x & low_bits) + low_bits) | x | low_bits);
+}
+
+// Classifies WHITESPACE_BLOCK_SIZE bytes, eight at a time.
+uint64_t whitespace_mask_block(const char *buf) {
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    uint64_t mask = 0;
+    for(size_t i = 0; i < WHITESPACE_BLOCK_SIZE / sizeof(uint64_t); ++i) {
+        uint64_t word;
+        memcpy(&word, buf + i * sizeof(uint64_t), sizeof(uint64_t));
+        // The same characters as in IsAsciiWhitespace.
+        const uint64_t matches = swar_equal_bytes(word, ' ') | swar_equal_bytes(word, '\n') |
+                                 swar_equal_bytes(word, '\t') | swar_equal_bytes(word, '\r');
+        // Gathers the high bit of every byte into the topmost byte.
+        const uint64_t gathered = ((matches >> 7) * 0x0102040810204080) >> 56;
+        mask |= gathered << (i * sizeof(uint64_t));
+    }
+    return mask;
+#else
+    return whitespace_mask_partial(buf, WHITESPACE_BLOCK_SIZE);
+#endif
+}
+
+const size_t CODEPOINT_INDEX_INTERVAL = 128;
+
+const uint64_t HIGH_BITS = 0x8080808080808080;
+
+// Continuation bytes have the form 10xxxxxx.
+size_t count_continuation_bytes(uint64_t word) {
+    return __builtin_popcountll(word & ~(word << 1) & HIGH_BITS);
+}
+
+size_t count_codepoints(const unsigned char *buf, size_t bufsize) {
+    size_t continuation_bytes = 0;
+    size_t i = 0;
+    for(; i + sizeof(uint64_t) <= bufsize; i += sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, buf + i, sizeof(uint64_t));
+        continuation_bytes += count_continuation_bytes(word);
+    }
+    for(; i < bufsize; ++i) {
+        if((buf[i] & 0xC0) == 0x80) {
+            ++continuation_bytes;
+        }
+    }
+    return bufsize - continuation_bytes;
+}
+
+// The buffer must be valid UTF-8 and have a terminator
+// that is not a continuation byte.
+size_t skip_codepoints(const unsigned char *buf, size_t offset, size_t num_codepoints) {
+    for(size_t i = 0; i < num_codepoints; ++i) {
+        ++offset;
+        while((buf[offset] & 0xC0) == 0x80) {
+            ++offset;
+        }
+    }
+    return offset;
+}
+
+typedef UnicodeConversionResult (*CaseConverter)(uint32_t codepoint);
+
+// Describes one direction of case conversion: the ASCII
+// range that gets flipped and the full Unicode fallback.
+struct CaseConversion {
+    char ascii_first;
+    char ascii_last;
+    CaseConverter converter;
+};
+
+const CaseConversion to_upper{'a', 'z', uppercase_unicode};
+const CaseConversion to_lower{'A', 'Z', lowercase_unicode};
+
+const uint64_t SWAR_HIGH_BITS = 0x8080808080808080;
+const size_t ASCII_BLOCK_SIZE = 16;
+
+constexpr uint64_t repeat_byte(uint8_t b) { return 0x0101010101010101 * b; }
+
+// Flips the case of all bytes within [first, last] in eight bytes
+// at a time. No byte may have its high bit set.
+uint64_t swar_flip_case(uint64_t word, char first, char last) {
+    const uint64_t at_least_first = word + repeat_byte(0x80 - first);
+    const uint64_t past_last = word + repeat_byte(0x80 - last - 1);
+    const uint64_t in_range = at_least_first & ~past_last & SWAR_HIGH_BITS;
+    // 0x80 >> 2 == 0x20, the case bit.
+    return word ^ (in_range >> 2);
+}
+
+// Converts a block of ASCII_BLOCK_SIZE bytes if all of them are ASCII.
+// Source and destination may be the same.
+bool convert_ascii_block(const char *src, char *dst, const CaseConversion &conv) {
+    uint64_t words[ASCII_BLOCK_SIZE / sizeof(uint64_t)];
+    memcpy(words, src, ASCII_BLOCK_SIZE);
+    if(((words[0] | words[1]) & SWAR_HIGH_BITS) != 0) {
+        return false;
+    }
+    words[0] = swar_flip_case(words[0], conv.ascii_first, conv.ascii_last);
+    words[1] = swar_flip_case(words[1], conv.ascii_first, conv.ascii_last);
+    memcpy(dst, words, ASCII_BLOCK_SIZE);
+    return true;
+}
+
+char convert_ascii_char(char c, const CaseConversion &conv) {
+    if(c >= conv.ascii_first && c <= conv.ascii_last) {
+        return c ^ 0x20;
+    }
+    return c;
+}
+
+void convert_case(const char *src, size_t src_size, const CaseConversion &conv, Bytes &out) {
+    size_t i = 0;
+    while(i < src_size) {
+        if(src_size - i >= ASCII_BLOCK_SIZE) {
+            const auto out_offset = out.size();
+            out.extend(ASCII_BLOCK_SIZE);
+            if(convert_ascii_block(src + i, out.data() + out_offset, conv)) {
+                i += ASCII_BLOCK_SIZE;
+                continue;
+            }
+            out.shrink(ASCII_BLOCK_SIZE);
+        }
+        if((unsigned char)src[i] < 0x80) {
+            out.append(convert_ascii_char(src[i], conv));
+            ++i;
+            continue;
+        }
+        const auto info = extract_one_codepoint((const unsigned char *)src + i);
+        const auto converted = conv.converter(info.codepoint);
+        for(size_t j = 0; j < 3; ++j) {
+            if(converted.codepoints[j] != 0) {
+                unsigned char encoded[4];
+                const auto encoded_size = encode_codepoint(converted.codepoints[j], encoded);
+                out.append((const char *)encoded, (const char *)encoded + encoded_size);
+            }
+        }
+        i += info.byte_count;
+    }
+}
+
+// Returns the number of bytes converted. If it is less than
+// buf_size, the next codepoint's conversion has a different
+// byte length and the rest must be converted out of place.
+size_t convert_case_inplace(char *buf, size_t buf_size, const CaseConversion &conv) {
+    size_t i = 0;
+    while(i < buf_size) {
+        if(buf_size - i >= ASCII_BLOCK_SIZE && convert_ascii_block(buf + i, buf + i, conv)) {
+            i += ASCII_BLOCK_SIZE;
+            continue;
+        }
+        if((unsigned char)buf[i] < 0x80) {
+            buf[i] = convert_ascii_char(buf[i], conv);
+            ++i;
+            continue;
+        }
+        const auto info = extract_one_codepoint((const unsigned char *)buf + i);
+        const auto converted = conv.converter(info.codepoint);
+        if(converted.codepoints[1] != 0) {
+            return i;
+        }
+        unsigned char encoded[4];
+        if(encode_codepoint(converted.codepoints[0], encoded) != info.byte_count) {
+            return i;
+        }
+        memcpy(buf + i, encoded, info.byte_count);
+        i += info.byte_count;
+    }
+    return i;
+}
+
+uint64_t load_word(const char *buf) {
+    uint64_t word;
+    memcpy(&word, buf, sizeof(word));
+    return word;
+}
+
+// Lowercases ASCII letters eight bytes at a time. Unlike
+// swar_flip_case, bytes with the high bit set are allowed and
+// left as they are.
+uint64_t swar_ascii_lower(uint64_t word) {
+    const uint64_t low_bits = word & ~SWAR_HIGH_BITS;
+    const uint64_t at_least_a = low_bits + repeat_byte(0x80 - 'A');
+    const uint64_t past_z = low_bits + repeat_byte(0x80 - 'Z' - 1);
+    const uint64_t is_upper = at_least_a & ~past_z & ~word & SWAR_HIGH_BITS;
+    return word | (is_upper >> 2);
+}
+
+unsigned char ascii_lower(unsigned char c) { return c >= 'A' && c <= 'Z' ? c | 0x20 : c; }
+
+// Skips the longest common prefix of a and b that is ASCII in both
+// and equal ignoring case. Both pointers are advanced.
+void skip_equal_ascii_words(const char *&a, const char *a_end, const char *&b, const char *b_end) {
+    while(a_end - a >= 8 && b_end - b >= 8) {
+        const uint64_t a_word = load_word(a);
+        const uint64_t b_word = load_word(b);
+        if(((a_word | b_word) & SWAR_HIGH_BITS) != 0 ||
+           swar_ascii_lower(a_word) != swar_ascii_lower(b_word)) {
+            return;
+        }
+        a += 8;
+        b += 8;
+    }
+}
+
+int compare_codepoints(uint32_t a, uint32_t b) { return a < b ? -1 : (a > b ? 1 : 0); }
+
+int compare_casefolded_ascii(const char *a, size_t a_size, const char *b, size_t b_size) {
+    const char *const a_end = a + a_size;
+    const char *const b_end = b + b_size;
+    while(a_end - a >= 8 && b_end - b >= 8) {
+        if(swar_ascii_lower(load_word(a)) != swar_ascii_lower(load_word(b))) {
+            break;
+        }
+        a += 8;
+        b += 8;
+    }
+    for(; a != a_end && b != b_end; ++a, ++b) {
+        const auto a_char = ascii_lower(*a);
+        const auto b_char = ascii_lower(*b);
+        if(a_char != b_char) {
+            return compare_codepoints(a_char, b_char);
+        }
+    }
+    return compare_codepoints(a == a_end ? 0 : 1, b == b_end ? 0 : 1);
+}
+
+uint32_t next_casefolded_codepoint(const char *&text) {
+    const auto c = (unsigned char)*text;
+    if(c < 0x80) {
+        ++text;
+        return ascii_lower(c);
+    }
+    const auto info = extract_one_codepoint((const unsigned char *)text);
+    text += info.byte_count;
+    return casefold_unicode(info.codepoint);
+}
+
+// Inputs must be valid UTF-8. Case variants may have different byte
+// lengths, so the two strings are traversed independently.
+int compare_casefolded_utf8(const char *a, size_t a_size, const char *b, size_t b_size) {
+    const char *const a_end = a + a_size;
+    const char *const b_end = b + b_size;
+    while(true) {
+        skip_equal_ascii_words(a, a_end, b, b_end);
+        if(a == a_end || b == b_end) {
+            return compare_codepoints(a == a_end ? 0 : 1, b == b_end ? 0 : 1);
+        }
+        const auto a_codepoint = next_casefolded_codepoint(a);
+        const auto b_codepoint = next_casefolded_codepoint(b);
+        if(a_codepoint != b_codepoint) {
+            return compare_codepoints(a_codepoint, b_codepoint);
+        }
+    }
+}
+
 } // namespace
 
 #ifdef _MSC_VER
@@ -276,10 +653,20 @@ void Bytes::append(const char c) {
 }
 
 void Bytes::append(const char *begin, const char *end) {
-    while(begin != end) {
-        append(*begin);
-        ++begin;
+    if(begin == end) {
+        return;
+    }
+    const size_t append_size = end - begin;
+    if(is_ptr_within(begin)) {
+        // Growing may invalidate the source pointer.
+        const size_t offset = begin - buf.get();
+        grow_to(bufsize + append_size);
+        begin = buf.get() + offset;
+    } else {
+        grow_to(bufsize + append_size);
     }
+    memcpy(buf.get() + bufsize, begin, append_size);
+    bufsize += append_size;
 }
 
 void Bytes::extend(size_t num_bytes) noexcept {
@@ -434,12 +821,22 @@ bool CStringView::starts_with(CStringView view) const {
 }
 
 size_t CStringView::find(char c) const {
-    for(size_t i = 0; i < bufsize; ++i) {
-        if(buf[i] == c) {
-            return i;
-        }
+    if(bufsize == 0) {
+        return (size_t)-1;
     }
-    return (size_t)-1;
+    auto *loc = (const char *)memchr(buf, c, bufsize);
+    if(!loc) {
+        return (size_t)-1;
+    }
+    return loc - buf;
+}
+
+size_t CStringView::rfind(char c) const {
+    auto *loc = reverse_find_byte(buf, bufsize, c);
+    if(!loc) {
+        return (size_t)-1;
+    }
+    return loc - buf;
 }
 
 CStringView CStringView::substr(size_t pos, size_t count) const {
@@ -456,22 +853,19 @@ CStringView CStringView::substr(size_t pos, size_t count) const {
 }
 
 size_t CStringView::find(CStringView substr) const {
-    if(substr.size() > size()) {
-        return -1;
+    auto *loc = find_bytes(buf, bufsize, substr.buf, substr.bufsize);
+    if(!loc) {
+        return (size_t)-1;
     }
-    for(size_t start = 0; start < size() - substr.size(); ++start) {
-        bool has_mismatch = false;
-        for(size_t i = 0; i < substr.size(); ++i) {
-            if(buf[start + i] != substr.buf[i]) {
-                has_mismatch = true;
-                break;
-            }
-        }
-        if(!has_mismatch) {
-            return start;
-        }
+    return loc - buf;
+}
+
+size_t CStringView::rfind(CStringView substr) const {
+    auto *loc = reverse_find_bytes(buf, bufsize, substr.buf, substr.bufsize);
+    if(!loc) {
+        return (size_t)-1;
     }
-    return (size_t)-1;
+    return loc - buf;
 }
 
 bool CStringView::operator<(const CStringView &o) const {
@@ -571,25 +965,96 @@ int CStringView::natural_order(const CStringView &o) const {
     }
 }
 
-void CStringView::split(CStringViewCallback cb, void *ctx) const {
-    size_t i = 0;
-    while(i < size()) {
-        while(i < size() && is_ascii_whitespace(buf[i])) {
-            ++i;
-        }
-        if(i == size()) {
-            break;
-        }
-        const auto string_start = i;
-        ++i;
-        while(i < size() && (!is_ascii_whitespace(buf[i]))) {
-            ++i;
+template<typename Callback>
+size_t WhitespaceTokenizer::tokenize(const Callback &cb, size_t max_pieces) {
+    const size_t NO_PIECE = (size_t)-1;
+    size_t num_pieces = 0;
+    size_t piece_start = NO_PIECE;
+    size_t block_start = offset;
+    while(block_start < bufsize && num_pieces < max_pieces) {
+        const size_t block_size = minval(WHITESPACE_BLOCK_SIZE, bufsize - block_start);
+        uint64_t whitespace;
+        if(block_size == WHITESPACE_BLOCK_SIZE) {
+            whitespace = whitespace_mask_block(buf + block_start);
+        } else {
+            // Treat the area past the end as whitespace, so that the
+            // last piece gets terminated.
+            whitespace = whitespace_mask_partial(buf + block_start, block_size) |
+                         (~uint64_t(0) << block_size);
         }
-        CStringView piece{buf + string_start, i - string_start};
-        if(!cb(piece, ctx)) {
-            break;
+        size_t bit = 0;
+        while(bit < WHITESPACE_BLOCK_SIZE) {
+            if(piece_start == NO_PIECE) {
+                const uint64_t remaining = ~whitespace >> bit;
+                if(remaining == 0) {
+                    break;
+                }
+                bit += __builtin_ctzll(remaining);
+                piece_start = block_start + bit;
+            } else {
+                const uint64_t remaining = whitespace >> bit;
+                if(remaining == 0) {
+                    break;
+                }
+                bit += __builtin_ctzll(remaining);
+                ++num_pieces;
+                if(!cb(PieceLocation{piece_start, block_start + bit - piece_start}) ||
+                   num_pieces == max_pieces) {
+                    offset = block_start + bit;
+                    return num_pieces;
+                }
+                piece_start = NO_PIECE;
+            }
         }
+        block_start += block_size;
     }
+    if(piece_start != NO_PIECE) {
+        // Only happens if the text ends at a block boundary.
+        ++num_pieces;
+        cb(PieceLocation{piece_start, bufsize - piece_start});
+    }
+    offset = bufsize;
+    return num_pieces;
+}
+
+size_t WhitespaceTokenizer::next_batch(Vector<PieceLocation> &out, size_t max_pieces) {
+    return tokenize(
+        [&out](const PieceLocation &loc) {
+            out.push_back(loc);
+            return true;
+        },
+        max_pieces);
+}
+
+size_t WhitespaceTokenizer::next_batch(Vector<CStringView> &out, size_t max_pieces) {
+    return tokenize(
+        [this, &out](const PieceLocation &loc) {
+            out.push_back(CStringView(buf + loc.offset, loc.size));
+            return true;
+        },
+        max_pieces);
+}
+
+size_t WhitespaceTokenizer::next_batch(Vector<U8StringView> &out, size_t max_pieces) {
+    return tokenize(
+        [this, &out](const PieceLocation &loc) {
+            // Splitting valid UTF-8 at ASCII characters always
+            // gives valid UTF-8, so there is no need to revalidate.
+            auto *piece_start = (const unsigned char *)buf + loc.offset;
+            out.push_back(U8StringView(ValidU8Iterator(piece_start),
+                                       ValidU8Iterator(piece_start + loc.size)));
+            return true;
+        },
+        max_pieces);
+}
+
+void CStringView::split(CStringViewCallback cb, void *ctx) const {
+    WhitespaceTokenizer tokenizer(*this);
+    tokenizer.tokenize(
+        [this, cb, ctx](const PieceLocation &loc) {
+            return cb(CStringView{buf + loc.offset, loc.size}, ctx);
+        },
+        (size_t)-1);
 }
 
 CString::CString(Bytes incoming) {
@@ -634,10 +1099,8 @@ CString::CString(const char *txt, size_t txtsize) {
 }
 
 void CString::check_embedded_nuls() const {
-    for(size_t i = 0; i < bytes.size() - 1; ++i) {
-        if(bytes[i] == '\0') {
-            throw PyException("Embedded null in CString contents.");
-        }
+    if(memchr(bytes.data(), '\0', bytes.size() - 1)) {
+        throw PyException("Embedded null in CString contents.");
     }
 }
 
@@ -774,10 +1237,15 @@ void CString::append(const char *str, size_t strsize) {
     if(strsize == (size_t)-1) {
         strsize = strlen(str);
     }
-    for(size_t i = 0; i < strsize; ++i) {
-        // FIXME, slow.
-        append(str[i]);
+    if(strsize == 0) {
+        return;
+    }
+    if(memchr(str, '\0', strsize)) {
+        throw PyException("Tried to add a null byte to a CString.");
     }
+    bytes.pop_back();
+    bytes.append(str, str + strsize);
+    bytes.append('\0');
 }
 
 void CString::append(const char *start, const char *stop) { append(start, stop - start); }
@@ -817,16 +1285,7 @@ void CString::insert(size_t i, const CStringView &v) noexcept {
 
 size_t CString::find(CStringView substr) const { return view().find(substr); }
 
-size_t CString::rfind(const char c) const noexcept {
-    size_t i = bytes.size() - 1;
-    while(i != (size_t)-1) {
-        if(bytes[i] == c) {
-            return i;
-        }
-        --i;
-    }
-    return -1;
-}
+size_t CString::rfind(const char c) const noexcept { return view().rfind(c); }
 
 bool CString::view_points_to_this(const CStringView &v) const {
     return bytes.is_ptr_within(v.data());
@@ -961,7 +1420,7 @@ bool U8StringView::operator==(const char *txt) const noexcept {
         if(data_start + i == data_end) {
             return txt[i] == '\0';
         }
-        if(data_start[i] != txt[i]) {
+        if(data_start[i] != (unsigned char)txt[i]) {
             return false;
         }
         ++i;
@@ -981,50 +1440,95 @@ bool U8StringView::operator==(const U8StringView &o) const noexcept {
 }
 
 U8String U8StringView::upper() const {
+    Bytes out;
+    out.reserve(size_bytes() + 1);
+    convert_case(data(), size_bytes(), to_upper, out);
     U8String result;
-    result.reserve(size_bytes());
-    for(auto it = start; it != stop; ++it) {
-        const auto uppered = uppercase_unicode(*it);
-        for(size_t i = 0; i < 3; ++i) {
-            if(uppered.codepoints[i] != 0) {
-                result.append_codepoint(uppered.codepoints[i]);
-            }
-        }
-    }
+    result.cstring = CString(move(out));
     return result;
 }
 
 U8String U8StringView::lower() const {
+    Bytes out;
+    out.reserve(size_bytes() + 1);
+    convert_case(data(), size_bytes(), to_lower, out);
     U8String result;
-    result.reserve(size_bytes());
-    for(auto it = start; it != stop; ++it) {
-        const auto lowered = lowercase_unicode(*it);
-        for(size_t i = 0; i < 3; ++i) {
-            if(lowered.codepoints[i] != 0) {
-                result.append_codepoint(lowered.codepoints[i]);
+    result.cstring = CString(move(out));
+    return result;
+}
+
+bool equals_ignoring_case(CStringView a, CStringView b) {
+    return a.size() == b.size() && compare_casefolded_ascii(a.data(), a.size(), b.data(), b.size()) == 0;
+}
+
+int compare_ignoring_case(CStringView a, CStringView b) {
+    return compare_casefolded_ascii(a.data(), a.size(), b.data(), b.size());
+}
+
+bool equals_ignoring_case(const U8StringView &a, const U8StringView &b) {
+    return compare_casefolded_utf8(a.data(), a.size_bytes(), b.data(), b.size_bytes()) == 0;
+}
+
+int compare_ignoring_case(const U8StringView &a, const U8StringView &b) {
+    return compare_casefolded_utf8(a.data(), a.size_bytes(), b.data(), b.size_bytes());
+}
+
+size_t casefold_ascii_chunk(const char *&text, const char *end, char *buf) {
+    size_t written = 0;
+    while(end - text >= 8 && written + 8 <= CASEFOLD_CHUNK_SIZE) {
+        const uint64_t folded = swar_ascii_lower(load_word(text));
+        memcpy(buf + written, &folded, sizeof(folded));
+        text += 8;
+        written += 8;
+    }
+    while(text != end && written < CASEFOLD_CHUNK_SIZE) {
+        buf[written++] = ascii_lower(*text++);
+    }
+    return written;
+}
+
+size_t casefold_utf8_chunk(const char *&text, const char *end, char *buf) {
+    size_t written = 0;
+    while(text != end && written + 4 <= CASEFOLD_CHUNK_SIZE) {
+        if(end - text >= 8 && written + 8 <= CASEFOLD_CHUNK_SIZE) {
+            const uint64_t word = load_word(text);
+            if((word & SWAR_HIGH_BITS) == 0) {
+                const uint64_t folded = swar_ascii_lower(word);
+                memcpy(buf + written, &folded, sizeof(folded));
+                text += 8;
+                written += 8;
+                continue;
             }
         }
+        written += encode_codepoint(next_casefolded_codepoint(text), (unsigned char *)buf + written);
     }
-    return result;
+    return written;
+}
+
+size_t U8StringView::size_codepoints() const noexcept {
+    return count_codepoints(start.buf, size_bytes());
+}
+
+size_t U8StringView::find(const U8StringView &substr) const {
+    return raw_view().find(substr.raw_view());
+}
+
+size_t U8StringView::rfind(const U8StringView &substr) const {
+    return raw_view().rfind(substr.raw_view());
 }
 
 U8StringSplitClosure_temp U8StringView::split_ascii() { return U8StringSplitClosure_temp{*this}; }
 
 Optional<U8StringView> U8StringSplitClosure_temp::next() {
-    if(current >= original.end()) {
-        return {};
-    }
-    while(current < original.end() && is_ascii_whitespace(*current)) {
-        ++current;
-    }
-    if(current == original.end()) {
-        return {};
-    }
-    auto word_start = current;
-    while(current < original.end() && !is_ascii_whitespace(*current)) {
-        ++current;
+    if(next_piece == batch.size()) {
+        const size_t SPLIT_BATCH_SIZE = 64;
+        batch.clear();
+        next_piece = 0;
+        if(tokenizer.next_batch(batch, SPLIT_BATCH_SIZE) == 0) {
+            return {};
+        }
     }
-    return U8StringView(word_start, current);
+    return batch[next_piece++];
 }
 
 U8String::U8String(Bytes incoming) {
@@ -1055,10 +1559,80 @@ U8String U8String::substr(size_t offset, size_t length) const {
 
 U8StringView U8String::view() const { return U8StringView{cbegin(), cend()}; }
 
+size_t U8String::size_codepoints() const {
+    if(num_codepoints == (size_t)-1) {
+        num_codepoints = count_codepoints((const unsigned char *)cstring.data(), size_bytes());
+    }
+    return num_codepoints;
+}
+
+size_t U8String::codepoint_offset(size_t index) const {
+    const size_t total = size_codepoints();
+    if(index > total) {
+        throw PyException("Codepoint index out of bounds.");
+    }
+    if(total == size_bytes()) {
+        return index;
+    }
+    if(index == total) {
+        return size_bytes();
+    }
+    const auto *buf = (const unsigned char *)cstring.data();
+    if(size_bytes() <= CODEPOINT_INDEX_INTERVAL) {
+        return skip_codepoints(buf, 0, index);
+    }
+    if(codepoint_index.is_empty()) {
+        build_codepoint_index();
+    }
+    return skip_codepoints(buf,
+                           codepoint_index[index / CODEPOINT_INDEX_INTERVAL],
+                           index % CODEPOINT_INDEX_INTERVAL);
+}
+
+U8StringView U8String::slice_codepoints(size_t start, size_t count) const {
+    const size_t start_offset = codepoint_offset(start);
+    const size_t end_offset =
+        count >= size_codepoints() - start ? size_bytes() : codepoint_offset(start + count);
+    const auto *buf = (const unsigned char *)cstring.data();
+    return U8StringView(ValidU8Iterator(buf + start_offset), ValidU8Iterator(buf + end_offset));
+}
+
+void U8String::build_codepoint_index() const {
+    const auto *buf = (const unsigned char *)cstring.data();
+    const size_t bufsize = size_bytes();
+    size_t codepoints = 0;
+    size_t i = 0;
+    codepoint_index.clear();
+    codepoint_index.reserve(bufsize / CODEPOINT_INDEX_INTERVAL + 1);
+    while(i < bufsize) {
+        const size_t next_indexed = codepoint_index.size() * CODEPOINT_INDEX_INTERVAL;
+        if(i + sizeof(uint64_t) <= bufsize) {
+            uint64_t word;
+            memcpy(&word, buf + i, sizeof(uint64_t));
+            const size_t codepoint_starts = sizeof(uint64_t) - count_continuation_bytes(word);
+            // Skip words that do not have the next indexed codepoint.
+            if(codepoints + codepoint_starts <= next_indexed) {
+                codepoints += codepoint_starts;
+                i += sizeof(uint64_t);
+                continue;
+            }
+        }
+        if((buf[i] & 0xC0) != 0x80) {
+            if(codepoints == next_indexed) {
+                codepoint_index.push_back(i);
+            }
+            ++codepoints;
+        }
+        ++i;
+    }
+    num_codepoints = codepoints;
+}
+
 bool U8String::operator==(const char *str) const { return strcmp(str, cstring.c_str()) == 0; }
 
 U8String &U8String::operator+=(const U8String &o) {
     cstring += o.cstring;
+    invalidate_codepoint_index();
     return *this;
 }
 
@@ -1097,6 +1671,7 @@ void U8String::split(U8StringViewCallback cb, IsSplittingCharacter is_split_char
 
 void U8String::insert(const ValidU8Iterator &it, U8StringView view) {
     cstring.insert(it.byte_location() - (const unsigned char *)cstring.data(), view.raw_view());
+    invalidate_codepoint_index();
 }
 
 void U8String::remove(U8StringView view) {
@@ -1106,6 +1681,7 @@ void U8String::remove(U8StringView view) {
     const size_t start_index = (const char *)view.begin().byte_location() - cstring.c_str();
     const size_t end_index = (const char *)view.end().byte_location() - cstring.c_str();
     cstring.remove(start_index, end_index);
+    invalidate_codepoint_index();
 }
 
 void U8String::pop_front() noexcept {
@@ -1129,25 +1705,36 @@ void U8String::pop_back() noexcept {
 }
 
 void U8String::append_codepoint(uint32_t codepoint) {
-    unsigned char buf[5] = {0, 0, 0, 0, 0};
-    if(codepoint < 0x80) {
-        buf[0] = codepoint;
-    } else if(codepoint < 0x800) {
-        buf[0] = 0xC0 | (codepoint >> 6 & 0x1F);
-        buf[1] = 0x80 | (codepoint & 0x3F);
-    } else if(codepoint < 0x10000) {
-        buf[0] = 0xE0 | (codepoint >> 12 & 0x0F);
-        buf[1] = 0x80 | (codepoint >> 6 & 0x3F);
-        buf[2] = 0x80 | (codepoint & 0x3F);
-    } else if(codepoint < 0x110000) {
-        buf[0] = 0xF0 | (codepoint >> 18 & 0x07);
-        buf[1] = 0x80 | (codepoint >> 12 & 0x3F);
-        buf[2] = 0x80 | (codepoint >> 6 & 0x3F);
-        buf[3] = 0x80 | (codepoint & 0x3F);
-    } else {
-        throw PyException("Unicode codepoint > 0x110000.");
+    unsigned char buf[4];
+    const auto encoded_size = encode_codepoint(codepoint, buf);
+    cstring.append((const char *)buf, encoded_size);
+    invalidate_codepoint_index();
+}
+
+void U8String::upper_inplace() {
+    invalidate_codepoint_index();
+    const auto converted = convert_case_inplace(cstring.mutable_data(), size_bytes(), to_upper);
+    if(converted == size_bytes()) {
+        return;
     }
-    cstring += (char *)buf;
+    Bytes out;
+    out.reserve(size_bytes() + 16);
+    out.append(c_str(), c_str() + converted);
+    convert_case(c_str() + converted, size_bytes() - converted, to_upper, out);
+    cstring = CString(move(out));
+}
+
+void U8String::lower_inplace() {
+    invalidate_codepoint_index();
+    const auto converted = convert_case_inplace(cstring.mutable_data(), size_bytes(), to_lower);
+    if(converted == size_bytes()) {
+        return;
+    }
+    Bytes out;
+    out.reserve(size_bytes() + 16);
+    out.append(c_str(), c_str() + converted);
+    convert_case(c_str() + converted, size_bytes() - converted, to_lower, out);
+    cstring = CString(move(out));
 }
 
 bool U8String::contains(const U8StringView &view) const {
@@ -1224,6 +1811,135 @@ Bytes File::readline_bytes() {
     }
 }
 
+namespace {
+
+// The limit for the number of iovecs in a single writev.
+const size_t MAX_WRITE_PIECES = 64;
+
+// Writes everything, continuing after partial writes and interrupts.
+void write_all(int fd, struct iovec *pieces, size_t num_pieces) {
+    while(num_pieces > 0) {
+        const int batch = (int)(num_pieces < MAX_WRITE_PIECES ? num_pieces : MAX_WRITE_PIECES);
+        const ssize_t rc = writev(fd, pieces, batch);
+        if(rc < 0) {
+            if(errno == EINTR) {
+                continue;
+            }
+            throw PyException(strerror(errno));
+        }
+        size_t written = (size_t)rc;
+        while(num_pieces > 0 && written >= pieces->iov_len) {
+            written -= pieces->iov_len;
+            ++pieces;
+            --num_pieces;
+        }
+        if(written > 0) {
+            pieces->iov_base = (char *)pieces->iov_base + written;
+            pieces->iov_len -= written;
+        }
+    }
+}
+
+} // namespace
+
+BufferedWriter::BufferedWriter(int fd_, size_t buffer_size)
+    : buf{buffer_size}, fd{fd_}, owns_fd{false} {
+    if(buffer_size == 0) {
+        throw PyException("Writer buffer size must not be zero.");
+    }
+}
+
+BufferedWriter::BufferedWriter(const char *path, size_t buffer_size)
+    : BufferedWriter(-1, buffer_size) {
+    fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+    if(fd < 0) {
+        throw PyException(strerror(errno));
+    }
+    owns_fd = true;
+}
+
+BufferedWriter::~BufferedWriter() {
+    try {
+        flush();
+    } catch(const PyException &) {
+    }
+    if(owns_fd) {
+        close(fd);
+    }
+}
+
+void BufferedWriter::flush() {
+    if(used == 0) {
+        return;
+    }
+    struct iovec piece{buf.get(), used};
+    // Empty the buffer even if writing fails, so that the destructor
+    // does not try again.
+    used = 0;
+    write_all(fd, &piece, 1);
+}
+
+void BufferedWriter::write_overflowing(const char *data, size_t data_size) {
+    if(data_size < buf.size()) {
+        flush();
+        memcpy(buf.get(), data, data_size);
+        used = data_size;
+        return;
+    }
+    struct iovec pieces[2] = {{buf.get(), used}, {(void *)data, data_size}};
+    used = 0;
+    write_all(fd, pieces, 2);
+}
+
+void BufferedWriter::write_pieces(Span<const CStringView> pieces) {
+    struct iovec iov[MAX_WRITE_PIECES];
+    size_t num_iov = 0;
+    // Small pieces are copied to the buffer, big ones are referenced
+    // directly. Buffered bytes from pending_start on are not in iov yet.
+    const size_t copy_limit = buf.size() / 16;
+    size_t pending_start = 0;
+    auto add_pending = [&] {
+        if(used > pending_start) {
+            iov[num_iov++] = {buf.get() + pending_start, used - pending_start};
+            pending_start = used;
+        }
+    };
+    auto send_all = [&] {
+        add_pending();
+        write_all(fd, iov, num_iov);
+        num_iov = 0;
+        used = 0;
+        pending_start = 0;
+    };
+    for(const auto &piece : pieces) {
+        if(piece.is_empty()) {
+            // May have a null data pointer, which memcpy does not allow.
+            continue;
+        }
+        if(piece.size() < copy_limit) {
+            if(piece.size() > buf.size() - used) {
+                send_all();
+            }
+            memcpy(buf.get() + used, piece.data(), piece.size());
+            used += piece.size();
+        } else {
+            // Leaves room for the pending bytes that send_all may add.
+            if(num_iov + 3 > MAX_WRITE_PIECES) {
+                send_all();
+            }
+            add_pending();
+            iov[num_iov++] = {(void *)piece.data(), piece.size()};
+        }
+    }
+    if(num_iov > 0) {
+        // Whatever came after the last big piece stays buffered.
+        const size_t tail = used - pending_start;
+        write_all(fd, iov, num_iov);
+        memmove(buf.get(), buf.get() + pending_start, tail);
+        used = tail;
+    }
+}
+
 Range::Range(int64_t end_) : Range(0, end_) {}
 
 Range::Range(int64_t start, int64_t end_) : Range(start, end_, 1) {}
@@ -1240,33 +1956,587 @@ Optional<int64_t> Range::next() {
     return result;
 }
 
-MMapping::~MMapping() {
+size_t Range::size() const {
+    if(step <= 0) {
+        throw PyException("Range size requires a positive step.");
+    }
+    if(i >= end) {
+        return 0;
+    }
+    return (size_t)((end - i - 1) / step + 1);
+}
+
+void MMapping::unmap() noexcept {
     if(buf) {
-        if(munmap((void *)buf, bufsize) != 0) {
+        if(munmap(buf, bufsize) != 0) {
             perror(nullptr);
         }
+        buf = nullptr;
     }
 }
 
-Optional<MMapping> mmap_file(const char *path) {
-    FILE *f = fopen(path, "rb");
-    if(!f) {
+MMapping::~MMapping() { unmap(); }
+
+namespace {
+
+int madvise_flag(MMapAccess access) {
+    switch(access) {
+    case MMapAccess::Sequential:
+        return MADV_SEQUENTIAL;
+    case MMapAccess::Random:
+        return MADV_RANDOM;
+    default:
+        return MADV_NORMAL;
+    }
+}
+
+// Hints only, failures are not errors.
+void apply_mmap_hints(void *buf, size_t bufsize, const MMapOptions &options) {
+    if(options.access != MMapAccess::Normal) {
+        madvise(buf, bufsize, madvise_flag(options.access));
+    }
+#ifdef MADV_HUGEPAGE
+    if(options.huge_pages) {
+        madvise(buf, bufsize, MADV_HUGEPAGE);
+    }
+#endif
+    bool will_need = options.will_need;
+#ifndef MAP_POPULATE
+    will_need = will_need || options.populate;
+#endif
+    if(will_need) {
+        madvise(buf, bufsize, MADV_WILLNEED);
+    }
+}
+
+} // namespace
+
+void MMapping::advise(MMapAccess access) const {
+    if(buf) {
+        madvise(buf, bufsize, madvise_flag(access));
+    }
+}
+
+Span<char> MMapping::writable_span() {
+    if(!writable) {
+        throw PyException("Mapping is not writable.");
+    }
+    return Span{(char *)buf + data_offset, bufsize - data_offset};
+}
+
+void MMapping::flush() {
+    if(writable && msync(buf, bufsize, MS_SYNC) != 0) {
+        throw PyException(strerror(errno));
+    }
+}
+
+Optional<MMapping> mmap_file(const char *path) { return mmap_file(path, MMapOptions{}); }
+
+Optional<MMapping> mmap_file(const char *path, const MMapOptions &options) {
+    const int fd = open(path, (options.writable ? O_RDWR : O_RDONLY) | O_CLOEXEC);
+    if(fd < 0) {
         return Optional<MMapping>();
     }
-    fseek(f, 0, SEEK_END);
-    const auto bufsize = ftell(f);
-    if(bufsize == 0) {
-        fclose(f);
+    auto result = mmap_file(fd, options);
+    close(fd);
+    return result;
+}
+
+Optional<MMapping> mmap_file(int fd, const MMapOptions &options) {
+    struct stat st;
+    if(fstat(fd, &st) != 0) {
+        return Optional<MMapping>();
+    }
+    const uint64_t file_size = (uint64_t)st.st_size;
+    if(options.offset >= file_size) {
+        return Optional<MMapping>();
+    }
+    uint64_t length = file_size - options.offset;
+    if(options.length != 0) {
+        if(options.length > length) {
+            return Optional<MMapping>();
+        }
+        length = options.length;
+    }
+    // Mappings must start at a page boundary.
+    const uint64_t page_size = (uint64_t)sysconf(_SC_PAGESIZE);
+    const uint64_t map_offset = options.offset - options.offset % page_size;
+    const uint64_t map_size = length + (options.offset - map_offset);
+    if(map_size > SIZE_MAX) {
         return Optional<MMapping>();
     }
-    fseek(f, 0, SEEK_SET);
-    int fd = fileno(f);
-    auto *buf = mmap(nullptr, bufsize, PROT_READ, MAP_PRIVATE, fd, 0);
-    fclose(f);
+    int flags = options.writable ? MAP_SHARED : MAP_PRIVATE;
+    const int protection = options.writable ? PROT_READ | PROT_WRITE : PROT_READ;
+#ifdef MAP_POPULATE
+    if(options.populate) {
+        flags |= MAP_POPULATE;
+    }
+#endif
+    auto *buf = mmap(nullptr, (size_t)map_size, protection, flags, fd, (off_t)map_offset);
     if(buf == MAP_FAILED) {
         return Optional<MMapping>();
     }
-    return Optional<MMapping>(MMapping(buf, bufsize));
+    apply_mmap_hints(buf, (size_t)map_size, options);
+    return Optional<MMapping>(MMapping(
+        buf, (size_t)map_size, (size_t)(options.offset - map_offset), options.writable));
+}
+
+namespace {
+
+size_t round_up_to_pages(size_t size) {
+    const size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+    return (size + page_size - 1) / page_size * page_size;
+}
+
+} // namespace
+
+GrowableMapping::GrowableMapping(const char *path, size_t initial_capacity) {
+    fd = open(path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+    if(fd < 0) {
+        throw PyException(strerror(errno));
+    }
+    capacity = round_up_to_pages(initial_capacity > 0 ? initial_capacity : 1);
+    void *mapping = MAP_FAILED;
+    if(ftruncate(fd, (off_t)capacity) == 0) {
+        mapping = mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    if(mapping == MAP_FAILED) {
+        const int error = errno;
+        ::close(fd);
+        throw PyException(strerror(error));
+    }
+    buf = (char *)mapping;
+}
+
+GrowableMapping::~GrowableMapping() {
+    try {
+        close();
+    } catch(const PyException &) {
+    }
+}
+
+void GrowableMapping::grow(size_t amount) {
+    if(fd < 0) {
+        throw PyException("Mapping has been closed.");
+    }
+    if(amount > SIZE_MAX / 2 - used) {
+        throw PyException("Mapping size overflow.");
+    }
+    size_t new_capacity = capacity;
+    while(new_capacity - used < amount) {
+        new_capacity *= 2;
+    }
+    if(ftruncate(fd, (off_t)new_capacity) != 0) {
+        throw PyException(strerror(errno));
+    }
+#ifdef MREMAP_MAYMOVE
+    void *mapping = mremap(buf, capacity, new_capacity, MREMAP_MAYMOVE);
+#else
+    // The data is already in the file, so it can be mapped again.
+    void *mapping = mmap(nullptr, new_capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if(mapping != MAP_FAILED) {
+        munmap(buf, capacity);
+    }
+#endif
+    if(mapping == MAP_FAILED) {
+        throw PyException(strerror(errno));
+    }
+    buf = (char *)mapping;
+    capacity = new_capacity;
+}
+
+void GrowableMapping::resize(size_t new_size) {
+    if(new_size > used) {
+        extend(new_size - used);
+    } else {
+        used = new_size;
+    }
+}
+
+void GrowableMapping::flush() {
+    if(fd >= 0 && msync(buf, used, MS_SYNC) != 0) {
+        throw PyException(strerror(errno));
+    }
+}
+
+void GrowableMapping::close() {
+    if(fd < 0) {
+        return;
+    }
+    munmap(buf, capacity);
+    buf = nullptr;
+    capacity = 0;
+    const int rc = ftruncate(fd, (off_t)used);
+    const int error = errno;
+    ::close(fd);
+    fd = -1;
+    if(rc != 0) {
+        throw PyException(strerror(error));
+    }
+}
+
+namespace {
+
+const uint64_t ASCII_ZEROS = 0x3030303030303030;
+
+// True if all eight bytes are ASCII digits.
+bool is_eight_digits(uint64_t word) {
+    return ((word & 0xF0F0F0F0F0F0F0F0) == ASCII_ZEROS) &&
+           (((word + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) == ASCII_ZEROS);
+}
+
+// Converts eight ASCII digits to their value with three multiplications.
+uint32_t parse_eight_digits(uint64_t word) {
+    word -= ASCII_ZEROS;
+    word = (word * 10) + (word >> 8);
+    const uint64_t mask = 0x000000FF000000FF;
+    const uint64_t mul1 = 100 + (uint64_t(1000000) << 32);
+    const uint64_t mul2 = 1 + (uint64_t(10000) << 32);
+    word = (((word & mask) * mul1) + (((word >> 16) & mask) * mul2)) >> 32;
+    return uint32_t(word);
+}
+
+// Reads eight bytes so that the first one is the lowest.
+uint64_t load_digits(const char *buf) {
+    uint64_t word;
+    memcpy(&word, buf, sizeof(word));
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    word = __builtin_bswap64(word);
+#endif
+    return word;
+}
+
+int digit_value(char c) {
+    if(c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if(c >= 'a' && c <= 'z') {
+        return c - 'a' + 10;
+    }
+    if(c >= 'A' && c <= 'Z') {
+        return c - 'A' + 10;
+    }
+    return 99;
+}
+
+bool is_digit(char c) { return c >= '0' && c <= '9'; }
+
+bool equals_ignoring_ascii_case(const char *text, size_t text_size, const char *lowercase) {
+    size_t i = 0;
+    for(; i < text_size && lowercase[i]; ++i) {
+        if(text[i] != lowercase[i] && text[i] != lowercase[i] - 'a' + 'A') {
+            return false;
+        }
+    }
+    return i == text_size && lowercase[i] == '\0';
+}
+
+// A decimal number of the form mantissa * 10^exponent.
+struct ParsedDecimal {
+    uint64_t mantissa = 0;
+    int64_t exponent = 0;
+    int significant_digits = 0;
+    // Nonzero digits were dropped after the first 19.
+    bool truncated = false;
+};
+
+const int MAX_MANTISSA_DIGITS = 19;
+// Larger exponents give zero or infinity for any mantissa.
+const int64_t MAX_PARSED_EXPONENT = 100000;
+
+void add_digit(ParsedDecimal &decimal, int digit, bool is_fraction) {
+    if(decimal.significant_digits == 0 && digit == 0) {
+        if(is_fraction) {
+            --decimal.exponent;
+        }
+        return;
+    }
+    if(decimal.significant_digits < MAX_MANTISSA_DIGITS) {
+        decimal.mantissa = 10 * decimal.mantissa + digit;
+        ++decimal.significant_digits;
+        if(is_fraction) {
+            --decimal.exponent;
+        }
+    } else {
+        if(!is_fraction) {
+            ++decimal.exponent;
+        }
+        if(digit != 0) {
+            decimal.truncated = true;
+        }
+    }
+}
+
+// Returns the end of the digit run.
+const char *parse_digit_run(ParsedDecimal &decimal, const char *i, const char *end, bool is_fraction) {
+    while(i != end && is_digit(*i)) {
+        if(decimal.significant_digits > 0 &&
+           decimal.significant_digits + 8 <= MAX_MANTISSA_DIGITS && end - i >= 8) {
+            const uint64_t word = load_digits(i);
+            if(is_eight_digits(word)) {
+                decimal.mantissa = 100000000 * decimal.mantissa + parse_eight_digits(word);
+                decimal.significant_digits += 8;
+                if(is_fraction) {
+                    decimal.exponent -= 8;
+                }
+                i += 8;
+                continue;
+            }
+        }
+        add_digit(decimal, *i - '0', is_fraction);
+        ++i;
+    }
+    return i;
+}
+
+const double exact_powers_of_ten[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                      1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                      1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+struct Uint128Product {
+    uint64_t high;
+    uint64_t low;
+};
+
+Uint128Product full_multiplication(uint64_t a, uint64_t b) {
+    const uint64_t low_mask = 0xFFFFFFFF;
+    const uint64_t ah = a >> 32;
+    const uint64_t al = a & low_mask;
+    const uint64_t bh = b >> 32;
+    const uint64_t bl = b & low_mask;
+    const uint64_t ll = al * bl;
+    const uint64_t lh = al * bh;
+    const uint64_t hl = ah * bl;
+    const uint64_t hh = ah * bh;
+    const uint64_t middle = (ll >> 32) + (lh & low_mask) + (hl & low_mask);
+    return Uint128Product{hh + (lh >> 32) + (hl >> 32) + (middle >> 32),
+                          (middle << 32) | (ll & low_mask)};
+}
+
+int count_leading_zeros(uint64_t value) {
+    int count = 0;
+    for(uint64_t bit = uint64_t(1) << 63; (value & bit) == 0; bit >>= 1) {
+        ++count;
+    }
+    return count;
+}
+
+// The Eisel-Lemire algorithm from Daniel Lemire, "Number Parsing at a
+// Gigabyte per Second". Computes the bits of mantissa * 10^exponent
+// without the sign. Returns false if the result can not be determined
+// this way, either because it is too close to a rounding boundary or
+// because it is subnormal.
+bool eisel_lemire(uint64_t mantissa, int64_t exponent, uint64_t &bits) {
+    if(mantissa == 0 || exponent < POW5_MIN_EXPONENT) {
+        bits = 0;
+        return true;
+    }
+    if(exponent > POW5_MAX_EXPONENT) {
+        bits = uint64_t(0x7FF) << 52;
+        return true;
+    }
+    const Pow10Entry &power = pow5_significands[exponent - POW5_MIN_EXPONENT];
+    // 217706 / 65536 is about log2(10).
+    const int64_t binary_exponent = ((217706 * exponent) >> 16) + 1024 + 63;
+    int leading_zeros = count_leading_zeros(mantissa);
+    mantissa <<= leading_zeros;
+
+    const Uint128Product first = full_multiplication(mantissa, power.high);
+    uint64_t upper = first.high;
+    uint64_t lower = first.low;
+    if((upper & 0x1FF) == 0x1FF && lower + mantissa < lower) {
+        // The truncated power was not precise enough, use all 128 bits.
+        const Uint128Product second = full_multiplication(mantissa, power.low);
+        const uint64_t product_middle = lower + second.high;
+        const uint64_t product_high = upper + (product_middle < lower ? 1 : 0);
+        if(product_middle + 1 == 0 && (product_high & 0x1FF) == 0x1FF &&
+           second.low + mantissa < second.low) {
+            return false;
+        }
+        upper = product_high;
+        lower = product_middle;
+    }
+    const uint64_t upper_bit = upper >> 63;
+    uint64_t significand = upper >> (upper_bit + 9);
+    leading_zeros += int(1 ^ upper_bit);
+    // Exactly halfway between two floats, needs a slower tie break.
+    if(lower == 0 && (upper & 0x1FF) == 0 && (significand & 3) == 1) {
+        return false;
+    }
+    significand += significand & 1;
+    significand >>= 1;
+    if(significand >= (uint64_t(1) << 53)) {
+        significand = uint64_t(1) << 52;
+        --leading_zeros;
+    }
+    significand &= ~(uint64_t(1) << 52);
+    const int64_t biased_exponent = binary_exponent - leading_zeros;
+    if(biased_exponent < 1 || biased_exponent > 2046) {
+        return false;
+    }
+    bits = significand | (uint64_t(biased_exponent) << 52);
+    return true;
+}
+
+// Correctly rounded conversion by libc for the rare cases that the
+// fast paths can not handle. The digits are written without a decimal
+// point so that the locale does not matter.
+double parse_float_fallback(const char *int_start,
+                            const char *int_end,
+                            const char *frac_start,
+                            const char *frac_end,
+                            int64_t explicit_exponent) {
+    CString canonical;
+    canonical.reserve((int_end - int_start) + (frac_end - frac_start) + 24);
+    canonical.append(int_start, int_end - int_start);
+    canonical.append(frac_start, frac_end - frac_start);
+    char exponent_buf[32];
+    snprintf(exponent_buf,
+             sizeof(exponent_buf),
+             "e%lld",
+             (long long)(explicit_exponent - (frac_end - frac_start)));
+    canonical += exponent_buf;
+    return strtod(canonical.c_str(), nullptr);
+}
+
+double negate_if(bool is_negative, double value) { return is_negative ? -value : value; }
+
+} // namespace
+
+Expected<uint64_t, ParseError> parse_integer_magnitude(CStringView text, int base, bool &is_negative) {
+    if(base < 2 || base > 36) {
+        throw PyException("Integer base must be between 2 and 36.");
+    }
+    const char *i = text.data();
+    const char *const end = i + text.size();
+    is_negative = false;
+    if(i == end) {
+        return ParseError::Empty;
+    }
+    if(*i == '+' || *i == '-') {
+        is_negative = *i == '-';
+        ++i;
+    }
+    if(i == end) {
+        return ParseError::InvalidCharacter;
+    }
+    uint64_t value = 0;
+    if(base == 10) {
+        // 10^19 is the largest power of ten that fits, so up to
+        // 16 digits can be consumed in blocks without overflow.
+        while(end - i >= 8 && value < 100000000) {
+            const uint64_t word = load_digits(i);
+            if(!is_eight_digits(word)) {
+                break;
+            }
+            value = 100000000 * value + parse_eight_digits(word);
+            i += 8;
+        }
+    }
+    for(; i != end; ++i) {
+        const int digit = digit_value(*i);
+        if(digit >= base) {
+            return ParseError::InvalidCharacter;
+        }
+        if(value > (UINT64_MAX - digit) / base) {
+            // Report bad characters before overflow.
+            for(++i; i != end; ++i) {
+                if(digit_value(*i) >= base) {
+                    return ParseError::InvalidCharacter;
+                }
+            }
+            return ParseError::OutOfRange;
+        }
+        value = value * base + digit;
+    }
+    return value;
+}
+
+Expected<double, ParseError> parse_float(CStringView text) {
+    const char *i = text.data();
+    const char *const end = i + text.size();
+    if(i == end) {
+        return ParseError::Empty;
+    }
+    bool is_negative = false;
+    if(*i == '+' || *i == '-') {
+        is_negative = *i == '-';
+        ++i;
+    }
+    const size_t remaining = end - i;
+    if(equals_ignoring_ascii_case(i, remaining, "inf") ||
+       equals_ignoring_ascii_case(i, remaining, "infinity")) {
+        return negate_if(is_negative, INFINITY);
+    }
+    if(equals_ignoring_ascii_case(i, remaining, "nan")) {
+        return negate_if(is_negative, NAN);
+    }
+
+    ParsedDecimal decimal;
+    const char *const int_start = i;
+    i = parse_digit_run(decimal, i, end, false);
+    const char *const int_end = i;
+    const char *frac_start = i;
+    const char *frac_end = i;
+    if(i != end && *i == '.') {
+        frac_start = i + 1;
+        i = parse_digit_run(decimal, frac_start, end, true);
+        frac_end = i;
+    }
+    if(int_start == int_end && frac_start == frac_end) {
+        return ParseError::InvalidCharacter;
+    }
+    int64_t explicit_exponent = 0;
+    if(i != end && (*i == 'e' || *i == 'E')) {
+        ++i;
+        bool exponent_is_negative = false;
+        if(i != end && (*i == '+' || *i == '-')) {
+            exponent_is_negative = *i == '-';
+            ++i;
+        }
+        if(i == end || !is_digit(*i)) {
+            return ParseError::InvalidCharacter;
+        }
+        for(; i != end && is_digit(*i); ++i) {
+            if(explicit_exponent < MAX_PARSED_EXPONENT) {
+                explicit_exponent = 10 * explicit_exponent + (*i - '0');
+            }
+        }
+        if(exponent_is_negative) {
+            explicit_exponent = -explicit_exponent;
+        }
+    }
+    if(i != end) {
+        return ParseError::InvalidCharacter;
+    }
+    decimal.exponent += explicit_exponent;
+
+    if(!decimal.truncated && decimal.mantissa <= (uint64_t(1) << 53) && decimal.exponent >= -22 &&
+       decimal.exponent <= 22) {
+        // Both operands are exact so IEEE arithmetic rounds correctly.
+        double value = double(decimal.mantissa);
+        if(decimal.exponent < 0) {
+            value /= exact_powers_of_ten[-decimal.exponent];
+        } else {
+            value *= exact_powers_of_ten[decimal.exponent];
+        }
+        return negate_if(is_negative, value);
+    }
+    uint64_t bits;
+    if(eisel_lemire(decimal.mantissa, decimal.exponent, bits)) {
+        uint64_t upper_bits;
+        // With dropped digits the value is between mantissa and
+        // mantissa + 1, both must round the same way.
+        if(!decimal.truncated ||
+           (eisel_lemire(decimal.mantissa + 1, decimal.exponent, upper_bits) &&
+            bits == upper_bits)) {
+            double value;
+            memcpy(&value, &bits, sizeof(value));
+            return negate_if(is_negative, value);
+        }
+    }
+    return negate_if(is_negative,
+                     parse_float_fallback(int_start, int_end, frac_start, frac_end, explicit_exponent));
 }
 
 CString cformat(const char *format, ...) {
@@ -1334,13 +2604,6 @@ int64_t clamp(int64_t val, int64_t lower, int64_t upper) {
 }
 
 struct UnicodeCharComparator {
-    int compare(const UnicodeConversionSingleChar &trial, uint32_t cp) const noexcept {
-        return DefaultComparator<uint32_t>{}.compare(trial.from_codepoint, cp);
-    }
-    bool equal(const UnicodeConversionSingleChar &trial, uint32_t cp) const noexcept {
-        return trial.from_codepoint == cp;
-    }
-
     int compare(const UnicodeConversionMultiChar &trial, uint32_t cp) const noexcept {
         return DefaultComparator<uint32_t>{}.compare(trial.codepoint, cp);
     }
@@ -1349,68 +2612,113 @@ struct UnicodeCharComparator {
     }
 };
 
+namespace {
+
+uint32_t case_mapping_delta_index(uint32_t codepoint,
+                                  uint32_t num_codepoints,
+                                  const uint8_t *stage1,
+                                  const uint8_t *stage2) {
+    if(codepoint >= num_codepoints) {
+        return 0;
+    }
+    const uint32_t block = stage1[codepoint >> CASE_MAPPING_BLOCK_SHIFT];
+    return stage2[(block << CASE_MAPPING_BLOCK_SHIFT) + (codepoint & CASE_MAPPING_BLOCK_MASK)];
+}
+
+} // namespace
+
 UnicodeConversionResult uppercase_unicode(uint32_t codepoint) {
+    UnicodeConversionResult r;
+    memset(&r, 0, sizeof(UnicodeConversionResult));
     if(codepoint < 128) {
-        UnicodeConversionResult r;
-        memset(&r, 0, sizeof(UnicodeConversionResult));
         r.codepoints[0] = toupper(codepoint);
         return r;
     }
-    auto mit = lower_bound(uppercasing_multi,
-                           uppercasing_multi + NUM_UPPERCASING_MULTICHAR_ENTRIES,
-                           codepoint,
-                           UnicodeCharComparator{});
-    if(mit != uppercasing_multi + NUM_UPPERCASING_MULTICHAR_ENTRIES) {
-        if(mit->codepoint == codepoint) {
-            return mit->converted;
-        }
-    }
-
-    UnicodeConversionResult r;
-    memset(&r, 0, sizeof(UnicodeConversionResult));
-    auto sit = lower_bound(uppercasing_single,
-                           uppercasing_single + NUM_UPPERCASING_SINGLECHAR_ENTRIES,
-                           codepoint,
-                           UnicodeCharComparator{});
-    if(sit != uppercasing_single + NUM_UPPERCASING_SINGLECHAR_ENTRIES) {
-        if(sit->from_codepoint == codepoint) {
-            r.codepoints[0] = sit->to_codepoint;
-            return r;
-        }
-    }
-    // Letter has no upper case form, return itself.
-    r.codepoints[0] = codepoint;
+    const auto delta_index = case_mapping_delta_index(
+        codepoint, UPPERCASING_NUM_CODEPOINTS, uppercasing_stage1, uppercasing_stage2);
+    if(delta_index == CASE_MAPPING_MULTICHAR) {
+        auto mit = lower_bound(uppercasing_multi,
+                               uppercasing_multi + NUM_UPPERCASING_MULTICHAR_ENTRIES,
+                               codepoint,
+                               UnicodeCharComparator{});
+        assert(mit != uppercasing_multi + NUM_UPPERCASING_MULTICHAR_ENTRIES);
+        assert(mit->codepoint == codepoint);
+        return mit->converted;
+    }
+    // Letters with no upper case form have a zero delta.
+    r.codepoints[0] = codepoint + uppercasing_deltas[delta_index];
     return r;
 }
 
 UnicodeConversionResult lowercase_unicode(uint32_t codepoint) {
+    UnicodeConversionResult r;
+    memset(&r, 0, sizeof(UnicodeConversionResult));
     if(codepoint < 128) {
-        UnicodeConversionResult r;
-        memset(&r, 0, sizeof(UnicodeConversionResult));
         r.codepoints[0] = tolower(codepoint);
         return r;
     }
-
-    static_assert(NUM_LOWERCASING_MULTICHAR_ENTRIES == 1);
-    if(lowercasing_multi[0].codepoint == codepoint) {
+    const auto delta_index = case_mapping_delta_index(
+        codepoint, LOWERCASING_NUM_CODEPOINTS, lowercasing_stage1, lowercasing_stage2);
+    if(delta_index == CASE_MAPPING_MULTICHAR) {
+        static_assert(NUM_LOWERCASING_MULTICHAR_ENTRIES == 1);
+        assert(lowercasing_multi[0].codepoint == codepoint);
         return lowercasing_multi[0].converted;
     }
-    UnicodeConversionResult r;
-    memset(&r, 0, sizeof(UnicodeConversionResult));
+    // Letters with no lower case form have a zero delta.
+    r.codepoints[0] = codepoint + lowercasing_deltas[delta_index];
+    return r;
+}
 
-    auto sit = lower_bound(lowercasing_single,
-                           lowercasing_single + NUM_LOWERCASING_SINGLECHAR_ENTRIES,
-                           codepoint,
-                           UnicodeCharComparator{});
-    if(sit != lowercasing_single + NUM_LOWERCASING_SINGLECHAR_ENTRIES) {
-        if(sit->from_codepoint == codepoint) {
-            r.codepoints[0] = sit->to_codepoint;
-            return r;
-        }
+uint32_t casefold_unicode(uint32_t codepoint) {
+    if(codepoint < 128) {
+        return ascii_lower(codepoint);
     }
-    // Letter has no lower case form, return itself.
-    r.codepoints[0] = codepoint;
-    return r;
+    // Going through upper case maps variants like final sigma and
+    // long s to the same letter. Multi codepoint mappings are not
+    // simple folds, so they leave the codepoint as is.
+    const uint32_t dotless_i = 0x131;
+    if(codepoint == dotless_i) {
+        // Its upper case form is I, but it does not fold to i.
+        return codepoint;
+    }
+    const auto upper = uppercase_unicode(codepoint);
+    const uint32_t folded = upper.codepoints[1] == 0 ? upper.codepoints[0] : codepoint;
+    const auto lower = lowercase_unicode(folded);
+    return lower.codepoints[1] == 0 ? lower.codepoints[0] : folded;
+}
+
+namespace {
+
+uint8_t unicode_properties(uint32_t codepoint) {
+    if(codepoint >= 0x110000) {
+        return (uint8_t)UnicodeCategory::Cn;
+    }
+    const uint32_t stage2_block = unicode_property_stage1[codepoint >> UNICODE_PROPERTY_STAGE1_SHIFT];
+    const uint32_t stage2_index =
+        (stage2_block << (UNICODE_PROPERTY_STAGE1_SHIFT - UNICODE_PROPERTY_STAGE2_SHIFT)) +
+        ((codepoint >> UNICODE_PROPERTY_STAGE2_SHIFT) &
+         ((1 << (UNICODE_PROPERTY_STAGE1_SHIFT - UNICODE_PROPERTY_STAGE2_SHIFT)) - 1));
+    const uint32_t stage3_block = unicode_property_stage2[stage2_index];
+    return unicode_property_stage3[(stage3_block << UNICODE_PROPERTY_STAGE2_SHIFT) +
+                                   (codepoint & ((1 << UNICODE_PROPERTY_STAGE2_SHIFT) - 1))];
+}
+
+} // namespace
+
+UnicodeCategory unicode_category(uint32_t codepoint) noexcept {
+    return UnicodeCategory(unicode_properties(codepoint) & UNICODE_PROPERTY_CATEGORY_MASK);
+}
+
+bool is_unicode_whitespace(uint32_t codepoint) noexcept {
+    return unicode_properties(codepoint) & UNICODE_PROPERTY_WHITESPACE_BIT;
+}
+
+bool is_unicode_alpha(uint32_t codepoint) noexcept {
+    return unicode_category(codepoint) <= UnicodeCategory::Lo;
+}
+
+bool is_unicode_numeric(uint32_t codepoint) noexcept {
+    return unicode_properties(codepoint) & UNICODE_PROPERTY_NUMERIC_BIT;
 }
 
 int total_order_compare(float a, float b) noexcept {
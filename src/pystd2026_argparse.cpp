@@ -2,7 +2,6 @@
 // Copyright 2025 Jussi Pakkanen
 
 #include <pystd2026_argparse.hpp>
-#include <errno.h>
 #include <assert.h>
 
 namespace pystd2026 {
@@ -83,13 +82,11 @@ static void update_value(const Argument &atype, ArgValue &vobj, CStringView sour
         case ArgumentType::Boolean:
             break;
         case ArgumentType::Integer: {
-            // FIXME, needed for null terminator.
-            CString tmp(source);
-            errno = 0;
-            int64_t intval = strtol(tmp.data(), nullptr, 10);
-            if(errno != 0) {
-                throw PyException(strerror(errno));
+            auto parsed = parse_int<int64_t>(source);
+            if(!parsed) {
+                throw PyException("Argument value is not a valid integer.");
             }
+            const int64_t intval = parsed.value();
             if(atype.minval && intval < atype.minval.value()) {
                 throw PyException("Argument value less than min value.");
             }
@@ -4,6 +4,9 @@
 #include <pystd2026.hpp>
 #include <sys/stat.h>
 #include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
 #include <assert.h>
 
 // Currently does only Posix paths.
@@ -162,30 +165,58 @@ Path Path::filename() const {
 
 Vector<CString> Path::split() const { return buf.split_by('/'); }
 
-Optional<Bytes> Path::load_bytes() {
-    FILE *f = fopen(buf.c_str(), "rb");
-    if(!f) {
+namespace {
+
+// Regular files are read with an exactly sized buffer. Others, such as
+// pipes and files in /proc, report a size of zero and are read until
+// the end. The extra capacity lets load_text add its terminator
+// without reallocating.
+Optional<Bytes> read_whole_file(const char *path, size_t extra_capacity) {
+    const int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if(fd < 0) {
         return Optional<Bytes>();
     }
-    fseek(f, 0, SEEK_END);
-    const auto file_size = ftell(f);
-    fseek(f, 0, SEEK_SET);
-    Bytes contents;
-    contents.resize_to(file_size);
-    auto bytes_read = fread(contents.data(), 1, file_size, f);
-    if(ferror(f) != 0) {
-        fclose(f);
+    struct stat st;
+    if(fstat(fd, &st) != 0) {
+        close(fd);
         return Optional<Bytes>();
     }
-    fclose(f);
-    if(bytes_read != (size_t)file_size) {
+    const bool size_is_known = S_ISREG(st.st_mode) && st.st_size > 0;
+    const size_t expected_size = size_is_known ? (size_t)st.st_size : 0;
+    Bytes contents(expected_size + extra_capacity);
+    contents.resize_to(expected_size);
+    size_t bytes_read = 0;
+    while(!size_is_known || bytes_read < expected_size) {
+        if(bytes_read == contents.size()) {
+            contents.resize_to(bytes_read < 4096 ? 4096 : 2 * bytes_read);
+        }
+        const ssize_t rc = read(fd, contents.data() + bytes_read, contents.size() - bytes_read);
+        if(rc < 0) {
+            if(errno == EINTR) {
+                continue;
+            }
+            close(fd);
+            return Optional<Bytes>();
+        }
+        if(rc == 0) {
+            break;
+        }
+        bytes_read += (size_t)rc;
+    }
+    close(fd);
+    if(size_is_known && bytes_read != expected_size) {
         return Optional<Bytes>();
     }
+    contents.resize_to(bytes_read);
     return Optional<Bytes>(move(contents));
 }
 
+} // namespace
+
+Optional<Bytes> Path::load_bytes() { return read_whole_file(buf.c_str(), 0); }
+
 Optional<U8String> Path::load_text() {
-    auto raw = load_bytes();
+    auto raw = read_whole_file(buf.c_str(), 1);
     if(!raw) {
         return Optional<U8String>();
     }
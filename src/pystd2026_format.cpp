@@ -0,0 +1,324 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 Jussi Pakkanen
+
+#include <pystd2026_format.hpp>
+#include <pystd2026_tables.hpp>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+namespace pystd2026 {
+
+namespace {
+
+const char digit_pairs[] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+// Writes the digits so that they end at buf_end, returns the start.
+char *write_decimal_backwards(char *buf_end, uint64_t value) {
+    while(value >= 100) {
+        const size_t pair = 2 * (value % 100);
+        value /= 100;
+        buf_end -= 2;
+        memcpy(buf_end, digit_pairs + pair, 2);
+    }
+    if(value >= 10) {
+        buf_end -= 2;
+        memcpy(buf_end, digit_pairs + 2 * value, 2);
+    } else {
+        *--buf_end = char('0' + value);
+    }
+    return buf_end;
+}
+
+char *write_power_of_two_backwards(char *buf_end, uint64_t value, int bits, bool uppercase) {
+    const char *digits = uppercase ? "0123456789ABCDEF" : "0123456789abcdef";
+    const uint64_t mask = (uint64_t(1) << bits) - 1;
+    do {
+        *--buf_end = digits[value & mask];
+        value >>= bits;
+    } while(value != 0);
+    return buf_end;
+}
+
+char *write_sign(char *out, bool is_negative, const FormatSpec &spec) {
+    if(is_negative) {
+        *out++ = '-';
+    } else if(spec.sign == '+' || spec.sign == ' ') {
+        *out++ = spec.sign;
+    }
+    return out;
+}
+
+// Shortest float to decimal conversion with the Schubfach algorithm
+// by Raffaello Giulietti, "The Schubfach way to render doubles". The
+// result is the shortest decimal that parses back to the same value,
+// and the closest one if there are several.
+
+struct Uint128 {
+    uint64_t high;
+    uint64_t low;
+};
+
+Uint128 multiply_64x64(uint64_t a, uint64_t b) {
+    const uint64_t low_mask = 0xFFFFFFFF;
+    const uint64_t ah = a >> 32;
+    const uint64_t al = a & low_mask;
+    const uint64_t bh = b >> 32;
+    const uint64_t bl = b & low_mask;
+    const uint64_t ll = al * bl;
+    const uint64_t lh = al * bh;
+    const uint64_t hl = ah * bl;
+    const uint64_t hh = ah * bh;
+    const uint64_t middle = (ll >> 32) + (lh & low_mask) + (hl & low_mask);
+    return Uint128{hh + (lh >> 32) + (hl >> 32) + (middle >> 32), (middle << 32) | (ll & low_mask)};
+}
+
+// The upper 64 bits of g * cp, with the lowest bit set if any
+// of the discarded bits are.
+uint64_t round_to_odd(const Pow10Entry &g, uint64_t cp) {
+    const Uint128 x = multiply_64x64(g.low, cp);
+    const Uint128 y = multiply_64x64(g.high, cp);
+    const uint64_t z = y.low + x.high;
+    const uint64_t carry = z < y.low ? 1 : 0;
+    return (y.high + carry) | (z > 1 ? 1 : 0);
+}
+
+// floor(log10(2^e)), or floor(log10(3/4 * 2^e)). The
+// shift of negative numbers must round down.
+int floor_log10_pow2(int e, bool three_quarters) {
+    return (e * 1262611 - (three_quarters ? 524031 : 0)) >> 22;
+}
+
+// floor(log2(10^e)).
+int floor_log2_pow10(int e) { return (e * 1741647) >> 19; }
+
+struct DecimalFloat {
+    uint64_t digits;
+    int exponent;
+};
+
+// Value must be finite and positive.
+DecimalFloat to_shortest_decimal(double value) {
+    const uint64_t hidden_bit = uint64_t(1) << 52;
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    const uint64_t ieee_significand = bits & (hidden_bit - 1);
+    const int ieee_exponent = int(bits >> 52);
+
+    uint64_t c;
+    int q;
+    if(ieee_exponent != 0) {
+        c = hidden_bit | ieee_significand;
+        q = ieee_exponent - 1075;
+        // Small integers are exact.
+        if(q <= 0 && -q < 53 && (c & ((uint64_t(1) << -q) - 1)) == 0) {
+            return DecimalFloat{c >> -q, 0};
+        }
+    } else {
+        c = ieee_significand;
+        q = -1074;
+    }
+
+    const bool is_even = c % 2 == 0;
+    const bool lower_boundary_is_closer = ieee_significand == 0 && ieee_exponent > 1;
+
+    const uint64_t cbl = 4 * c - 2 + (lower_boundary_is_closer ? 1 : 0);
+    const uint64_t cb = 4 * c;
+    const uint64_t cbr = 4 * c + 2;
+
+    const int k = floor_log10_pow2(q, lower_boundary_is_closer);
+    const int h = q + floor_log2_pow10(-k) + 1;
+    const Pow10Entry &pow10 = pow10_significands[-k - POW10_MIN_EXPONENT];
+    const uint64_t vbl = round_to_odd(pow10, cbl << h);
+    const uint64_t vb = round_to_odd(pow10, cb << h);
+    const uint64_t vbr = round_to_odd(pow10, cbr << h);
+
+    const uint64_t lower = vbl + (is_even ? 0 : 1);
+    const uint64_t upper = vbr - (is_even ? 0 : 1);
+
+    const uint64_t s = vb / 4;
+    if(s >= 10) {
+        const uint64_t sp = s / 10;
+        const bool up_inside = lower <= 40 * sp;
+        const bool wp_inside = 40 * sp + 40 <= upper;
+        if(up_inside != wp_inside) {
+            return DecimalFloat{sp + (wp_inside ? 1 : 0), k + 1};
+        }
+    }
+    const bool u_inside = lower <= 4 * s;
+    const bool w_inside = 4 * s + 4 <= upper;
+    if(u_inside != w_inside) {
+        return DecimalFloat{s + (w_inside ? 1 : 0), k};
+    }
+    const uint64_t mid = 4 * s + 2;
+    const bool round_up = vb > mid || (vb == mid && (s & 1) != 0);
+    return DecimalFloat{s + (round_up ? 1 : 0), k};
+}
+
+char *write_exponent(char *out, int exponent) {
+    *out++ = 'e';
+    if(exponent < 0) {
+        *out++ = '-';
+        exponent = -exponent;
+    } else {
+        *out++ = '+';
+    }
+    if(exponent < 10) {
+        *out++ = '0';
+    }
+    char buf[4];
+    char *start = write_decimal_backwards(buf + sizeof(buf), exponent);
+    const size_t size = buf + sizeof(buf) - start;
+    memcpy(out, start, size);
+    return out + size;
+}
+
+// Same output as Python's repr.
+char *write_shortest(char *out, double value) {
+    if(value == 0) {
+        memcpy(out, "0.0", 3);
+        return out + 3;
+    }
+    DecimalFloat decimal = to_shortest_decimal(value);
+    while(decimal.digits % 10 == 0) {
+        decimal.digits /= 10;
+        ++decimal.exponent;
+    }
+    char digit_buf[20];
+    const char *digits = write_decimal_backwards(digit_buf + sizeof(digit_buf), decimal.digits);
+    const int num_digits = int(digit_buf + sizeof(digit_buf) - digits);
+    const int decimal_exponent = decimal.exponent;
+    // The exponent of the first digit in scientific notation.
+    const int exponent = num_digits + decimal_exponent - 1;
+    if(exponent < -4 || exponent >= 16) {
+        *out++ = digits[0];
+        if(num_digits > 1) {
+            *out++ = '.';
+            memcpy(out, digits + 1, num_digits - 1);
+            out += num_digits - 1;
+        }
+        return write_exponent(out, exponent);
+    }
+    if(exponent < 0) {
+        *out++ = '0';
+        *out++ = '.';
+        for(int i = 0; i < -exponent - 1; ++i) {
+            *out++ = '0';
+        }
+        memcpy(out, digits, num_digits);
+        return out + num_digits;
+    }
+    const int integral_digits = exponent + 1;
+    if(num_digits <= integral_digits) {
+        memcpy(out, digits, num_digits);
+        out += num_digits;
+        for(int i = num_digits; i < integral_digits; ++i) {
+            *out++ = '0';
+        }
+        memcpy(out, ".0", 2);
+        return out + 2;
+    }
+    memcpy(out, digits, integral_digits);
+    out += integral_digits;
+    *out++ = '.';
+    memcpy(out, digits + integral_digits, num_digits - integral_digits);
+    return out + num_digits - integral_digits;
+}
+
+} // namespace
+
+void format_string_error(const char *message) { internal_failure(message); }
+
+void format_integer(FormattedNumber &result,
+                    uint64_t magnitude,
+                    bool is_negative,
+                    const FormatSpec &spec) {
+    char digits[64];
+    char *const digits_end = digits + sizeof(digits);
+    char *digits_start;
+    const char *base_prefix = nullptr;
+    switch(spec.type) {
+    case 'b':
+        digits_start = write_power_of_two_backwards(digits_end, magnitude, 1, false);
+        base_prefix = "0b";
+        break;
+    case 'o':
+        digits_start = write_power_of_two_backwards(digits_end, magnitude, 3, false);
+        base_prefix = "0o";
+        break;
+    case 'x':
+        digits_start = write_power_of_two_backwards(digits_end, magnitude, 4, false);
+        base_prefix = "0x";
+        break;
+    case 'X':
+        digits_start = write_power_of_two_backwards(digits_end, magnitude, 4, true);
+        base_prefix = "0X";
+        break;
+    default:
+        digits_start = write_decimal_backwards(digits_end, magnitude);
+        break;
+    }
+    char *out = write_sign(result.buf, is_negative, spec);
+    if(spec.alternate && base_prefix) {
+        memcpy(out, base_prefix, 2);
+        out += 2;
+    }
+    result.prefix_size = uint32_t(out - result.buf);
+    const size_t num_digits = digits_end - digits_start;
+    memcpy(out, digits_start, num_digits);
+    result.size = uint32_t(out + num_digits - result.buf);
+}
+
+void format_float(FormattedNumber &result, double value, const FormatSpec &spec) {
+    if(spec.type == 0 && spec.precision < 0) {
+        char *out = write_sign(result.buf, signbit(value) && !isnan(value), spec);
+        result.prefix_size = uint32_t(out - result.buf);
+        if(isnan(value)) {
+            memcpy(out, "nan", 3);
+            out += 3;
+        } else if(isinf(value)) {
+            memcpy(out, "inf", 3);
+            out += 3;
+        } else {
+            out = write_shortest(out, fabs(value));
+        }
+        result.size = uint32_t(out - result.buf);
+        return;
+    }
+
+    // Fixed precision needs exact decimal conversion, which libc
+    // does for one number at a time well enough.
+    char printf_format[8];
+    char *f = printf_format;
+    *f++ = '%';
+    if(spec.sign == '+' || spec.sign == ' ') {
+        *f++ = spec.sign;
+    }
+    if(spec.alternate) {
+        *f++ = '#';
+    }
+    *f++ = '.';
+    *f++ = '*';
+    *f++ = spec.type == 0 ? 'g' : (spec.type == '%' ? 'f' : spec.type);
+    *f = '\0';
+    const int precision = spec.precision < 0 ? 6 : spec.precision;
+    const double printed = spec.type == '%' ? value * 100 : value;
+    const int rc =
+        snprintf(result.buf, sizeof(result.buf) - 1, printf_format, precision, printed);
+    if(rc < 0 || size_t(rc) >= sizeof(result.buf) - 1) {
+        internal_failure("Formatted floating point number does not fit its buffer.");
+    }
+    result.size = uint32_t(rc);
+    if(spec.type == '%') {
+        result.buf[result.size++] = '%';
+    }
+    const char first = result.buf[0];
+    result.prefix_size = (first == '-' || first == '+' || first == ' ') ? 1 : 0;
+}
+
+} // namespace pystd2026
@@ -5,6 +5,7 @@
 
 namespace pystd2026 {
 
+// Generated with tools/genupper.py.
 // clang-format off
 const UnicodeConversionMultiChar uppercasing_multi[NUM_UPPERCASING_MULTICHAR_ENTRIES] = {
     {223, {83, 83, 0}},
@@ -109,2824 +110,3111 @@ const UnicodeConversionMultiChar uppercasing_multi[NUM_UPPERCASING_MULTICHAR_ENT
     {64277, {1348, 1339, 0}},
     {64278, {1358, 1350, 0}},
     {64279, {1348, 1341, 0}},
-    };
-// clang-format on
+};
 
-// clang-format off
-const UnicodeConversionSingleChar uppercasing_single[NUM_UPPERCASING_SINGLECHAR_ENTRIES] = {
-    {181, 924},
-    {224, 192},
-    {225, 193},
-    {226, 194},
-    {227, 195},
-    {228, 196},
-    {229, 197},
-    {230, 198},
-    {231, 199},
-    {232, 200},
-    {233, 201},
-    {234, 202},
-    {235, 203},
-    {236, 204},
-    {237, 205},
-    {238, 206},
-    {239, 207},
-    {240, 208},
-    {241, 209},
-    {242, 210},
-    {243, 211},
-    {244, 212},
-    {245, 213},
-    {246, 214},
-    {248, 216},
-    {249, 217},
-    {250, 218},
-    {251, 219},
-    {252, 220},
-    {253, 221},
-    {254, 222},
-    {255, 376},
-    {257, 256},
-    {259, 258},
-    {261, 260},
-    {263, 262},
-    {265, 264},
-    {267, 266},
-    {269, 268},
-    {271, 270},
-    {273, 272},
-    {275, 274},
-    {277, 276},
-    {279, 278},
-    {281, 280},
-    {283, 282},
-    {285, 284},
-    {287, 286},
-    {289, 288},
-    {291, 290},
-    {293, 292},
-    {295, 294},
-    {297, 296},
-    {299, 298},
-    {301, 300},
-    {303, 302},
-    {305, 73},
-    {307, 306},
-    {309, 308},
-    {311, 310},
-    {314, 313},
-    {316, 315},
-    {318, 317},
-    {320, 319},
-    {322, 321},
-    {324, 323},
-    {326, 325},
-    {328, 327},
-    {331, 330},
-    {333, 332},
-    {335, 334},
-    {337, 336},
-    {339, 338},
-    {341, 340},
-    {343, 342},
-    {345, 344},
-    {347, 346},
-    {349, 348},
-    {351, 350},
-    {353, 352},
-    {355, 354},
-    {357, 356},
-    {359, 358},
-    {361, 360},
-    {363, 362},
-    {365, 364},
-    {367, 366},
-    {369, 368},
-    {371, 370},
-    {373, 372},
-    {375, 374},
-    {378, 377},
-    {380, 379},
-    {382, 381},
-    {383, 83},
-    {384, 579},
-    {387, 386},
-    {389, 388},
-    {392, 391},
-    {396, 395},
-    {402, 401},
-    {405, 502},
-    {409, 408},
-    {410, 573},
-    {414, 544},
-    {417, 416},
-    {419, 418},
-    {421, 420},
-    {424, 423},
-    {429, 428},
-    {432, 431},
-    {436, 435},
-    {438, 437},
-    {441, 440},
-    {445, 444},
-    {447, 503},
-    {453, 452},
-    {454, 452},
-    {456, 455},
-    {457, 455},
-    {459, 458},
-    {460, 458},
-    {462, 461},
-    {464, 463},
-    {466, 465},
-    {468, 467},
-    {470, 469},
-    {472, 471},
-    {474, 473},
-    {476, 475},
-    {477, 398},
-    {479, 478},
-    {481, 480},
-    {483, 482},
-    {485, 484},
-    {487, 486},
-    {489, 488},
-    {491, 490},
-    {493, 492},
-    {495, 494},
-    {498, 497},
-    {499, 497},
-    {501, 500},
-    {505, 504},
-    {507, 506},
-    {509, 508},
-    {511, 510},
-    {513, 512},
-    {515, 514},
-    {517, 516},
-    {519, 518},
-    {521, 520},
-    {523, 522},
-    {525, 524},
-    {527, 526},
-    {529, 528},
-    {531, 530},
-    {533, 532},
-    {535, 534},
-    {537, 536},
-    {539, 538},
-    {541, 540},
-    {543, 542},
-    {547, 546},
-    {549, 548},
-    {551, 550},
-    {553, 552},
-    {555, 554},
-    {557, 556},
-    {559, 558},
-    {561, 560},
-    {563, 562},
-    {572, 571},
-    {575, 11390},
-    {576, 11391},
-    {578, 577},
-    {583, 582},
-    {585, 584},
-    {587, 586},
-    {589, 588},
-    {591, 590},
-    {592, 11375},
-    {593, 11373},
-    {594, 11376},
-    {595, 385},
-    {596, 390},
-    {598, 393},
-    {599, 394},
-    {601, 399},
-    {603, 400},
-    {604, 42923},
-    {608, 403},
-    {609, 42924},
-    {611, 404},
-    {613, 42893},
-    {614, 42922},
-    {616, 407},
-    {617, 406},
-    {618, 42926},
-    {619, 11362},
-    {620, 42925},
-    {623, 412},
-    {625, 11374},
-    {626, 413},
-    {629, 415},
-    {637, 11364},
-    {640, 422},
-    {642, 42949},
-    {643, 425},
-    {647, 42929},
-    {648, 430},
-    {649, 580},
-    {650, 433},
-    {651, 434},
-    {652, 581},
-    {658, 439},
-    {669, 42930},
-    {670, 42928},
-    {837, 921},
-    {881, 880},
-    {883, 882},
-    {887, 886},
-    {891, 1021},
-    {892, 1022},
-    {893, 1023},
-    {940, 902},
-    {941, 904},
-    {942, 905},
-    {943, 906},
-    {945, 913},
-    {946, 914},
-    {947, 915},
-    {948, 916},
-    {949, 917},
-    {950, 918},
-    {951, 919},
-    {952, 920},
-    {953, 921},
-    {954, 922},
-    {955, 923},
-    {956, 924},
-    {957, 925},
-    {958, 926},
-    {959, 927},
-    {960, 928},
-    {961, 929},
-    {962, 931},
-    {963, 931},
-    {964, 932},
-    {965, 933},
-    {966, 934},
-    {967, 935},
-    {968, 936},
-    {969, 937},
-    {970, 938},
-    {971, 939},
-    {972, 908},
-    {973, 910},
-    {974, 911},
-    {976, 914},
-    {977, 920},
-    {981, 934},
-    {982, 928},
-    {983, 975},
-    {985, 984},
-    {987, 986},
-    {989, 988},
-    {991, 990},
-    {993, 992},
-    {995, 994},
-    {997, 996},
-    {999, 998},
-    {1001, 1000},
-    {1003, 1002},
-    {1005, 1004},
-    {1007, 1006},
-    {1008, 922},
-    {1009, 929},
-    {1010, 1017},
-    {1011, 895},
-    {1013, 917},
-    {1016, 1015},
-    {1019, 1018},
-    {1072, 1040},
-    {1073, 1041},
-    {1074, 1042},
-    {1075, 1043},
-    {1076, 1044},
-    {1077, 1045},
-    {1078, 1046},
-    {1079, 1047},
-    {1080, 1048},
-    {1081, 1049},
-    {1082, 1050},
-    {1083, 1051},
-    {1084, 1052},
-    {1085, 1053},
-    {1086, 1054},
-    {1087, 1055},
-    {1088, 1056},
-    {1089, 1057},
-    {1090, 1058},
-    {1091, 1059},
-    {1092, 1060},
-    {1093, 1061},
-    {1094, 1062},
-    {1095, 1063},
-    {1096, 1064},
-    {1097, 1065},
-    {1098, 1066},
-    {1099, 1067},
-    {1100, 1068},
-    {1101, 1069},
-    {1102, 1070},
-    {1103, 1071},
-    {1104, 1024},
-    {1105, 1025},
-    {1106, 1026},
-    {1107, 1027},
-    {1108, 1028},
-    {1109, 1029},
-    {1110, 1030},
-    {1111, 1031},
-    {1112, 1032},
-    {1113, 1033},
-    {1114, 1034},
-    {1115, 1035},
-    {1116, 1036},
-    {1117, 1037},
-    {1118, 1038},
-    {1119, 1039},
-    {1121, 1120},
-    {1123, 1122},
-    {1125, 1124},
-    {1127, 1126},
-    {1129, 1128},
-    {1131, 1130},
-    {1133, 1132},
-    {1135, 1134},
-    {1137, 1136},
-    {1139, 1138},
-    {1141, 1140},
-    {1143, 1142},
-    {1145, 1144},
-    {1147, 1146},
-    {1149, 1148},
-    {1151, 1150},
-    {1153, 1152},
-    {1163, 1162},
-    {1165, 1164},
-    {1167, 1166},
-    {1169, 1168},
-    {1171, 1170},
-    {1173, 1172},
-    {1175, 1174},
-    {1177, 1176},
-    {1179, 1178},
-    {1181, 1180},
-    {1183, 1182},
-    {1185, 1184},
-    {1187, 1186},
-    {1189, 1188},
-    {1191, 1190},
-    {1193, 1192},
-    {1195, 1194},
-    {1197, 1196},
-    {1199, 1198},
-    {1201, 1200},
-    {1203, 1202},
-    {1205, 1204},
-    {1207, 1206},
-    {1209, 1208},
-    {1211, 1210},
-    {1213, 1212},
-    {1215, 1214},
-    {1218, 1217},
-    {1220, 1219},
-    {1222, 1221},
-    {1224, 1223},
-    {1226, 1225},
-    {1228, 1227},
-    {1230, 1229},
-    {1231, 1216},
-    {1233, 1232},
-    {1235, 1234},
-    {1237, 1236},
-    {1239, 1238},
-    {1241, 1240},
-    {1243, 1242},
-    {1245, 1244},
-    {1247, 1246},
-    {1249, 1248},
-    {1251, 1250},
-    {1253, 1252},
-    {1255, 1254},
-    {1257, 1256},
-    {1259, 1258},
-    {1261, 1260},
-    {1263, 1262},
-    {1265, 1264},
-    {1267, 1266},
-    {1269, 1268},
-    {1271, 1270},
-    {1273, 1272},
-    {1275, 1274},
-    {1277, 1276},
-    {1279, 1278},
-    {1281, 1280},
-    {1283, 1282},
-    {1285, 1284},
-    {1287, 1286},
-    {1289, 1288},
-    {1291, 1290},
-    {1293, 1292},
-    {1295, 1294},
-    {1297, 1296},
-    {1299, 1298},
-    {1301, 1300},
-    {1303, 1302},
-    {1305, 1304},
-    {1307, 1306},
-    {1309, 1308},
-    {1311, 1310},
-    {1313, 1312},
-    {1315, 1314},
-    {1317, 1316},
-    {1319, 1318},
-    {1321, 1320},
-    {1323, 1322},
-    {1325, 1324},
-    {1327, 1326},
-    {1377, 1329},
-    {1378, 1330},
-    {1379, 1331},
-    {1380, 1332},
-    {1381, 1333},
-    {1382, 1334},
-    {1383, 1335},
-    {1384, 1336},
-    {1385, 1337},
-    {1386, 1338},
-    {1387, 1339},
-    {1388, 1340},
-    {1389, 1341},
-    {1390, 1342},
-    {1391, 1343},
-    {1392, 1344},
-    {1393, 1345},
-    {1394, 1346},
-    {1395, 1347},
-    {1396, 1348},
-    {1397, 1349},
-    {1398, 1350},
-    {1399, 1351},
-    {1400, 1352},
-    {1401, 1353},
-    {1402, 1354},
-    {1403, 1355},
-    {1404, 1356},
-    {1405, 1357},
-    {1406, 1358},
-    {1407, 1359},
-    {1408, 1360},
-    {1409, 1361},
-    {1410, 1362},
-    {1411, 1363},
-    {1412, 1364},
-    {1413, 1365},
-    {1414, 1366},
-    {4304, 7312},
-    {4305, 7313},
-    {4306, 7314},
-    {4307, 7315},
-    {4308, 7316},
-    {4309, 7317},
-    {4310, 7318},
-    {4311, 7319},
-    {4312, 7320},
-    {4313, 7321},
-    {4314, 7322},
-    {4315, 7323},
-    {4316, 7324},
-    {4317, 7325},
-    {4318, 7326},
-    {4319, 7327},
-    {4320, 7328},
-    {4321, 7329},
-    {4322, 7330},
-    {4323, 7331},
-    {4324, 7332},
-    {4325, 7333},
-    {4326, 7334},
-    {4327, 7335},
-    {4328, 7336},
-    {4329, 7337},
-    {4330, 7338},
-    {4331, 7339},
-    {4332, 7340},
-    {4333, 7341},
-    {4334, 7342},
-    {4335, 7343},
-    {4336, 7344},
-    {4337, 7345},
-    {4338, 7346},
-    {4339, 7347},
-    {4340, 7348},
-    {4341, 7349},
-    {4342, 7350},
-    {4343, 7351},
-    {4344, 7352},
-    {4345, 7353},
-    {4346, 7354},
-    {4349, 7357},
-    {4350, 7358},
-    {4351, 7359},
-    {5112, 5104},
-    {5113, 5105},
-    {5114, 5106},
-    {5115, 5107},
-    {5116, 5108},
-    {5117, 5109},
-    {7296, 1042},
-    {7297, 1044},
-    {7298, 1054},
-    {7299, 1057},
-    {7300, 1058},
-    {7301, 1058},
-    {7302, 1066},
-    {7303, 1122},
-    {7304, 42570},
-    {7545, 42877},
-    {7549, 11363},
-    {7566, 42950},
-    {7681, 7680},
-    {7683, 7682},
-    {7685, 7684},
-    {7687, 7686},
-    {7689, 7688},
-    {7691, 7690},
-    {7693, 7692},
-    {7695, 7694},
-    {7697, 7696},
-    {7699, 7698},
-    {7701, 7700},
-    {7703, 7702},
-    {7705, 7704},
-    {7707, 7706},
-    {7709, 7708},
-    {7711, 7710},
-    {7713, 7712},
-    {7715, 7714},
-    {7717, 7716},
-    {7719, 7718},
-    {7721, 7720},
-    {7723, 7722},
-    {7725, 7724},
-    {7727, 7726},
-    {7729, 7728},
-    {7731, 7730},
-    {7733, 7732},
-    {7735, 7734},
-    {7737, 7736},
-    {7739, 7738},
-    {7741, 7740},
-    {7743, 7742},
-    {7745, 7744},
-    {7747, 7746},
-    {7749, 7748},
-    {7751, 7750},
-    {7753, 7752},
-    {7755, 7754},
-    {7757, 7756},
-    {7759, 7758},
-    {7761, 7760},
-    {7763, 7762},
-    {7765, 7764},
-    {7767, 7766},
-    {7769, 7768},
-    {7771, 7770},
-    {7773, 7772},
-    {7775, 7774},
-    {7777, 7776},
-    {7779, 7778},
-    {7781, 7780},
-    {7783, 7782},
-    {7785, 7784},
-    {7787, 7786},
-    {7789, 7788},
-    {7791, 7790},
-    {7793, 7792},
-    {7795, 7794},
-    {7797, 7796},
-    {7799, 7798},
-    {7801, 7800},
-    {7803, 7802},
-    {7805, 7804},
-    {7807, 7806},
-    {7809, 7808},
-    {7811, 7810},
-    {7813, 7812},
-    {7815, 7814},
-    {7817, 7816},
-    {7819, 7818},
-    {7821, 7820},
-    {7823, 7822},
-    {7825, 7824},
-    {7827, 7826},
-    {7829, 7828},
-    {7835, 7776},
-    {7841, 7840},
-    {7843, 7842},
-    {7845, 7844},
-    {7847, 7846},
-    {7849, 7848},
-    {7851, 7850},
-    {7853, 7852},
-    {7855, 7854},
-    {7857, 7856},
-    {7859, 7858},
-    {7861, 7860},
-    {7863, 7862},
-    {7865, 7864},
-    {7867, 7866},
-    {7869, 7868},
-    {7871, 7870},
-    {7873, 7872},
-    {7875, 7874},
-    {7877, 7876},
-    {7879, 7878},
-    {7881, 7880},
-    {7883, 7882},
-    {7885, 7884},
-    {7887, 7886},
-    {7889, 7888},
-    {7891, 7890},
-    {7893, 7892},
-    {7895, 7894},
-    {7897, 7896},
-    {7899, 7898},
-    {7901, 7900},
-    {7903, 7902},
-    {7905, 7904},
-    {7907, 7906},
-    {7909, 7908},
-    {7911, 7910},
-    {7913, 7912},
-    {7915, 7914},
-    {7917, 7916},
-    {7919, 7918},
-    {7921, 7920},
-    {7923, 7922},
-    {7925, 7924},
-    {7927, 7926},
-    {7929, 7928},
-    {7931, 7930},
-    {7933, 7932},
-    {7935, 7934},
-    {7936, 7944},
-    {7937, 7945},
-    {7938, 7946},
-    {7939, 7947},
-    {7940, 7948},
-    {7941, 7949},
-    {7942, 7950},
-    {7943, 7951},
-    {7952, 7960},
-    {7953, 7961},
-    {7954, 7962},
-    {7955, 7963},
-    {7956, 7964},
-    {7957, 7965},
-    {7968, 7976},
-    {7969, 7977},
-    {7970, 7978},
-    {7971, 7979},
-    {7972, 7980},
-    {7973, 7981},
-    {7974, 7982},
-    {7975, 7983},
-    {7984, 7992},
-    {7985, 7993},
-    {7986, 7994},
-    {7987, 7995},
-    {7988, 7996},
-    {7989, 7997},
-    {7990, 7998},
-    {7991, 7999},
-    {8000, 8008},
-    {8001, 8009},
-    {8002, 8010},
-    {8003, 8011},
-    {8004, 8012},
-    {8005, 8013},
-    {8017, 8025},
-    {8019, 8027},
-    {8021, 8029},
-    {8023, 8031},
-    {8032, 8040},
-    {8033, 8041},
-    {8034, 8042},
-    {8035, 8043},
-    {8036, 8044},
-    {8037, 8045},
-    {8038, 8046},
-    {8039, 8047},
-    {8048, 8122},
-    {8049, 8123},
-    {8050, 8136},
-    {8051, 8137},
-    {8052, 8138},
-    {8053, 8139},
-    {8054, 8154},
-    {8055, 8155},
-    {8056, 8184},
-    {8057, 8185},
-    {8058, 8170},
-    {8059, 8171},
-    {8060, 8186},
-    {8061, 8187},
-    {8112, 8120},
-    {8113, 8121},
-    {8126, 921},
-    {8144, 8152},
-    {8145, 8153},
-    {8160, 8168},
-    {8161, 8169},
-    {8165, 8172},
-    {8526, 8498},
-    {8560, 8544},
-    {8561, 8545},
-    {8562, 8546},
-    {8563, 8547},
-    {8564, 8548},
-    {8565, 8549},
-    {8566, 8550},
-    {8567, 8551},
-    {8568, 8552},
-    {8569, 8553},
-    {8570, 8554},
-    {8571, 8555},
-    {8572, 8556},
-    {8573, 8557},
-    {8574, 8558},
-    {8575, 8559},
-    {8580, 8579},
-    {9424, 9398},
-    {9425, 9399},
-    {9426, 9400},
-    {9427, 9401},
-    {9428, 9402},
-    {9429, 9403},
-    {9430, 9404},
-    {9431, 9405},
-    {9432, 9406},
-    {9433, 9407},
-    {9434, 9408},
-    {9435, 9409},
-    {9436, 9410},
-    {9437, 9411},
-    {9438, 9412},
-    {9439, 9413},
-    {9440, 9414},
-    {9441, 9415},
-    {9442, 9416},
-    {9443, 9417},
-    {9444, 9418},
-    {9445, 9419},
-    {9446, 9420},
-    {9447, 9421},
-    {9448, 9422},
-    {9449, 9423},
-    {11312, 11264},
-    {11313, 11265},
-    {11314, 11266},
-    {11315, 11267},
-    {11316, 11268},
-    {11317, 11269},
-    {11318, 11270},
-    {11319, 11271},
-    {11320, 11272},
-    {11321, 11273},
-    {11322, 11274},
-    {11323, 11275},
-    {11324, 11276},
-    {11325, 11277},
-    {11326, 11278},
-    {11327, 11279},
-    {11328, 11280},
-    {11329, 11281},
-    {11330, 11282},
-    {11331, 11283},
-    {11332, 11284},
-    {11333, 11285},
-    {11334, 11286},
-    {11335, 11287},
-    {11336, 11288},
-    {11337, 11289},
-    {11338, 11290},
-    {11339, 11291},
-    {11340, 11292},
-    {11341, 11293},
-    {11342, 11294},
-    {11343, 11295},
-    {11344, 11296},
-    {11345, 11297},
-    {11346, 11298},
-    {11347, 11299},
-    {11348, 11300},
-    {11349, 11301},
-    {11350, 11302},
-    {11351, 11303},
-    {11352, 11304},
-    {11353, 11305},
-    {11354, 11306},
-    {11355, 11307},
-    {11356, 11308},
-    {11357, 11309},
-    {11358, 11310},
-    {11359, 11311},
-    {11361, 11360},
-    {11365, 570},
-    {11366, 574},
-    {11368, 11367},
-    {11370, 11369},
-    {11372, 11371},
-    {11379, 11378},
-    {11382, 11381},
-    {11393, 11392},
-    {11395, 11394},
-    {11397, 11396},
-    {11399, 11398},
-    {11401, 11400},
-    {11403, 11402},
-    {11405, 11404},
-    {11407, 11406},
-    {11409, 11408},
-    {11411, 11410},
-    {11413, 11412},
-    {11415, 11414},
-    {11417, 11416},
-    {11419, 11418},
-    {11421, 11420},
-    {11423, 11422},
-    {11425, 11424},
-    {11427, 11426},
-    {11429, 11428},
-    {11431, 11430},
-    {11433, 11432},
-    {11435, 11434},
-    {11437, 11436},
-    {11439, 11438},
-    {11441, 11440},
-    {11443, 11442},
-    {11445, 11444},
-    {11447, 11446},
-    {11449, 11448},
-    {11451, 11450},
-    {11453, 11452},
-    {11455, 11454},
-    {11457, 11456},
-    {11459, 11458},
-    {11461, 11460},
-    {11463, 11462},
-    {11465, 11464},
-    {11467, 11466},
-    {11469, 11468},
-    {11471, 11470},
-    {11473, 11472},
-    {11475, 11474},
-    {11477, 11476},
-    {11479, 11478},
-    {11481, 11480},
-    {11483, 11482},
-    {11485, 11484},
-    {11487, 11486},
-    {11489, 11488},
-    {11491, 11490},
-    {11500, 11499},
-    {11502, 11501},
-    {11507, 11506},
-    {11520, 4256},
-    {11521, 4257},
-    {11522, 4258},
-    {11523, 4259},
-    {11524, 4260},
-    {11525, 4261},
-    {11526, 4262},
-    {11527, 4263},
-    {11528, 4264},
-    {11529, 4265},
-    {11530, 4266},
-    {11531, 4267},
-    {11532, 4268},
-    {11533, 4269},
-    {11534, 4270},
-    {11535, 4271},
-    {11536, 4272},
-    {11537, 4273},
-    {11538, 4274},
-    {11539, 4275},
-    {11540, 4276},
-    {11541, 4277},
-    {11542, 4278},
-    {11543, 4279},
-    {11544, 4280},
-    {11545, 4281},
-    {11546, 4282},
-    {11547, 4283},
-    {11548, 4284},
-    {11549, 4285},
-    {11550, 4286},
-    {11551, 4287},
-    {11552, 4288},
-    {11553, 4289},
-    {11554, 4290},
-    {11555, 4291},
-    {11556, 4292},
-    {11557, 4293},
-    {11559, 4295},
-    {11565, 4301},
-    {42561, 42560},
-    {42563, 42562},
-    {42565, 42564},
-    {42567, 42566},
-    {42569, 42568},
-    {42571, 42570},
-    {42573, 42572},
-    {42575, 42574},
-    {42577, 42576},
-    {42579, 42578},
-    {42581, 42580},
-    {42583, 42582},
-    {42585, 42584},
-    {42587, 42586},
-    {42589, 42588},
-    {42591, 42590},
-    {42593, 42592},
-    {42595, 42594},
-    {42597, 42596},
-    {42599, 42598},
-    {42601, 42600},
-    {42603, 42602},
-    {42605, 42604},
-    {42625, 42624},
-    {42627, 42626},
-    {42629, 42628},
-    {42631, 42630},
-    {42633, 42632},
-    {42635, 42634},
-    {42637, 42636},
-    {42639, 42638},
-    {42641, 42640},
-    {42643, 42642},
-    {42645, 42644},
-    {42647, 42646},
-    {42649, 42648},
-    {42651, 42650},
-    {42787, 42786},
-    {42789, 42788},
-    {42791, 42790},
-    {42793, 42792},
-    {42795, 42794},
-    {42797, 42796},
-    {42799, 42798},
-    {42803, 42802},
-    {42805, 42804},
-    {42807, 42806},
-    {42809, 42808},
-    {42811, 42810},
-    {42813, 42812},
-    {42815, 42814},
-    {42817, 42816},
-    {42819, 42818},
-    {42821, 42820},
-    {42823, 42822},
-    {42825, 42824},
-    {42827, 42826},
-    {42829, 42828},
-    {42831, 42830},
-    {42833, 42832},
-    {42835, 42834},
-    {42837, 42836},
-    {42839, 42838},
-    {42841, 42840},
-    {42843, 42842},
-    {42845, 42844},
-    {42847, 42846},
-    {42849, 42848},
-    {42851, 42850},
-    {42853, 42852},
-    {42855, 42854},
-    {42857, 42856},
-    {42859, 42858},
-    {42861, 42860},
-    {42863, 42862},
-    {42874, 42873},
-    {42876, 42875},
-    {42879, 42878},
-    {42881, 42880},
-    {42883, 42882},
-    {42885, 42884},
-    {42887, 42886},
-    {42892, 42891},
-    {42897, 42896},
-    {42899, 42898},
-    {42900, 42948},
-    {42903, 42902},
-    {42905, 42904},
-    {42907, 42906},
-    {42909, 42908},
-    {42911, 42910},
-    {42913, 42912},
-    {42915, 42914},
-    {42917, 42916},
-    {42919, 42918},
-    {42921, 42920},
-    {42933, 42932},
-    {42935, 42934},
-    {42937, 42936},
-    {42939, 42938},
-    {42941, 42940},
-    {42943, 42942},
-    {42945, 42944},
-    {42947, 42946},
-    {42952, 42951},
-    {42954, 42953},
-    {42961, 42960},
-    {42967, 42966},
-    {42969, 42968},
-    {42998, 42997},
-    {43859, 42931},
-    {43888, 5024},
-    {43889, 5025},
-    {43890, 5026},
-    {43891, 5027},
-    {43892, 5028},
-    {43893, 5029},
-    {43894, 5030},
-    {43895, 5031},
-    {43896, 5032},
-    {43897, 5033},
-    {43898, 5034},
-    {43899, 5035},
-    {43900, 5036},
-    {43901, 5037},
-    {43902, 5038},
-    {43903, 5039},
-    {43904, 5040},
-    {43905, 5041},
-    {43906, 5042},
-    {43907, 5043},
-    {43908, 5044},
-    {43909, 5045},
-    {43910, 5046},
-    {43911, 5047},
-    {43912, 5048},
-    {43913, 5049},
-    {43914, 5050},
-    {43915, 5051},
-    {43916, 5052},
-    {43917, 5053},
-    {43918, 5054},
-    {43919, 5055},
-    {43920, 5056},
-    {43921, 5057},
-    {43922, 5058},
-    {43923, 5059},
-    {43924, 5060},
-    {43925, 5061},
-    {43926, 5062},
-    {43927, 5063},
-    {43928, 5064},
-    {43929, 5065},
-    {43930, 5066},
-    {43931, 5067},
-    {43932, 5068},
-    {43933, 5069},
-    {43934, 5070},
-    {43935, 5071},
-    {43936, 5072},
-    {43937, 5073},
-    {43938, 5074},
-    {43939, 5075},
-    {43940, 5076},
-    {43941, 5077},
-    {43942, 5078},
-    {43943, 5079},
-    {43944, 5080},
-    {43945, 5081},
-    {43946, 5082},
-    {43947, 5083},
-    {43948, 5084},
-    {43949, 5085},
-    {43950, 5086},
-    {43951, 5087},
-    {43952, 5088},
-    {43953, 5089},
-    {43954, 5090},
-    {43955, 5091},
-    {43956, 5092},
-    {43957, 5093},
-    {43958, 5094},
-    {43959, 5095},
-    {43960, 5096},
-    {43961, 5097},
-    {43962, 5098},
-    {43963, 5099},
-    {43964, 5100},
-    {43965, 5101},
-    {43966, 5102},
-    {43967, 5103},
-    {65345, 65313},
-    {65346, 65314},
-    {65347, 65315},
-    {65348, 65316},
-    {65349, 65317},
-    {65350, 65318},
-    {65351, 65319},
-    {65352, 65320},
-    {65353, 65321},
-    {65354, 65322},
-    {65355, 65323},
-    {65356, 65324},
-    {65357, 65325},
-    {65358, 65326},
-    {65359, 65327},
-    {65360, 65328},
-    {65361, 65329},
-    {65362, 65330},
-    {65363, 65331},
-    {65364, 65332},
-    {65365, 65333},
-    {65366, 65334},
-    {65367, 65335},
-    {65368, 65336},
-    {65369, 65337},
-    {65370, 65338},
-    {66600, 66560},
-    {66601, 66561},
-    {66602, 66562},
-    {66603, 66563},
-    {66604, 66564},
-    {66605, 66565},
-    {66606, 66566},
-    {66607, 66567},
-    {66608, 66568},
-    {66609, 66569},
-    {66610, 66570},
-    {66611, 66571},
-    {66612, 66572},
-    {66613, 66573},
-    {66614, 66574},
-    {66615, 66575},
-    {66616, 66576},
-    {66617, 66577},
-    {66618, 66578},
-    {66619, 66579},
-    {66620, 66580},
-    {66621, 66581},
-    {66622, 66582},
-    {66623, 66583},
-    {66624, 66584},
-    {66625, 66585},
-    {66626, 66586},
-    {66627, 66587},
-    {66628, 66588},
-    {66629, 66589},
-    {66630, 66590},
-    {66631, 66591},
-    {66632, 66592},
-    {66633, 66593},
-    {66634, 66594},
-    {66635, 66595},
-    {66636, 66596},
-    {66637, 66597},
-    {66638, 66598},
-    {66639, 66599},
-    {66776, 66736},
-    {66777, 66737},
-    {66778, 66738},
-    {66779, 66739},
-    {66780, 66740},
-    {66781, 66741},
-    {66782, 66742},
-    {66783, 66743},
-    {66784, 66744},
-    {66785, 66745},
-    {66786, 66746},
-    {66787, 66747},
-    {66788, 66748},
-    {66789, 66749},
-    {66790, 66750},
-    {66791, 66751},
-    {66792, 66752},
-    {66793, 66753},
-    {66794, 66754},
-    {66795, 66755},
-    {66796, 66756},
-    {66797, 66757},
-    {66798, 66758},
-    {66799, 66759},
-    {66800, 66760},
-    {66801, 66761},
-    {66802, 66762},
-    {66803, 66763},
-    {66804, 66764},
-    {66805, 66765},
-    {66806, 66766},
-    {66807, 66767},
-    {66808, 66768},
-    {66809, 66769},
-    {66810, 66770},
-    {66811, 66771},
-    {66967, 66928},
-    {66968, 66929},
-    {66969, 66930},
-    {66970, 66931},
-    {66971, 66932},
-    {66972, 66933},
-    {66973, 66934},
-    {66974, 66935},
-    {66975, 66936},
-    {66976, 66937},
-    {66977, 66938},
-    {66979, 66940},
-    {66980, 66941},
-    {66981, 66942},
-    {66982, 66943},
-    {66983, 66944},
-    {66984, 66945},
-    {66985, 66946},
-    {66986, 66947},
-    {66987, 66948},
-    {66988, 66949},
-    {66989, 66950},
-    {66990, 66951},
-    {66991, 66952},
-    {66992, 66953},
-    {66993, 66954},
-    {66995, 66956},
-    {66996, 66957},
-    {66997, 66958},
-    {66998, 66959},
-    {66999, 66960},
-    {67000, 66961},
-    {67001, 66962},
-    {67003, 66964},
-    {67004, 66965},
-    {68800, 68736},
-    {68801, 68737},
-    {68802, 68738},
-    {68803, 68739},
-    {68804, 68740},
-    {68805, 68741},
-    {68806, 68742},
-    {68807, 68743},
-    {68808, 68744},
-    {68809, 68745},
-    {68810, 68746},
-    {68811, 68747},
-    {68812, 68748},
-    {68813, 68749},
-    {68814, 68750},
-    {68815, 68751},
-    {68816, 68752},
-    {68817, 68753},
-    {68818, 68754},
-    {68819, 68755},
-    {68820, 68756},
-    {68821, 68757},
-    {68822, 68758},
-    {68823, 68759},
-    {68824, 68760},
-    {68825, 68761},
-    {68826, 68762},
-    {68827, 68763},
-    {68828, 68764},
-    {68829, 68765},
-    {68830, 68766},
-    {68831, 68767},
-    {68832, 68768},
-    {68833, 68769},
-    {68834, 68770},
-    {68835, 68771},
-    {68836, 68772},
-    {68837, 68773},
-    {68838, 68774},
-    {68839, 68775},
-    {68840, 68776},
-    {68841, 68777},
-    {68842, 68778},
-    {68843, 68779},
-    {68844, 68780},
-    {68845, 68781},
-    {68846, 68782},
-    {68847, 68783},
-    {68848, 68784},
-    {68849, 68785},
-    {68850, 68786},
-    {71872, 71840},
-    {71873, 71841},
-    {71874, 71842},
-    {71875, 71843},
-    {71876, 71844},
-    {71877, 71845},
-    {71878, 71846},
-    {71879, 71847},
-    {71880, 71848},
-    {71881, 71849},
-    {71882, 71850},
-    {71883, 71851},
-    {71884, 71852},
-    {71885, 71853},
-    {71886, 71854},
-    {71887, 71855},
-    {71888, 71856},
-    {71889, 71857},
-    {71890, 71858},
-    {71891, 71859},
-    {71892, 71860},
-    {71893, 71861},
-    {71894, 71862},
-    {71895, 71863},
-    {71896, 71864},
-    {71897, 71865},
-    {71898, 71866},
-    {71899, 71867},
-    {71900, 71868},
-    {71901, 71869},
-    {71902, 71870},
-    {71903, 71871},
-    {93792, 93760},
-    {93793, 93761},
-    {93794, 93762},
-    {93795, 93763},
-    {93796, 93764},
-    {93797, 93765},
-    {93798, 93766},
-    {93799, 93767},
-    {93800, 93768},
-    {93801, 93769},
-    {93802, 93770},
-    {93803, 93771},
-    {93804, 93772},
-    {93805, 93773},
-    {93806, 93774},
-    {93807, 93775},
-    {93808, 93776},
-    {93809, 93777},
-    {93810, 93778},
-    {93811, 93779},
-    {93812, 93780},
-    {93813, 93781},
-    {93814, 93782},
-    {93815, 93783},
-    {93816, 93784},
-    {93817, 93785},
-    {93818, 93786},
-    {93819, 93787},
-    {93820, 93788},
-    {93821, 93789},
-    {93822, 93790},
-    {93823, 93791},
-    {125218, 125184},
-    {125219, 125185},
-    {125220, 125186},
-    {125221, 125187},
-    {125222, 125188},
-    {125223, 125189},
-    {125224, 125190},
-    {125225, 125191},
-    {125226, 125192},
-    {125227, 125193},
-    {125228, 125194},
-    {125229, 125195},
-    {125230, 125196},
-    {125231, 125197},
-    {125232, 125198},
-    {125233, 125199},
-    {125234, 125200},
-    {125235, 125201},
-    {125236, 125202},
-    {125237, 125203},
-    {125238, 125204},
-    {125239, 125205},
-    {125240, 125206},
-    {125241, 125207},
-    {125242, 125208},
-    {125243, 125209},
-    {125244, 125210},
-    {125245, 125211},
-    {125246, 125212},
-    {125247, 125213},
-    {125248, 125214},
-    {125249, 125215},
-    {125250, 125216},
-    {125251, 125217},
-    };
+const uint8_t uppercasing_stage1[UPPERCASING_STAGE1_ENTRIES] = {
+    0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 0, 10, 11, 12,
+    13, 14, 15, 16, 17, 18, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 22, 0, 0, 23, 24, 0, 25, 25, 26, 25, 27, 28, 29, 30,
+    0, 0, 0, 0, 0, 31, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    34, 35, 25, 36, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 38, 39, 0, 40, 41, 42, 43,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 45, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    48, 49, 0, 50, 0, 0, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 55, 56,
+};
+
+const uint8_t uppercasing_stage2[UPPERCASING_STAGE2_ENTRIES] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 4,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 6, 0, 5, 0, 5, 0, 5, 0, 0, 5, 0, 5, 0, 5, 0,
+    5, 0, 5, 0, 5, 0, 5, 0, 5, 1, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 0, 5, 0, 5, 0, 5, 7,
+    8, 0, 0, 5, 0, 5, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0,
+    0, 0, 5, 0, 0, 9, 0, 0, 0, 5, 10, 0, 0, 0, 11, 0,
+    0, 5, 0, 5, 0, 5, 0, 0, 5, 0, 0, 0, 0, 5, 0, 0,
+    5, 0, 0, 0, 5, 0, 5, 0, 0, 5, 0, 0, 0, 5, 0, 12,
+    0, 0, 0, 0, 0, 5, 13, 0, 5, 13, 0, 5, 13, 0, 5, 0,
+    5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 14, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    1, 0, 5, 13, 0, 5, 0, 0, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 0, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 15,
+    15, 0, 5, 0, 0, 0, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    16, 17, 18, 19, 20, 0, 21, 21, 0, 22, 0, 23, 24, 0, 0, 0,
+    21, 25, 0, 26, 0, 27, 28, 0, 29, 30, 28, 31, 32, 0, 0, 30,
+    0, 33, 34, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 36, 0, 0,
+    37, 0, 38, 37, 0, 0, 0, 39, 37, 40, 41, 41, 42, 0, 0, 0,
+    0, 0, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 45, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 0, 5, 0, 0, 0, 5, 0, 0, 0, 11, 11, 11, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 48, 48, 48,
+    1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 49, 3, 3, 3, 3, 3, 3, 3, 3, 3, 50, 51, 51, 0,
+    52, 53, 0, 0, 0, 54, 55, 56, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    57, 58, 59, 60, 0, 61, 0, 0, 5, 0, 0, 5, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 62,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 0, 0, 64, 64, 64,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56, 56, 56, 56, 0, 0,
+    65, 66, 67, 68, 68, 69, 70, 71, 72, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 73, 0, 0, 0, 74, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 1, 1, 1, 1, 1, 76, 0, 0, 0, 0,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    77, 77, 77, 77, 77, 77, 77, 77, 0, 0, 0, 0, 0, 0, 0, 0,
+    77, 77, 77, 77, 77, 77, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    77, 77, 77, 77, 77, 77, 77, 77, 0, 0, 0, 0, 0, 0, 0, 0,
+    77, 77, 77, 77, 77, 77, 77, 77, 0, 0, 0, 0, 0, 0, 0, 0,
+    77, 77, 77, 77, 77, 77, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 77, 1, 77, 1, 77, 1, 77, 0, 0, 0, 0, 0, 0, 0, 0,
+    77, 77, 77, 77, 77, 77, 77, 77, 0, 0, 0, 0, 0, 0, 0, 0,
+    78, 78, 79, 79, 79, 79, 80, 80, 81, 81, 82, 82, 83, 83, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    77, 77, 1, 1, 1, 0, 1, 1, 0, 0, 0, 0, 1, 0, 84, 0,
+    0, 0, 1, 1, 1, 0, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0,
+    77, 77, 1, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    77, 77, 1, 1, 1, 59, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 0, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86,
+    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    0, 5, 0, 0, 0, 88, 89, 0, 5, 0, 5, 0, 5, 0, 0, 0,
+    0, 0, 0, 5, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 5, 0,
+    0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90,
+    90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90,
+    90, 90, 90, 90, 90, 90, 0, 90, 0, 0, 0, 0, 0, 90, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 0, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 5, 0, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 0, 0, 0, 5, 0, 0, 0,
+    0, 5, 0, 5, 91, 0, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 0, 0, 0, 5, 0, 5, 0, 0, 0, 0, 0,
+    0, 5, 0, 0, 0, 0, 0, 5, 0, 5, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 92, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+    93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+    93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+    93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+    93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+    1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 94, 94, 94, 94, 94, 94, 94, 94,
+    94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94,
+    94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 94, 94, 94, 94, 94, 94, 94, 94,
+    94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94,
+    94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+    95, 95, 0, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+    95, 95, 0, 95, 95, 95, 95, 95, 95, 95, 0, 95, 95, 0, 0, 0,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+    96, 96, 96, 96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const int32_t uppercasing_deltas[UPPERCASING_DELTA_ENTRIES] = {
+    0, 0, 743, -32, 121, -1, -232, -300,
+    195, 97, 163, 130, 56, -2, -79, 10815,
+    10783, 10780, 10782, -210, -206, -205, -202, -203,
+    42319, 42315, -207, 42280, 42308, -209, -211, 10743,
+    42305, 10749, -213, -214, 10727, -218, 42307, 42282,
+    -69, -217, -71, -219, 42261, 42258, 84, -38,
+    -37, -31, -64, -63, -62, -57, -47, -54,
+    -8, -86, -80, 7, -116, -96, -15, -48,
+    3008, -6254, -6253, -6244, -6242, -6243, -6236, -6181,
+    35266, 35332, 3814, 35384, -59, 8, 74, 86,
+    100, 128, 112, 126, -7205, -28, -16, -26,
+    -10795, -10792, -7264, 48, -928, -38864, -40, -39,
+    -34,
+};
 // clang-format on
 
+// Generated with tools/genlower.py.
+// clang-format off
 const UnicodeConversionMultiChar lowercasing_multi[NUM_LOWERCASING_MULTICHAR_ENTRIES] = {
     {304, {105, 775, 0}},
 };
 
+const uint8_t lowercasing_stage1[LOWERCASING_STAGE1_ENTRIES] = {
+    0, 0, 0, 1, 2, 3, 4, 5, 6, 7, 0, 0, 0, 8, 9, 10,
+    11, 12, 13, 14, 15, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 17, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 20,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 21, 0, 0, 0, 0, 0, 22, 22, 23, 22, 24, 25, 26, 27,
+    0, 0, 0, 0, 28, 29, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 31, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    33, 34, 22, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 37, 0, 38, 39, 40, 41,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    43, 0, 44, 45, 0, 46, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 51,
+};
+
+const uint8_t lowercasing_stage2[LOWERCASING_STAGE2_ENTRIES] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    1, 0, 3, 0, 3, 0, 3, 0, 0, 3, 0, 3, 0, 3, 0, 3,
+    0, 3, 0, 3, 0, 3, 0, 3, 0, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 4, 3, 0, 3, 0, 3, 0, 0,
+    0, 5, 3, 0, 3, 0, 6, 3, 0, 7, 7, 3, 0, 0, 8, 9,
+    10, 3, 0, 7, 11, 0, 12, 13, 3, 0, 0, 0, 12, 14, 0, 15,
+    3, 0, 3, 0, 3, 0, 16, 3, 0, 16, 0, 0, 3, 0, 16, 3,
+    0, 17, 17, 3, 0, 3, 0, 18, 3, 0, 0, 0, 3, 0, 0, 0,
+    0, 0, 0, 0, 19, 3, 0, 19, 3, 0, 19, 3, 0, 3, 0, 3,
+    0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    0, 19, 3, 0, 3, 0, 20, 21, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    22, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 0, 0, 0, 0, 0, 0, 23, 3, 0, 24, 25, 0,
+    0, 3, 0, 26, 27, 28, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 3, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 29,
+    0, 0, 0, 0, 0, 0, 30, 0, 31, 31, 31, 0, 32, 0, 33, 33,
+    0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34,
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    0, 0, 0, 0, 35, 0, 0, 3, 0, 36, 3, 0, 0, 22, 22, 22,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    38, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    0, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 0, 40, 0, 0, 0, 0, 0, 40, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 0, 0, 42, 42, 42,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 44, 44, 44, 44, 44, 44, 44, 44,
+    0, 0, 0, 0, 0, 0, 0, 0, 44, 44, 44, 44, 44, 44, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 44, 44, 44, 44, 44, 44, 44, 44,
+    0, 0, 0, 0, 0, 0, 0, 0, 44, 44, 44, 44, 44, 44, 44, 44,
+    0, 0, 0, 0, 0, 0, 0, 0, 44, 44, 44, 44, 44, 44, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 0, 44, 0, 44, 0, 44,
+    0, 0, 0, 0, 0, 0, 0, 0, 44, 44, 44, 44, 44, 44, 44, 44,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 44, 44, 44, 44, 44, 44, 44, 44,
+    0, 0, 0, 0, 0, 0, 0, 0, 44, 44, 44, 44, 44, 44, 44, 44,
+    0, 0, 0, 0, 0, 0, 0, 0, 44, 44, 44, 44, 44, 44, 44, 44,
+    0, 0, 0, 0, 0, 0, 0, 0, 44, 44, 45, 45, 46, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 47, 47, 47, 47, 46, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 44, 44, 48, 48, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 44, 44, 49, 49, 36, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 51, 51, 46, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 52, 0, 0, 0, 53, 54, 0, 0, 0, 0,
+    0, 0, 55, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 58, 59, 60, 0, 0, 3, 0, 3, 0, 3, 0, 61, 62, 63,
+    64, 0, 3, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 65, 65,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 0,
+    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    0, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 66, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 0, 0, 0, 3, 0, 67, 0, 0,
+    3, 0, 3, 0, 0, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 68, 69, 70, 71, 68, 0,
+    72, 73, 74, 75, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+    3, 0, 3, 0, 76, 77, 78, 3, 0, 3, 0, 0, 0, 0, 0, 0,
+    3, 0, 0, 0, 0, 0, 3, 0, 3, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 0, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 0, 80, 80, 80, 80,
+    80, 80, 80, 0, 80, 80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+    81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+    81, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const int32_t lowercasing_deltas[LOWERCASING_DELTA_ENTRIES] = {
+    0, 0, 32, 1, -121, 210, 206, 205,
+    79, 202, 203, 207, 211, 209, 213, 214,
+    218, 217, 219, 2, -97, -56, -130, 10795,
+    -163, 10792, -195, 69, 71, 116, 38, 37,
+    64, 63, 8, -60, -7, 80, 15, 48,
+    7264, 38864, -3008, -7615, -8, -74, -9, -86,
+    -100, -112, -128, -126, -7517, -8383, -8262, 28,
+    16, 26, -10743, -3814, -10727, -10780, -10749, -10783,
+    -10782, -10815, -35332, -42280, -42308, -42319, -42315, -42305,
+    -42258, -42282, -42261, 928, -48, -42307, -35384, 40,
+    39, 34,
+};
+// clang-format on
+
+// Generated with tools/genproperties.py.
 // clang-format off
-const UnicodeConversionSingleChar lowercasing_single[NUM_LOWERCASING_SINGLECHAR_ENTRIES] = {
-    {192, 224},
-    {193, 225},
-    {194, 226},
-    {195, 227},
-    {196, 228},
-    {197, 229},
-    {198, 230},
-    {199, 231},
-    {200, 232},
-    {201, 233},
-    {202, 234},
-    {203, 235},
-    {204, 236},
-    {205, 237},
-    {206, 238},
-    {207, 239},
-    {208, 240},
-    {209, 241},
-    {210, 242},
-    {211, 243},
-    {212, 244},
-    {213, 245},
-    {214, 246},
-    {216, 248},
-    {217, 249},
-    {218, 250},
-    {219, 251},
-    {220, 252},
-    {221, 253},
-    {222, 254},
-    {256, 257},
-    {258, 259},
-    {260, 261},
-    {262, 263},
-    {264, 265},
-    {266, 267},
-    {268, 269},
-    {270, 271},
-    {272, 273},
-    {274, 275},
-    {276, 277},
-    {278, 279},
-    {280, 281},
-    {282, 283},
-    {284, 285},
-    {286, 287},
-    {288, 289},
-    {290, 291},
-    {292, 293},
-    {294, 295},
-    {296, 297},
-    {298, 299},
-    {300, 301},
-    {302, 303},
-    {306, 307},
-    {308, 309},
-    {310, 311},
-    {313, 314},
-    {315, 316},
-    {317, 318},
-    {319, 320},
-    {321, 322},
-    {323, 324},
-    {325, 326},
-    {327, 328},
-    {330, 331},
-    {332, 333},
-    {334, 335},
-    {336, 337},
-    {338, 339},
-    {340, 341},
-    {342, 343},
-    {344, 345},
-    {346, 347},
-    {348, 349},
-    {350, 351},
-    {352, 353},
-    {354, 355},
-    {356, 357},
-    {358, 359},
-    {360, 361},
-    {362, 363},
-    {364, 365},
-    {366, 367},
-    {368, 369},
-    {370, 371},
-    {372, 373},
-    {374, 375},
-    {376, 255},
-    {377, 378},
-    {379, 380},
-    {381, 382},
-    {385, 595},
-    {386, 387},
-    {388, 389},
-    {390, 596},
-    {391, 392},
-    {393, 598},
-    {394, 599},
-    {395, 396},
-    {398, 477},
-    {399, 601},
-    {400, 603},
-    {401, 402},
-    {403, 608},
-    {404, 611},
-    {406, 617},
-    {407, 616},
-    {408, 409},
-    {412, 623},
-    {413, 626},
-    {415, 629},
-    {416, 417},
-    {418, 419},
-    {420, 421},
-    {422, 640},
-    {423, 424},
-    {425, 643},
-    {428, 429},
-    {430, 648},
-    {431, 432},
-    {433, 650},
-    {434, 651},
-    {435, 436},
-    {437, 438},
-    {439, 658},
-    {440, 441},
-    {444, 445},
-    {452, 454},
-    {453, 454},
-    {455, 457},
-    {456, 457},
-    {458, 460},
-    {459, 460},
-    {461, 462},
-    {463, 464},
-    {465, 466},
-    {467, 468},
-    {469, 470},
-    {471, 472},
-    {473, 474},
-    {475, 476},
-    {478, 479},
-    {480, 481},
-    {482, 483},
-    {484, 485},
-    {486, 487},
-    {488, 489},
-    {490, 491},
-    {492, 493},
-    {494, 495},
-    {497, 499},
-    {498, 499},
-    {500, 501},
-    {502, 405},
-    {503, 447},
-    {504, 505},
-    {506, 507},
-    {508, 509},
-    {510, 511},
-    {512, 513},
-    {514, 515},
-    {516, 517},
-    {518, 519},
-    {520, 521},
-    {522, 523},
-    {524, 525},
-    {526, 527},
-    {528, 529},
-    {530, 531},
-    {532, 533},
-    {534, 535},
-    {536, 537},
-    {538, 539},
-    {540, 541},
-    {542, 543},
-    {544, 414},
-    {546, 547},
-    {548, 549},
-    {550, 551},
-    {552, 553},
-    {554, 555},
-    {556, 557},
-    {558, 559},
-    {560, 561},
-    {562, 563},
-    {570, 11365},
-    {571, 572},
-    {573, 410},
-    {574, 11366},
-    {577, 578},
-    {579, 384},
-    {580, 649},
-    {581, 652},
-    {582, 583},
-    {584, 585},
-    {586, 587},
-    {588, 589},
-    {590, 591},
-    {880, 881},
-    {882, 883},
-    {886, 887},
-    {895, 1011},
-    {902, 940},
-    {904, 941},
-    {905, 942},
-    {906, 943},
-    {908, 972},
-    {910, 973},
-    {911, 974},
-    {913, 945},
-    {914, 946},
-    {915, 947},
-    {916, 948},
-    {917, 949},
-    {918, 950},
-    {919, 951},
-    {920, 952},
-    {921, 953},
-    {922, 954},
-    {923, 955},
-    {924, 956},
-    {925, 957},
-    {926, 958},
-    {927, 959},
-    {928, 960},
-    {929, 961},
-    {931, 963},
-    {932, 964},
-    {933, 965},
-    {934, 966},
-    {935, 967},
-    {936, 968},
-    {937, 969},
-    {938, 970},
-    {939, 971},
-    {975, 983},
-    {984, 985},
-    {986, 987},
-    {988, 989},
-    {990, 991},
-    {992, 993},
-    {994, 995},
-    {996, 997},
-    {998, 999},
-    {1000, 1001},
-    {1002, 1003},
-    {1004, 1005},
-    {1006, 1007},
-    {1012, 952},
-    {1015, 1016},
-    {1017, 1010},
-    {1018, 1019},
-    {1021, 891},
-    {1022, 892},
-    {1023, 893},
-    {1024, 1104},
-    {1025, 1105},
-    {1026, 1106},
-    {1027, 1107},
-    {1028, 1108},
-    {1029, 1109},
-    {1030, 1110},
-    {1031, 1111},
-    {1032, 1112},
-    {1033, 1113},
-    {1034, 1114},
-    {1035, 1115},
-    {1036, 1116},
-    {1037, 1117},
-    {1038, 1118},
-    {1039, 1119},
-    {1040, 1072},
-    {1041, 1073},
-    {1042, 1074},
-    {1043, 1075},
-    {1044, 1076},
-    {1045, 1077},
-    {1046, 1078},
-    {1047, 1079},
-    {1048, 1080},
-    {1049, 1081},
-    {1050, 1082},
-    {1051, 1083},
-    {1052, 1084},
-    {1053, 1085},
-    {1054, 1086},
-    {1055, 1087},
-    {1056, 1088},
-    {1057, 1089},
-    {1058, 1090},
-    {1059, 1091},
-    {1060, 1092},
-    {1061, 1093},
-    {1062, 1094},
-    {1063, 1095},
-    {1064, 1096},
-    {1065, 1097},
-    {1066, 1098},
-    {1067, 1099},
-    {1068, 1100},
-    {1069, 1101},
-    {1070, 1102},
-    {1071, 1103},
-    {1120, 1121},
-    {1122, 1123},
-    {1124, 1125},
-    {1126, 1127},
-    {1128, 1129},
-    {1130, 1131},
-    {1132, 1133},
-    {1134, 1135},
-    {1136, 1137},
-    {1138, 1139},
-    {1140, 1141},
-    {1142, 1143},
-    {1144, 1145},
-    {1146, 1147},
-    {1148, 1149},
-    {1150, 1151},
-    {1152, 1153},
-    {1162, 1163},
-    {1164, 1165},
-    {1166, 1167},
-    {1168, 1169},
-    {1170, 1171},
-    {1172, 1173},
-    {1174, 1175},
-    {1176, 1177},
-    {1178, 1179},
-    {1180, 1181},
-    {1182, 1183},
-    {1184, 1185},
-    {1186, 1187},
-    {1188, 1189},
-    {1190, 1191},
-    {1192, 1193},
-    {1194, 1195},
-    {1196, 1197},
-    {1198, 1199},
-    {1200, 1201},
-    {1202, 1203},
-    {1204, 1205},
-    {1206, 1207},
-    {1208, 1209},
-    {1210, 1211},
-    {1212, 1213},
-    {1214, 1215},
-    {1216, 1231},
-    {1217, 1218},
-    {1219, 1220},
-    {1221, 1222},
-    {1223, 1224},
-    {1225, 1226},
-    {1227, 1228},
-    {1229, 1230},
-    {1232, 1233},
-    {1234, 1235},
-    {1236, 1237},
-    {1238, 1239},
-    {1240, 1241},
-    {1242, 1243},
-    {1244, 1245},
-    {1246, 1247},
-    {1248, 1249},
-    {1250, 1251},
-    {1252, 1253},
-    {1254, 1255},
-    {1256, 1257},
-    {1258, 1259},
-    {1260, 1261},
-    {1262, 1263},
-    {1264, 1265},
-    {1266, 1267},
-    {1268, 1269},
-    {1270, 1271},
-    {1272, 1273},
-    {1274, 1275},
-    {1276, 1277},
-    {1278, 1279},
-    {1280, 1281},
-    {1282, 1283},
-    {1284, 1285},
-    {1286, 1287},
-    {1288, 1289},
-    {1290, 1291},
-    {1292, 1293},
-    {1294, 1295},
-    {1296, 1297},
-    {1298, 1299},
-    {1300, 1301},
-    {1302, 1303},
-    {1304, 1305},
-    {1306, 1307},
-    {1308, 1309},
-    {1310, 1311},
-    {1312, 1313},
-    {1314, 1315},
-    {1316, 1317},
-    {1318, 1319},
-    {1320, 1321},
-    {1322, 1323},
-    {1324, 1325},
-    {1326, 1327},
-    {1329, 1377},
-    {1330, 1378},
-    {1331, 1379},
-    {1332, 1380},
-    {1333, 1381},
-    {1334, 1382},
-    {1335, 1383},
-    {1336, 1384},
-    {1337, 1385},
-    {1338, 1386},
-    {1339, 1387},
-    {1340, 1388},
-    {1341, 1389},
-    {1342, 1390},
-    {1343, 1391},
-    {1344, 1392},
-    {1345, 1393},
-    {1346, 1394},
-    {1347, 1395},
-    {1348, 1396},
-    {1349, 1397},
-    {1350, 1398},
-    {1351, 1399},
-    {1352, 1400},
-    {1353, 1401},
-    {1354, 1402},
-    {1355, 1403},
-    {1356, 1404},
-    {1357, 1405},
-    {1358, 1406},
-    {1359, 1407},
-    {1360, 1408},
-    {1361, 1409},
-    {1362, 1410},
-    {1363, 1411},
-    {1364, 1412},
-    {1365, 1413},
-    {1366, 1414},
-    {4256, 11520},
-    {4257, 11521},
-    {4258, 11522},
-    {4259, 11523},
-    {4260, 11524},
-    {4261, 11525},
-    {4262, 11526},
-    {4263, 11527},
-    {4264, 11528},
-    {4265, 11529},
-    {4266, 11530},
-    {4267, 11531},
-    {4268, 11532},
-    {4269, 11533},
-    {4270, 11534},
-    {4271, 11535},
-    {4272, 11536},
-    {4273, 11537},
-    {4274, 11538},
-    {4275, 11539},
-    {4276, 11540},
-    {4277, 11541},
-    {4278, 11542},
-    {4279, 11543},
-    {4280, 11544},
-    {4281, 11545},
-    {4282, 11546},
-    {4283, 11547},
-    {4284, 11548},
-    {4285, 11549},
-    {4286, 11550},
-    {4287, 11551},
-    {4288, 11552},
-    {4289, 11553},
-    {4290, 11554},
-    {4291, 11555},
-    {4292, 11556},
-    {4293, 11557},
-    {4295, 11559},
-    {4301, 11565},
-    {5024, 43888},
-    {5025, 43889},
-    {5026, 43890},
-    {5027, 43891},
-    {5028, 43892},
-    {5029, 43893},
-    {5030, 43894},
-    {5031, 43895},
-    {5032, 43896},
-    {5033, 43897},
-    {5034, 43898},
-    {5035, 43899},
-    {5036, 43900},
-    {5037, 43901},
-    {5038, 43902},
-    {5039, 43903},
-    {5040, 43904},
-    {5041, 43905},
-    {5042, 43906},
-    {5043, 43907},
-    {5044, 43908},
-    {5045, 43909},
-    {5046, 43910},
-    {5047, 43911},
-    {5048, 43912},
-    {5049, 43913},
-    {5050, 43914},
-    {5051, 43915},
-    {5052, 43916},
-    {5053, 43917},
-    {5054, 43918},
-    {5055, 43919},
-    {5056, 43920},
-    {5057, 43921},
-    {5058, 43922},
-    {5059, 43923},
-    {5060, 43924},
-    {5061, 43925},
-    {5062, 43926},
-    {5063, 43927},
-    {5064, 43928},
-    {5065, 43929},
-    {5066, 43930},
-    {5067, 43931},
-    {5068, 43932},
-    {5069, 43933},
-    {5070, 43934},
-    {5071, 43935},
-    {5072, 43936},
-    {5073, 43937},
-    {5074, 43938},
-    {5075, 43939},
-    {5076, 43940},
-    {5077, 43941},
-    {5078, 43942},
-    {5079, 43943},
-    {5080, 43944},
-    {5081, 43945},
-    {5082, 43946},
-    {5083, 43947},
-    {5084, 43948},
-    {5085, 43949},
-    {5086, 43950},
-    {5087, 43951},
-    {5088, 43952},
-    {5089, 43953},
-    {5090, 43954},
-    {5091, 43955},
-    {5092, 43956},
-    {5093, 43957},
-    {5094, 43958},
-    {5095, 43959},
-    {5096, 43960},
-    {5097, 43961},
-    {5098, 43962},
-    {5099, 43963},
-    {5100, 43964},
-    {5101, 43965},
-    {5102, 43966},
-    {5103, 43967},
-    {5104, 5112},
-    {5105, 5113},
-    {5106, 5114},
-    {5107, 5115},
-    {5108, 5116},
-    {5109, 5117},
-    {7312, 4304},
-    {7313, 4305},
-    {7314, 4306},
-    {7315, 4307},
-    {7316, 4308},
-    {7317, 4309},
-    {7318, 4310},
-    {7319, 4311},
-    {7320, 4312},
-    {7321, 4313},
-    {7322, 4314},
-    {7323, 4315},
-    {7324, 4316},
-    {7325, 4317},
-    {7326, 4318},
-    {7327, 4319},
-    {7328, 4320},
-    {7329, 4321},
-    {7330, 4322},
-    {7331, 4323},
-    {7332, 4324},
-    {7333, 4325},
-    {7334, 4326},
-    {7335, 4327},
-    {7336, 4328},
-    {7337, 4329},
-    {7338, 4330},
-    {7339, 4331},
-    {7340, 4332},
-    {7341, 4333},
-    {7342, 4334},
-    {7343, 4335},
-    {7344, 4336},
-    {7345, 4337},
-    {7346, 4338},
-    {7347, 4339},
-    {7348, 4340},
-    {7349, 4341},
-    {7350, 4342},
-    {7351, 4343},
-    {7352, 4344},
-    {7353, 4345},
-    {7354, 4346},
-    {7357, 4349},
-    {7358, 4350},
-    {7359, 4351},
-    {7680, 7681},
-    {7682, 7683},
-    {7684, 7685},
-    {7686, 7687},
-    {7688, 7689},
-    {7690, 7691},
-    {7692, 7693},
-    {7694, 7695},
-    {7696, 7697},
-    {7698, 7699},
-    {7700, 7701},
-    {7702, 7703},
-    {7704, 7705},
-    {7706, 7707},
-    {7708, 7709},
-    {7710, 7711},
-    {7712, 7713},
-    {7714, 7715},
-    {7716, 7717},
-    {7718, 7719},
-    {7720, 7721},
-    {7722, 7723},
-    {7724, 7725},
-    {7726, 7727},
-    {7728, 7729},
-    {7730, 7731},
-    {7732, 7733},
-    {7734, 7735},
-    {7736, 7737},
-    {7738, 7739},
-    {7740, 7741},
-    {7742, 7743},
-    {7744, 7745},
-    {7746, 7747},
-    {7748, 7749},
-    {7750, 7751},
-    {7752, 7753},
-    {7754, 7755},
-    {7756, 7757},
-    {7758, 7759},
-    {7760, 7761},
-    {7762, 7763},
-    {7764, 7765},
-    {7766, 7767},
-    {7768, 7769},
-    {7770, 7771},
-    {7772, 7773},
-    {7774, 7775},
-    {7776, 7777},
-    {7778, 7779},
-    {7780, 7781},
-    {7782, 7783},
-    {7784, 7785},
-    {7786, 7787},
-    {7788, 7789},
-    {7790, 7791},
-    {7792, 7793},
-    {7794, 7795},
-    {7796, 7797},
-    {7798, 7799},
-    {7800, 7801},
-    {7802, 7803},
-    {7804, 7805},
-    {7806, 7807},
-    {7808, 7809},
-    {7810, 7811},
-    {7812, 7813},
-    {7814, 7815},
-    {7816, 7817},
-    {7818, 7819},
-    {7820, 7821},
-    {7822, 7823},
-    {7824, 7825},
-    {7826, 7827},
-    {7828, 7829},
-    {7838, 223},
-    {7840, 7841},
-    {7842, 7843},
-    {7844, 7845},
-    {7846, 7847},
-    {7848, 7849},
-    {7850, 7851},
-    {7852, 7853},
-    {7854, 7855},
-    {7856, 7857},
-    {7858, 7859},
-    {7860, 7861},
-    {7862, 7863},
-    {7864, 7865},
-    {7866, 7867},
-    {7868, 7869},
-    {7870, 7871},
-    {7872, 7873},
-    {7874, 7875},
-    {7876, 7877},
-    {7878, 7879},
-    {7880, 7881},
-    {7882, 7883},
-    {7884, 7885},
-    {7886, 7887},
-    {7888, 7889},
-    {7890, 7891},
-    {7892, 7893},
-    {7894, 7895},
-    {7896, 7897},
-    {7898, 7899},
-    {7900, 7901},
-    {7902, 7903},
-    {7904, 7905},
-    {7906, 7907},
-    {7908, 7909},
-    {7910, 7911},
-    {7912, 7913},
-    {7914, 7915},
-    {7916, 7917},
-    {7918, 7919},
-    {7920, 7921},
-    {7922, 7923},
-    {7924, 7925},
-    {7926, 7927},
-    {7928, 7929},
-    {7930, 7931},
-    {7932, 7933},
-    {7934, 7935},
-    {7944, 7936},
-    {7945, 7937},
-    {7946, 7938},
-    {7947, 7939},
-    {7948, 7940},
-    {7949, 7941},
-    {7950, 7942},
-    {7951, 7943},
-    {7960, 7952},
-    {7961, 7953},
-    {7962, 7954},
-    {7963, 7955},
-    {7964, 7956},
-    {7965, 7957},
-    {7976, 7968},
-    {7977, 7969},
-    {7978, 7970},
-    {7979, 7971},
-    {7980, 7972},
-    {7981, 7973},
-    {7982, 7974},
-    {7983, 7975},
-    {7992, 7984},
-    {7993, 7985},
-    {7994, 7986},
-    {7995, 7987},
-    {7996, 7988},
-    {7997, 7989},
-    {7998, 7990},
-    {7999, 7991},
-    {8008, 8000},
-    {8009, 8001},
-    {8010, 8002},
-    {8011, 8003},
-    {8012, 8004},
-    {8013, 8005},
-    {8025, 8017},
-    {8027, 8019},
-    {8029, 8021},
-    {8031, 8023},
-    {8040, 8032},
-    {8041, 8033},
-    {8042, 8034},
-    {8043, 8035},
-    {8044, 8036},
-    {8045, 8037},
-    {8046, 8038},
-    {8047, 8039},
-    {8072, 8064},
-    {8073, 8065},
-    {8074, 8066},
-    {8075, 8067},
-    {8076, 8068},
-    {8077, 8069},
-    {8078, 8070},
-    {8079, 8071},
-    {8088, 8080},
-    {8089, 8081},
-    {8090, 8082},
-    {8091, 8083},
-    {8092, 8084},
-    {8093, 8085},
-    {8094, 8086},
-    {8095, 8087},
-    {8104, 8096},
-    {8105, 8097},
-    {8106, 8098},
-    {8107, 8099},
-    {8108, 8100},
-    {8109, 8101},
-    {8110, 8102},
-    {8111, 8103},
-    {8120, 8112},
-    {8121, 8113},
-    {8122, 8048},
-    {8123, 8049},
-    {8124, 8115},
-    {8136, 8050},
-    {8137, 8051},
-    {8138, 8052},
-    {8139, 8053},
-    {8140, 8131},
-    {8152, 8144},
-    {8153, 8145},
-    {8154, 8054},
-    {8155, 8055},
-    {8168, 8160},
-    {8169, 8161},
-    {8170, 8058},
-    {8171, 8059},
-    {8172, 8165},
-    {8184, 8056},
-    {8185, 8057},
-    {8186, 8060},
-    {8187, 8061},
-    {8188, 8179},
-    {8486, 969},
-    {8490, 107},
-    {8491, 229},
-    {8498, 8526},
-    {8544, 8560},
-    {8545, 8561},
-    {8546, 8562},
-    {8547, 8563},
-    {8548, 8564},
-    {8549, 8565},
-    {8550, 8566},
-    {8551, 8567},
-    {8552, 8568},
-    {8553, 8569},
-    {8554, 8570},
-    {8555, 8571},
-    {8556, 8572},
-    {8557, 8573},
-    {8558, 8574},
-    {8559, 8575},
-    {8579, 8580},
-    {9398, 9424},
-    {9399, 9425},
-    {9400, 9426},
-    {9401, 9427},
-    {9402, 9428},
-    {9403, 9429},
-    {9404, 9430},
-    {9405, 9431},
-    {9406, 9432},
-    {9407, 9433},
-    {9408, 9434},
-    {9409, 9435},
-    {9410, 9436},
-    {9411, 9437},
-    {9412, 9438},
-    {9413, 9439},
-    {9414, 9440},
-    {9415, 9441},
-    {9416, 9442},
-    {9417, 9443},
-    {9418, 9444},
-    {9419, 9445},
-    {9420, 9446},
-    {9421, 9447},
-    {9422, 9448},
-    {9423, 9449},
-    {11264, 11312},
-    {11265, 11313},
-    {11266, 11314},
-    {11267, 11315},
-    {11268, 11316},
-    {11269, 11317},
-    {11270, 11318},
-    {11271, 11319},
-    {11272, 11320},
-    {11273, 11321},
-    {11274, 11322},
-    {11275, 11323},
-    {11276, 11324},
-    {11277, 11325},
-    {11278, 11326},
-    {11279, 11327},
-    {11280, 11328},
-    {11281, 11329},
-    {11282, 11330},
-    {11283, 11331},
-    {11284, 11332},
-    {11285, 11333},
-    {11286, 11334},
-    {11287, 11335},
-    {11288, 11336},
-    {11289, 11337},
-    {11290, 11338},
-    {11291, 11339},
-    {11292, 11340},
-    {11293, 11341},
-    {11294, 11342},
-    {11295, 11343},
-    {11296, 11344},
-    {11297, 11345},
-    {11298, 11346},
-    {11299, 11347},
-    {11300, 11348},
-    {11301, 11349},
-    {11302, 11350},
-    {11303, 11351},
-    {11304, 11352},
-    {11305, 11353},
-    {11306, 11354},
-    {11307, 11355},
-    {11308, 11356},
-    {11309, 11357},
-    {11310, 11358},
-    {11311, 11359},
-    {11360, 11361},
-    {11362, 619},
-    {11363, 7549},
-    {11364, 637},
-    {11367, 11368},
-    {11369, 11370},
-    {11371, 11372},
-    {11373, 593},
-    {11374, 625},
-    {11375, 592},
-    {11376, 594},
-    {11378, 11379},
-    {11381, 11382},
-    {11390, 575},
-    {11391, 576},
-    {11392, 11393},
-    {11394, 11395},
-    {11396, 11397},
-    {11398, 11399},
-    {11400, 11401},
-    {11402, 11403},
-    {11404, 11405},
-    {11406, 11407},
-    {11408, 11409},
-    {11410, 11411},
-    {11412, 11413},
-    {11414, 11415},
-    {11416, 11417},
-    {11418, 11419},
-    {11420, 11421},
-    {11422, 11423},
-    {11424, 11425},
-    {11426, 11427},
-    {11428, 11429},
-    {11430, 11431},
-    {11432, 11433},
-    {11434, 11435},
-    {11436, 11437},
-    {11438, 11439},
-    {11440, 11441},
-    {11442, 11443},
-    {11444, 11445},
-    {11446, 11447},
-    {11448, 11449},
-    {11450, 11451},
-    {11452, 11453},
-    {11454, 11455},
-    {11456, 11457},
-    {11458, 11459},
-    {11460, 11461},
-    {11462, 11463},
-    {11464, 11465},
-    {11466, 11467},
-    {11468, 11469},
-    {11470, 11471},
-    {11472, 11473},
-    {11474, 11475},
-    {11476, 11477},
-    {11478, 11479},
-    {11480, 11481},
-    {11482, 11483},
-    {11484, 11485},
-    {11486, 11487},
-    {11488, 11489},
-    {11490, 11491},
-    {11499, 11500},
-    {11501, 11502},
-    {11506, 11507},
-    {42560, 42561},
-    {42562, 42563},
-    {42564, 42565},
-    {42566, 42567},
-    {42568, 42569},
-    {42570, 42571},
-    {42572, 42573},
-    {42574, 42575},
-    {42576, 42577},
-    {42578, 42579},
-    {42580, 42581},
-    {42582, 42583},
-    {42584, 42585},
-    {42586, 42587},
-    {42588, 42589},
-    {42590, 42591},
-    {42592, 42593},
-    {42594, 42595},
-    {42596, 42597},
-    {42598, 42599},
-    {42600, 42601},
-    {42602, 42603},
-    {42604, 42605},
-    {42624, 42625},
-    {42626, 42627},
-    {42628, 42629},
-    {42630, 42631},
-    {42632, 42633},
-    {42634, 42635},
-    {42636, 42637},
-    {42638, 42639},
-    {42640, 42641},
-    {42642, 42643},
-    {42644, 42645},
-    {42646, 42647},
-    {42648, 42649},
-    {42650, 42651},
-    {42786, 42787},
-    {42788, 42789},
-    {42790, 42791},
-    {42792, 42793},
-    {42794, 42795},
-    {42796, 42797},
-    {42798, 42799},
-    {42802, 42803},
-    {42804, 42805},
-    {42806, 42807},
-    {42808, 42809},
-    {42810, 42811},
-    {42812, 42813},
-    {42814, 42815},
-    {42816, 42817},
-    {42818, 42819},
-    {42820, 42821},
-    {42822, 42823},
-    {42824, 42825},
-    {42826, 42827},
-    {42828, 42829},
-    {42830, 42831},
-    {42832, 42833},
-    {42834, 42835},
-    {42836, 42837},
-    {42838, 42839},
-    {42840, 42841},
-    {42842, 42843},
-    {42844, 42845},
-    {42846, 42847},
-    {42848, 42849},
-    {42850, 42851},
-    {42852, 42853},
-    {42854, 42855},
-    {42856, 42857},
-    {42858, 42859},
-    {42860, 42861},
-    {42862, 42863},
-    {42873, 42874},
-    {42875, 42876},
-    {42877, 7545},
-    {42878, 42879},
-    {42880, 42881},
-    {42882, 42883},
-    {42884, 42885},
-    {42886, 42887},
-    {42891, 42892},
-    {42893, 613},
-    {42896, 42897},
-    {42898, 42899},
-    {42902, 42903},
-    {42904, 42905},
-    {42906, 42907},
-    {42908, 42909},
-    {42910, 42911},
-    {42912, 42913},
-    {42914, 42915},
-    {42916, 42917},
-    {42918, 42919},
-    {42920, 42921},
-    {42922, 614},
-    {42923, 604},
-    {42924, 609},
-    {42925, 620},
-    {42926, 618},
-    {42928, 670},
-    {42929, 647},
-    {42930, 669},
-    {42931, 43859},
-    {42932, 42933},
-    {42934, 42935},
-    {42936, 42937},
-    {42938, 42939},
-    {42940, 42941},
-    {42942, 42943},
-    {42944, 42945},
-    {42946, 42947},
-    {42948, 42900},
-    {42949, 642},
-    {42950, 7566},
-    {42951, 42952},
-    {42953, 42954},
-    {42960, 42961},
-    {42966, 42967},
-    {42968, 42969},
-    {42997, 42998},
-    {65313, 65345},
-    {65314, 65346},
-    {65315, 65347},
-    {65316, 65348},
-    {65317, 65349},
-    {65318, 65350},
-    {65319, 65351},
-    {65320, 65352},
-    {65321, 65353},
-    {65322, 65354},
-    {65323, 65355},
-    {65324, 65356},
-    {65325, 65357},
-    {65326, 65358},
-    {65327, 65359},
-    {65328, 65360},
-    {65329, 65361},
-    {65330, 65362},
-    {65331, 65363},
-    {65332, 65364},
-    {65333, 65365},
-    {65334, 65366},
-    {65335, 65367},
-    {65336, 65368},
-    {65337, 65369},
-    {65338, 65370},
-    {66560, 66600},
-    {66561, 66601},
-    {66562, 66602},
-    {66563, 66603},
-    {66564, 66604},
-    {66565, 66605},
-    {66566, 66606},
-    {66567, 66607},
-    {66568, 66608},
-    {66569, 66609},
-    {66570, 66610},
-    {66571, 66611},
-    {66572, 66612},
-    {66573, 66613},
-    {66574, 66614},
-    {66575, 66615},
-    {66576, 66616},
-    {66577, 66617},
-    {66578, 66618},
-    {66579, 66619},
-    {66580, 66620},
-    {66581, 66621},
-    {66582, 66622},
-    {66583, 66623},
-    {66584, 66624},
-    {66585, 66625},
-    {66586, 66626},
-    {66587, 66627},
-    {66588, 66628},
-    {66589, 66629},
-    {66590, 66630},
-    {66591, 66631},
-    {66592, 66632},
-    {66593, 66633},
-    {66594, 66634},
-    {66595, 66635},
-    {66596, 66636},
-    {66597, 66637},
-    {66598, 66638},
-    {66599, 66639},
-    {66736, 66776},
-    {66737, 66777},
-    {66738, 66778},
-    {66739, 66779},
-    {66740, 66780},
-    {66741, 66781},
-    {66742, 66782},
-    {66743, 66783},
-    {66744, 66784},
-    {66745, 66785},
-    {66746, 66786},
-    {66747, 66787},
-    {66748, 66788},
-    {66749, 66789},
-    {66750, 66790},
-    {66751, 66791},
-    {66752, 66792},
-    {66753, 66793},
-    {66754, 66794},
-    {66755, 66795},
-    {66756, 66796},
-    {66757, 66797},
-    {66758, 66798},
-    {66759, 66799},
-    {66760, 66800},
-    {66761, 66801},
-    {66762, 66802},
-    {66763, 66803},
-    {66764, 66804},
-    {66765, 66805},
-    {66766, 66806},
-    {66767, 66807},
-    {66768, 66808},
-    {66769, 66809},
-    {66770, 66810},
-    {66771, 66811},
-    {66928, 66967},
-    {66929, 66968},
-    {66930, 66969},
-    {66931, 66970},
-    {66932, 66971},
-    {66933, 66972},
-    {66934, 66973},
-    {66935, 66974},
-    {66936, 66975},
-    {66937, 66976},
-    {66938, 66977},
-    {66940, 66979},
-    {66941, 66980},
-    {66942, 66981},
-    {66943, 66982},
-    {66944, 66983},
-    {66945, 66984},
-    {66946, 66985},
-    {66947, 66986},
-    {66948, 66987},
-    {66949, 66988},
-    {66950, 66989},
-    {66951, 66990},
-    {66952, 66991},
-    {66953, 66992},
-    {66954, 66993},
-    {66956, 66995},
-    {66957, 66996},
-    {66958, 66997},
-    {66959, 66998},
-    {66960, 66999},
-    {66961, 67000},
-    {66962, 67001},
-    {66964, 67003},
-    {66965, 67004},
-    {68736, 68800},
-    {68737, 68801},
-    {68738, 68802},
-    {68739, 68803},
-    {68740, 68804},
-    {68741, 68805},
-    {68742, 68806},
-    {68743, 68807},
-    {68744, 68808},
-    {68745, 68809},
-    {68746, 68810},
-    {68747, 68811},
-    {68748, 68812},
-    {68749, 68813},
-    {68750, 68814},
-    {68751, 68815},
-    {68752, 68816},
-    {68753, 68817},
-    {68754, 68818},
-    {68755, 68819},
-    {68756, 68820},
-    {68757, 68821},
-    {68758, 68822},
-    {68759, 68823},
-    {68760, 68824},
-    {68761, 68825},
-    {68762, 68826},
-    {68763, 68827},
-    {68764, 68828},
-    {68765, 68829},
-    {68766, 68830},
-    {68767, 68831},
-    {68768, 68832},
-    {68769, 68833},
-    {68770, 68834},
-    {68771, 68835},
-    {68772, 68836},
-    {68773, 68837},
-    {68774, 68838},
-    {68775, 68839},
-    {68776, 68840},
-    {68777, 68841},
-    {68778, 68842},
-    {68779, 68843},
-    {68780, 68844},
-    {68781, 68845},
-    {68782, 68846},
-    {68783, 68847},
-    {68784, 68848},
-    {68785, 68849},
-    {68786, 68850},
-    {71840, 71872},
-    {71841, 71873},
-    {71842, 71874},
-    {71843, 71875},
-    {71844, 71876},
-    {71845, 71877},
-    {71846, 71878},
-    {71847, 71879},
-    {71848, 71880},
-    {71849, 71881},
-    {71850, 71882},
-    {71851, 71883},
-    {71852, 71884},
-    {71853, 71885},
-    {71854, 71886},
-    {71855, 71887},
-    {71856, 71888},
-    {71857, 71889},
-    {71858, 71890},
-    {71859, 71891},
-    {71860, 71892},
-    {71861, 71893},
-    {71862, 71894},
-    {71863, 71895},
-    {71864, 71896},
-    {71865, 71897},
-    {71866, 71898},
-    {71867, 71899},
-    {71868, 71900},
-    {71869, 71901},
-    {71870, 71902},
-    {71871, 71903},
-    {93760, 93792},
-    {93761, 93793},
-    {93762, 93794},
-    {93763, 93795},
-    {93764, 93796},
-    {93765, 93797},
-    {93766, 93798},
-    {93767, 93799},
-    {93768, 93800},
-    {93769, 93801},
-    {93770, 93802},
-    {93771, 93803},
-    {93772, 93804},
-    {93773, 93805},
-    {93774, 93806},
-    {93775, 93807},
-    {93776, 93808},
-    {93777, 93809},
-    {93778, 93810},
-    {93779, 93811},
-    {93780, 93812},
-    {93781, 93813},
-    {93782, 93814},
-    {93783, 93815},
-    {93784, 93816},
-    {93785, 93817},
-    {93786, 93818},
-    {93787, 93819},
-    {93788, 93820},
-    {93789, 93821},
-    {93790, 93822},
-    {93791, 93823},
-    {125184, 125218},
-    {125185, 125219},
-    {125186, 125220},
-    {125187, 125221},
-    {125188, 125222},
-    {125189, 125223},
-    {125190, 125224},
-    {125191, 125225},
-    {125192, 125226},
-    {125193, 125227},
-    {125194, 125228},
-    {125195, 125229},
-    {125196, 125230},
-    {125197, 125231},
-    {125198, 125232},
-    {125199, 125233},
-    {125200, 125234},
-    {125201, 125235},
-    {125202, 125236},
-    {125203, 125237},
-    {125204, 125238},
-    {125205, 125239},
-    {125206, 125240},
-    {125207, 125241},
-    {125208, 125242},
-    {125209, 125243},
-    {125210, 125244},
-    {125211, 125245},
-    {125212, 125246},
-    {125213, 125247},
-    {125214, 125248},
-    {125215, 125249},
-    {125216, 125250},
-    {125217, 125251},
-    };
+const uint8_t unicode_property_stage1[UNICODE_PROPERTY_STAGE1_ENTRIES] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 27, 27,
+    27, 27, 27, 27, 27, 27, 30, 31, 32, 33, 27, 34, 35, 27, 27, 36,
+    27, 37, 27, 38, 27, 27, 27, 39, 27, 40, 27, 41, 27, 27, 27, 27,
+    42, 27, 43, 27, 27, 27, 44, 27, 27, 27, 27, 45, 27, 27, 27, 27,
+    46, 27, 47, 48, 49, 50, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 51, 52, 52, 52, 52,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 54, 55, 56, 57,
+    58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73,
+    27, 74, 75, 76, 76, 76, 76, 77, 27, 27, 78, 76, 76, 76, 76, 76,
+    76, 76, 27, 79, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 27, 80, 76, 81, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 82, 27, 27, 83, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 84, 85, 86, 76, 76, 76, 76, 87, 76,
+    76, 76, 76, 76, 76, 76, 76, 88, 89, 90, 91, 92, 93, 94, 76, 95,
+    96, 97, 76, 98, 99, 76, 100, 101, 102, 103, 93, 104, 105, 106, 76, 76,
+    107, 27, 27, 27, 108, 109, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 110, 27, 27, 111, 27, 27, 27, 27, 27, 27, 27, 27, 112, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 113, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 114, 27, 27, 27, 27, 27, 27, 27, 115, 116, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 117, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 118, 76, 76, 76, 76, 76, 76, 119, 120, 76, 76,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 121, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    122, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 123,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 123,
+};
+
+const uint16_t unicode_property_stage2[UNICODE_PROPERTY_STAGE2_ENTRIES] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 1, 9, 10, 11, 12, 13, 14,
+    15, 15, 15, 16, 17, 15, 15, 18, 19, 20, 21, 22, 23, 24, 15, 25,
+    15, 15, 15, 26, 27, 13, 13, 13, 13, 28, 13, 29, 30, 31, 32, 33,
+    34, 34, 34, 34, 34, 34, 34, 35, 36, 37, 38, 13, 39, 40, 15, 41,
+    11, 11, 11, 13, 13, 13, 15, 15, 42, 15, 15, 15, 43, 15, 15, 15,
+    15, 15, 15, 44, 11, 45, 13, 13, 46, 47, 34, 48, 49, 50, 51, 52,
+    53, 54, 50, 50, 55, 34, 56, 57, 50, 50, 50, 50, 50, 58, 59, 60,
+    61, 62, 50, 34, 63, 50, 50, 50, 50, 50, 64, 65, 66, 50, 67, 68,
+    50, 69, 70, 71, 50, 72, 73, 50, 74, 75, 50, 50, 76, 34, 77, 34,
+    78, 50, 50, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91,
+    92, 85, 86, 93, 94, 95, 96, 97, 98, 99, 86, 100, 101, 102, 90, 103,
+    104, 85, 86, 105, 106, 107, 90, 108, 109, 110, 111, 112, 113, 114, 96, 115,
+    116, 117, 86, 118, 119, 120, 90, 121, 122, 117, 86, 123, 124, 125, 90, 126,
+    127, 117, 50, 128, 129, 130, 90, 131, 132, 133, 50, 134, 135, 136, 96, 137,
+    138, 50, 50, 139, 140, 141, 142, 142, 143, 50, 144, 145, 146, 147, 142, 142,
+    148, 149, 150, 151, 152, 50, 153, 154, 155, 156, 34, 157, 158, 159, 142, 142,
+    50, 50, 160, 161, 162, 163, 164, 165, 166, 167, 11, 11, 168, 13, 13, 169,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 170, 171, 50, 50, 170, 50, 50, 172, 173, 174, 50, 50,
+    50, 173, 50, 50, 50, 175, 176, 177, 50, 178, 11, 11, 11, 11, 11, 179,
+    180, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 181, 50, 182, 183, 50, 50, 50, 50, 184, 185,
+    50, 186, 50, 187, 50, 188, 189, 190, 50, 50, 50, 191, 192, 193, 194, 195,
+    196, 194, 50, 50, 197, 50, 50, 198, 199, 50, 200, 50, 50, 50, 50, 201,
+    50, 202, 203, 204, 205, 50, 206, 207, 50, 50, 208, 50, 209, 210, 211, 211,
+    50, 212, 50, 50, 50, 213, 214, 215, 194, 194, 216, 217, 218, 142, 142, 142,
+    219, 50, 50, 220, 221, 162, 222, 223, 224, 50, 225, 66, 50, 50, 226, 227,
+    50, 50, 228, 229, 230, 66, 50, 231, 232, 11, 11, 233, 234, 235, 236, 237,
+    13, 13, 238, 29, 29, 29, 239, 240, 13, 241, 29, 29, 34, 34, 34, 34,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 242, 15, 15, 15, 15, 15, 15,
+    243, 244, 243, 243, 244, 245, 243, 246, 247, 247, 247, 248, 249, 250, 251, 252,
+    253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 263, 264, 265, 266, 267,
+    268, 269, 270, 271, 272, 273, 274, 274, 275, 276, 277, 211, 278, 279, 211, 280,
+    281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281,
+    282, 211, 283, 211, 211, 211, 211, 284, 211, 285, 281, 286, 211, 287, 288, 211,
+    211, 211, 289, 142, 290, 142, 273, 273, 273, 291, 211, 211, 211, 211, 292, 273,
+    211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 293, 294, 211, 211, 295,
+    211, 211, 211, 211, 211, 211, 296, 211, 211, 211, 211, 211, 211, 211, 211, 211,
+    211, 211, 211, 211, 211, 211, 297, 298, 273, 299, 211, 211, 300, 281, 301, 281,
+    211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211,
+    281, 281, 281, 281, 281, 281, 281, 281, 302, 303, 281, 281, 281, 304, 281, 305,
+    281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281,
+    211, 211, 211, 281, 306, 211, 211, 307, 211, 308, 211, 211, 211, 211, 211, 211,
+    11, 11, 11, 13, 13, 13, 309, 310, 15, 15, 15, 15, 15, 15, 311, 312,
+    13, 13, 313, 50, 50, 50, 314, 315, 50, 316, 317, 317, 317, 317, 34, 34,
+    318, 319, 320, 321, 322, 323, 142, 142, 211, 324, 211, 211, 211, 211, 211, 325,
+    211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 326, 142, 327,
+    328, 329, 330, 331, 138, 50, 50, 50, 50, 332, 180, 50, 50, 50, 50, 333,
+    334, 50, 50, 138, 50, 50, 50, 50, 202, 335, 50, 50, 211, 211, 325, 50,
+    211, 336, 337, 211, 338, 339, 211, 211, 337, 211, 211, 339, 211, 211, 211, 211,
+    211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211,
+    340, 50, 50, 50, 50, 50, 50, 50, 341, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 342, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 343, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 211, 211, 211, 211,
+    344, 50, 50, 50, 50, 343, 50, 50, 345, 346, 50, 347, 348, 347, 349, 50,
+    343, 50, 50, 50, 50, 50, 50, 348, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    350, 50, 50, 50, 351, 50, 352, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 353, 50, 50, 50, 50, 50, 50, 50, 354, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 355, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 356,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 342, 50, 50, 50, 50, 50, 50, 50, 357,
+    358, 348, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 359,
+    50, 50, 50, 50, 345, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 360, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    351, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 351, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 359, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 351, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 345, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 359, 341, 50, 50, 50, 50,
+    50, 50, 50, 348, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 361, 50, 362, 50, 50, 349, 50, 50, 50, 50, 50, 50, 50, 351,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 363, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 153, 211, 211, 211, 289, 50, 50, 231,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    364, 50, 365, 142, 15, 15, 366, 367, 15, 368, 50, 50, 50, 50, 369, 370,
+    33, 371, 372, 373, 15, 15, 15, 374, 375, 376, 377, 378, 379, 380, 142, 381,
+    382, 50, 383, 384, 50, 50, 50, 385, 386, 50, 50, 387, 388, 194, 34, 389,
+    66, 50, 390, 50, 391, 392, 50, 153, 78, 50, 50, 393, 394, 395, 396, 397,
+    50, 50, 398, 399, 400, 401, 50, 402, 50, 50, 50, 403, 404, 405, 406, 407,
+    408, 409, 317, 13, 13, 410, 411, 13, 13, 13, 13, 13, 50, 50, 412, 194,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 413, 50, 414, 50, 50, 208,
+    415, 415, 415, 415, 415, 415, 415, 415, 415, 415, 415, 415, 415, 415, 415, 415,
+    415, 415, 415, 415, 415, 415, 415, 415, 415, 415, 415, 415, 415, 415, 415, 415,
+    416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416,
+    416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416,
+    416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416,
+    50, 50, 50, 50, 50, 50, 355, 417, 50, 50, 50, 360, 50, 418, 50, 343,
+    50, 50, 50, 50, 50, 50, 206, 50, 50, 50, 50, 50, 50, 209, 142, 142,
+    419, 420, 421, 422, 423, 50, 50, 50, 50, 50, 50, 424, 425, 426, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 427, 211, 50, 50, 50, 50, 428, 50, 50, 429, 142, 142, 430,
+    34, 431, 34, 432, 433, 434, 435, 436, 50, 50, 50, 50, 50, 50, 50, 437,
+    438, 3, 4, 5, 6, 439, 440, 441, 50, 442, 50, 202, 443, 444, 445, 446,
+    447, 50, 174, 448, 206, 206, 142, 142, 50, 50, 50, 50, 50, 50, 50, 73,
+    449, 273, 273, 450, 274, 274, 274, 451, 452, 453, 454, 142, 142, 211, 211, 455,
+    142, 142, 142, 142, 142, 142, 142, 142, 50, 153, 50, 50, 50, 102, 456, 457,
+    50, 50, 458, 50, 459, 50, 50, 460, 50, 461, 50, 50, 462, 463, 142, 142,
+    11, 11, 464, 13, 13, 50, 50, 50, 50, 206, 194, 11, 11, 465, 13, 466,
+    50, 50, 467, 50, 50, 50, 468, 469, 469, 470, 471, 472, 142, 142, 142, 142,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 316, 50, 201, 467, 142, 473, 29, 29, 474, 142, 142, 142, 142,
+    475, 50, 50, 476, 50, 477, 50, 478, 50, 202, 479, 142, 142, 142, 50, 480,
+    50, 481, 50, 482, 142, 142, 142, 142, 50, 50, 50, 483, 273, 484, 273, 273,
+    485, 486, 50, 487, 488, 489, 50, 490, 50, 491, 142, 142, 492, 50, 493, 494,
+    50, 50, 50, 495, 50, 496, 50, 497, 50, 498, 499, 142, 142, 142, 142, 142,
+    50, 50, 50, 50, 198, 142, 142, 142, 11, 11, 11, 500, 13, 13, 13, 501,
+    50, 50, 502, 194, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 273, 503, 50, 50, 504, 505, 142, 142, 142, 142,
+    50, 491, 506, 50, 64, 507, 142, 50, 508, 142, 142, 50, 509, 142, 50, 316,
+    510, 50, 50, 511, 512, 484, 513, 514, 224, 50, 50, 515, 516, 50, 198, 194,
+    517, 50, 518, 519, 520, 50, 50, 521, 224, 50, 50, 522, 523, 524, 525, 526,
+    50, 99, 527, 528, 142, 142, 142, 142, 529, 530, 531, 50, 50, 532, 533, 194,
+    534, 85, 86, 535, 536, 537, 538, 539, 142, 142, 142, 142, 142, 142, 142, 142,
+    50, 50, 50, 540, 541, 542, 505, 142, 50, 50, 50, 543, 544, 194, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 50, 50, 545, 546, 547, 548, 142, 142,
+    50, 50, 50, 549, 550, 194, 551, 142, 50, 50, 552, 553, 194, 142, 142, 142,
+    50, 175, 554, 555, 316, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    50, 50, 527, 556, 142, 142, 142, 142, 142, 142, 11, 11, 13, 13, 150, 557,
+    558, 559, 50, 560, 561, 194, 142, 142, 142, 142, 562, 50, 50, 563, 564, 142,
+    565, 50, 50, 566, 567, 568, 50, 50, 569, 570, 571, 50, 50, 50, 50, 198,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    86, 50, 545, 572, 573, 150, 177, 574, 50, 575, 576, 577, 142, 142, 142, 142,
+    578, 50, 50, 579, 580, 194, 581, 50, 582, 583, 194, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 50, 584,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 102, 273, 585, 586, 587,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 209, 142, 142, 142, 142, 142, 142,
+    274, 274, 274, 274, 274, 274, 588, 589, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 413, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 50, 50, 50, 50, 50, 50, 590,
+    50, 50, 202, 591, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    50, 50, 50, 50, 316, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    50, 50, 50, 198, 50, 202, 395, 50, 50, 50, 50, 202, 194, 50, 206, 592,
+    50, 50, 50, 593, 594, 595, 596, 597, 50, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 11, 11, 13, 13, 273, 598, 142, 142, 142, 142, 142, 142,
+    50, 50, 50, 50, 599, 600, 601, 601, 602, 603, 142, 142, 142, 142, 604, 605,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 467,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 201, 142, 142,
+    198, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 606,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 607, 142, 142, 607, 608, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 208,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    50, 50, 50, 50, 50, 50, 73, 153, 198, 609, 610, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    34, 34, 611, 34, 612, 211, 211, 211, 211, 211, 211, 211, 325, 142, 142, 142,
+    211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 326,
+    211, 211, 613, 211, 211, 211, 614, 615, 616, 211, 617, 211, 211, 211, 290, 142,
+    211, 211, 211, 211, 618, 142, 142, 142, 142, 142, 142, 142, 142, 142, 273, 619,
+    211, 211, 211, 211, 211, 289, 273, 488, 142, 142, 142, 142, 142, 142, 142, 142,
+    11, 620, 13, 621, 622, 623, 243, 11, 624, 625, 626, 627, 628, 11, 620, 13,
+    629, 630, 13, 631, 632, 633, 634, 11, 635, 13, 11, 620, 13, 621, 622, 13,
+    243, 11, 624, 634, 11, 635, 13, 11, 620, 13, 636, 11, 637, 638, 639, 640,
+    13, 641, 11, 642, 643, 644, 645, 13, 646, 11, 647, 13, 648, 649, 649, 649,
+    211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211,
+    211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211,
+    34, 34, 34, 650, 34, 34, 651, 652, 653, 654, 47, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    655, 656, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    657, 658, 659, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    50, 50, 153, 660, 661, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 50, 662, 142, 50, 50, 663, 664,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 665, 202,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 666, 612, 142, 142,
+    11, 11, 624, 13, 667, 395, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 525, 273, 273, 668, 669, 142, 142, 142, 142,
+    525, 273, 670, 671, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    672, 50, 673, 674, 675, 676, 677, 678, 679, 208, 680, 208, 142, 142, 142, 681,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    211, 211, 327, 211, 211, 211, 211, 211, 211, 325, 336, 682, 682, 682, 211, 326,
+    683, 211, 211, 211, 211, 211, 211, 211, 211, 211, 684, 142, 142, 142, 685, 211,
+    686, 211, 211, 327, 687, 688, 326, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 689,
+    211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 690, 453, 453,
+    211, 211, 211, 211, 211, 211, 211, 325, 211, 211, 211, 211, 211, 687, 327, 454,
+    327, 211, 211, 211, 691, 178, 211, 211, 691, 211, 684, 688, 142, 142, 142, 142,
+    211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211,
+    211, 211, 211, 211, 211, 325, 684, 692, 289, 211, 453, 290, 326, 178, 691, 289,
+    211, 211, 211, 211, 211, 211, 211, 211, 211, 693, 211, 211, 290, 142, 142, 194,
+    361, 50, 50, 50, 50, 50, 350, 50, 50, 50, 50, 50, 50, 50, 360, 50,
+    50, 50, 361, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 342, 50, 50, 50, 50, 50, 694, 345, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 342, 343,
+    50, 695, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 348, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 349, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 355, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 343, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 142, 142,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 198, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 206, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 505, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 102, 142,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 348, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 206, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 73, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    696, 142, 697, 697, 697, 697, 697, 697, 142, 142, 142, 142, 142, 142, 142, 142,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 142,
+    416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416,
+    416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 698,
+};
+
+const uint8_t unicode_property_stage3[UNICODE_PROPERTY_STAGE3_ENTRIES] = {
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 57, 57, 57, 57, 57, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    54, 17, 17, 17, 19, 17, 17, 17, 13, 14, 17, 18, 17, 12, 17, 17,
+    72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 17, 17, 18, 18, 18, 17,
+    17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 17, 14, 20, 11,
+    20, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 13, 18, 14, 18, 25,
+    25, 25, 25, 25, 25, 57, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    54, 17, 19, 19, 19, 19, 21, 17, 20, 21, 4, 15, 18, 26, 21, 20,
+    21, 18, 74, 74, 20, 1, 17, 17, 20, 74, 4, 16, 74, 74, 74, 17,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 18, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 1, 0, 1, 0, 1, 0, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 1, 0, 1, 0, 1, 1,
+    1, 0, 0, 1, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 0,
+    0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0,
+    0, 1, 0, 1, 0, 1, 0, 0, 1, 0, 1, 1, 0, 1, 0, 0,
+    1, 0, 0, 0, 1, 0, 1, 0, 0, 1, 1, 4, 0, 1, 1, 1,
+    4, 4, 4, 4, 0, 2, 1, 0, 2, 1, 0, 2, 1, 0, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 1, 0, 1,
+    1, 0, 2, 1, 0, 1, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 0, 0, 1,
+    1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    1, 1, 1, 1, 4, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 20, 20, 20, 20, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    3, 3, 3, 3, 3, 20, 20, 20, 20, 20, 20, 20, 3, 20, 3, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    0, 1, 0, 1, 3, 20, 0, 1, 29, 29, 3, 1, 1, 1, 17, 0,
+    29, 29, 29, 29, 20, 20, 0, 17, 0, 0, 0, 29, 0, 29, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 29, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    1, 1, 0, 0, 0, 1, 1, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    1, 1, 1, 1, 0, 1, 18, 0, 1, 0, 0, 1, 1, 0, 0, 0,
+    0, 1, 21, 5, 5, 5, 5, 5, 7, 7, 0, 1, 0, 1, 0, 1,
+    0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 1,
+    29, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 29, 29, 3, 17, 17, 17, 17, 17, 17,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 17, 12, 29, 29, 21, 21, 19,
+    29, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 12, 5,
+    17, 5, 5, 17, 5, 5, 17, 5, 29, 29, 29, 29, 29, 29, 29, 29,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 29, 29, 29, 4,
+    4, 4, 4, 17, 17, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    26, 26, 26, 26, 26, 26, 18, 18, 18, 17, 17, 19, 17, 17, 21, 21,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 17, 26, 17, 17, 17,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5,
+    72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 17, 17, 17, 17, 4, 4,
+    5, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 17, 4, 5, 5, 5, 5, 5, 5, 5, 26, 21, 5,
+    5, 5, 5, 5, 5, 3, 3, 5, 5, 21, 5, 5, 5, 5, 4, 4,
+    72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 4, 4, 4, 21, 21, 4,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 29, 26,
+    4, 5, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 29, 29, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 4, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 3, 3, 21, 17, 17, 17, 3, 29, 29, 5, 19, 19,
+    4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 3, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 3, 5, 5, 5, 3, 5, 5, 5, 5, 5, 29, 29,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 29,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 29, 29, 17, 29,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 29, 29, 29, 29,
+    4, 4, 4, 4, 4, 4, 4, 4, 20, 4, 4, 4, 4, 4, 4, 29,
+    26, 26, 29, 29, 29, 29, 29, 29, 5, 5, 5, 5, 5, 5, 5, 5,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 5, 5, 5, 5, 5, 5,
+    5, 5, 26, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 6, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 6, 5, 4, 6, 6,
+    6, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 5, 6, 6,
+    4, 5, 5, 5, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 5, 5, 17, 17, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+    17, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 5, 6, 6, 29, 4, 4, 4, 4, 4, 4, 4, 4, 29, 29, 4,
+    4, 29, 29, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 4, 4, 4, 4, 4, 4,
+    4, 29, 4, 29, 29, 29, 4, 4, 4, 4, 29, 29, 5, 4, 6, 6,
+    6, 5, 5, 5, 5, 29, 29, 6, 6, 29, 29, 6, 6, 5, 4, 29,
+    29, 29, 29, 29, 29, 29, 29, 6, 29, 29, 29, 29, 4, 4, 29, 4,
+    4, 4, 5, 5, 29, 29, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+    4, 4, 19, 19, 74, 74, 74, 74, 74, 74, 21, 19, 4, 17, 5, 29,
+    29, 5, 5, 6, 29, 4, 4, 4, 4, 4, 4, 29, 29, 29, 29, 4,
+    4, 29, 4, 4, 29, 4, 4, 29, 4, 4, 29, 29, 5, 29, 6, 6,
+    6, 5, 5, 29, 29, 29, 29, 5, 5, 29, 29, 5, 5, 5, 29, 29,
+    29, 5, 29, 29, 29, 29, 29, 29, 29, 4, 4, 4, 4, 29, 4, 29,
+    29, 29, 29, 29, 29, 29, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+    5, 5, 4, 4, 4, 5, 17, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 5, 5, 6, 29, 4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 4,
+    4, 4, 29, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 29, 4, 4, 29, 4, 4, 4, 4, 4, 29, 29, 5, 4, 6, 6,
+    6, 5, 5, 5, 5, 5, 29, 5, 5, 6, 29, 6, 6, 5, 29, 29,
+    4, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    17, 19, 29, 29, 29, 29, 29, 29, 29, 4, 5, 5, 5, 5, 5, 5,
+    29, 5, 6, 6, 29, 4, 4, 4, 4, 4, 4, 4, 4, 29, 29, 4,
+    4, 29, 4, 4, 29, 4, 4, 4, 4, 4, 29, 29, 5, 4, 6, 5,
+    6, 5, 5, 5, 5, 29, 29, 6, 6, 29, 29, 6, 6, 5, 29, 29,
+    29, 29, 29, 29, 29, 5, 5, 6, 29, 29, 29, 29, 4, 4, 29, 4,
+    21, 4, 74, 74, 74, 74, 74, 74, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 5, 4, 29, 4, 4, 4, 4, 4, 4, 29, 29, 29, 4, 4,
+    4, 29, 4, 4, 4, 4, 29, 29, 29, 4, 4, 29, 4, 29, 4, 4,
+    29, 29, 29, 4, 4, 29, 29, 29, 4, 4, 4, 29, 29, 29, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 29, 29, 29, 6, 6,
+    5, 6, 6, 29, 29, 29, 6, 6, 6, 29, 6, 6, 6, 5, 29, 29,
+    4, 29, 29, 29, 29, 29, 29, 6, 29, 29, 29, 29, 29, 29, 29, 29,
+    74, 74, 74, 21, 21, 21, 21, 21, 21, 19, 21, 29, 29, 29, 29, 29,
+    5, 6, 6, 6, 5, 4, 4, 4, 4, 4, 4, 4, 4, 29, 4, 4,
+    4, 29, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 29, 5, 4, 5, 5,
+    5, 6, 6, 6, 6, 29, 5, 5, 5, 29, 5, 5, 5, 5, 29, 29,
+    29, 29, 29, 29, 29, 5, 5, 29, 4, 4, 4, 29, 29, 4, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 17, 74, 74, 74, 74, 74, 74, 74, 21,
+    4, 5, 6, 6, 17, 4, 4, 4, 4, 4, 4, 4, 4, 29, 4, 4,
+    4, 4, 4, 4, 29, 4, 4, 4, 4, 4, 29, 29, 5, 4, 6, 5,
+    6, 6, 6, 6, 6, 29, 5, 6, 6, 29, 6, 6, 5, 5, 29, 29,
+    29, 29, 29, 29, 29, 6, 6, 29, 29, 29, 29, 29, 29, 4, 4, 29,
+    29, 4, 4, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    5, 5, 6, 6, 4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 4, 6, 6,
+    6, 5, 5, 5, 5, 29, 6, 6, 6, 29, 6, 6, 6, 5, 4, 21,
+    29, 29, 29, 29, 4, 4, 4, 6, 74, 74, 74, 74, 74, 74, 74, 4,
+    74, 74, 74, 74, 74, 74, 74, 74, 74, 21, 4, 4, 4, 4, 4, 4,
+    29, 5, 6, 6, 29, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 29, 29, 29, 4, 4, 4, 4, 4, 4,
+    4, 4, 29, 4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 4, 29, 29,
+    4, 4, 4, 4, 4, 4, 4, 29, 29, 29, 5, 29, 29, 29, 29, 6,
+    6, 6, 5, 5, 5, 29, 5, 29, 6, 6, 6, 6, 6, 6, 6, 6,
+    29, 29, 6, 6, 17, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 5, 4, 4, 5, 5, 5, 5, 5, 5, 5, 29, 29, 29, 29, 19,
+    4, 4, 4, 4, 4, 4, 3, 5, 5, 5, 5, 5, 5, 5, 5, 17,
+    72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 17, 17, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 4, 4, 29, 4, 29, 4, 4, 4, 4, 4, 29, 4, 4, 4, 4,
+    4, 4, 4, 4, 29, 4, 29, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 5, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 4, 29, 29,
+    4, 4, 4, 4, 4, 29, 3, 29, 5, 5, 5, 5, 5, 5, 29, 29,
+    72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 29, 29, 4, 4, 4, 4,
+    4, 21, 21, 21, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 21, 17, 21, 21, 21, 5, 5, 21, 21, 21, 21, 21, 21,
+    72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 74, 74, 74, 74, 74, 74,
+    74, 74, 74, 74, 21, 5, 21, 5, 21, 5, 13, 14, 13, 14, 6, 6,
+    4, 4, 4, 4, 4, 4, 4, 4, 29, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 29, 29,
+    29, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6,
+    5, 5, 5, 5, 5, 17, 5, 5, 4, 4, 4, 4, 4, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 29, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 29, 21, 21,
+    21, 21, 21, 21, 21, 21, 5, 21, 21, 21, 21, 21, 21, 29, 21, 21,
+    17, 17, 17, 17, 17, 21, 21, 21, 21, 17, 17, 29, 29, 29, 29, 29,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 6, 6, 5, 5, 5,
+    5, 6, 5, 5, 5, 5, 5, 5, 6, 5, 5, 6, 6, 5, 5, 4,
+    72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 17, 17, 17, 17, 17, 17,
+    4, 4, 4, 4, 4, 4, 6, 6, 5, 5, 4, 4, 4, 4, 5, 5,
+    5, 4, 6, 6, 6, 4, 4, 6, 6, 6, 6, 6, 6, 6, 4, 4,
+    4, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 5, 6, 6, 5, 5, 6, 6, 6, 6, 6, 6, 5, 4, 6,
+    72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 6, 6, 6, 5, 21, 21,
+    0, 0, 0, 0, 0, 0, 29, 0, 29, 29, 29, 29, 29, 0, 29, 29,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 17, 3, 1, 1, 1,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 4, 4, 4, 4, 29, 29,
+    4, 4, 4, 4, 4, 4, 4, 29, 4, 29, 4, 4, 4, 4, 29, 29,
+    4, 29, 4, 4, 4, 4, 29, 29, 4, 4, 4, 4, 4, 4, 4, 29,
+    4, 29, 4, 4, 4, 4, 29, 29, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 29, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 29, 5, 5, 5,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 74, 74, 74, 74, 74, 74, 74,
+    74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 29, 29, 29,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 29, 29, 29, 29, 29, 29,
+    0, 0, 0, 0, 0, 0, 29, 29, 1, 1, 1, 1, 1, 1, 29, 29,
+    12, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 21, 17, 4,
+    54, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 13, 14, 29, 29, 29,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 17, 17, 17, 73, 73,
+    73, 4, 4, 4, 4, 4, 4, 4, 4, 29, 29, 29, 29, 29, 29, 29,
+    4, 4, 5, 5, 5, 6, 29, 29, 29, 29, 29, 29, 29, 29, 29, 4,
+    4, 4, 5, 5, 6, 17, 17, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    4, 4, 5, 5, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 4, 4,
+    4, 29, 5, 5, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    4, 4, 4, 4, 5, 5, 6, 5, 5, 5, 5, 5, 5, 5, 6, 6,
+    6, 6, 6, 6, 6, 6, 5, 6, 6, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 17, 17, 17, 3, 17, 17, 17, 19, 4, 5, 29, 29,
+    72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 29, 29, 29, 29, 29, 29,
+    74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 29, 29, 29, 29, 29, 29,
+    17, 17, 17, 17, 17, 17, 12, 17, 17, 17, 17, 5, 5, 5, 26, 5,
+    4, 4, 4, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 29, 29, 29, 29, 29, 29,
+    4, 4, 4, 4, 4, 5, 5, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 4, 29, 29, 29, 29, 29,
+    4, 4, 4, 4, 4, 4, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 29,
+    5, 5, 5, 6, 6, 6, 6, 5, 5, 6, 6, 6, 29, 29, 29, 29,
+    6, 6, 5, 6, 6, 6, 6, 6, 6, 5, 5, 5, 29, 29, 29, 29,
+    21, 29, 29, 29, 17, 17, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 29,
+    4, 4, 4, 4, 4, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 29, 29, 29,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 29, 29, 29, 29, 29,
+    72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 74, 29, 29, 29, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    4, 4, 4, 4, 4, 4, 4, 5, 5, 6, 6, 5, 29, 29, 17, 17,
+    4, 4, 4, 4, 4, 6, 5, 6, 5, 5, 5, 5, 5, 5, 5, 29,
+    5, 6, 5, 6, 6, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6,
+    6, 6, 6, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 29, 29, 5,
+    17, 17, 17, 17, 17, 17, 17, 3, 17, 17, 17, 17, 17, 17, 29, 29,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 7, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 29,
+    5, 5, 5, 5, 6, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 5, 6, 5, 5, 5, 5, 5, 6, 5, 6, 6, 6,
+    6, 6, 5, 6, 6, 4, 4, 4, 4, 4, 4, 4, 4, 29, 29, 29,
+    17, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 21, 21, 21, 21, 21, 21, 21, 21, 21, 17, 17, 29,
+    5, 5, 6, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 6, 5, 5, 5, 5, 6, 6, 5, 5, 6, 5, 5, 5, 4, 4,
+    4, 4, 4, 4, 4, 4, 5, 6, 5, 5, 6, 6, 6, 5, 6, 5,
+    5, 5, 6, 6, 29, 29, 29, 29, 29, 29, 29, 29, 17, 17, 17, 17,
+    4, 4, 4, 4, 6, 6, 6, 6, 6, 6, 6, 6, 5, 5, 5, 5,
+    5, 5, 5, 5, 6, 6, 5, 5, 29, 29, 29, 17, 17, 17, 17, 17,
+    72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 29, 29, 29, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 3, 3, 3, 3, 3, 3, 17, 17,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 29, 29, 29, 29, 29, 29, 29,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 0, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 29, 29, 29, 29, 29, 29, 29, 29,
+    5, 5, 5, 17, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 6, 5, 5, 5, 5, 5, 5, 5, 4, 4, 4, 4, 5, 4, 4,
+    4, 4, 4, 4, 5, 4, 4, 6, 5, 5, 4, 29, 29, 29, 29, 29,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 3, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 3, 3, 3, 3,
+    0, 1, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 29, 29, 0, 0, 0, 0, 0, 0, 29, 29,
+    1, 1, 1, 1, 1, 1, 1, 1, 29, 0, 29, 0, 29, 0, 29, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 29, 29,
+    1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2,
+    1, 1, 1, 1, 1, 29, 1, 1, 0, 0, 0, 0, 2, 20, 1, 20,
+    20, 20, 1, 1, 1, 29, 1, 1, 0, 0, 0, 0, 2, 20, 20, 20,
+    1, 1, 1, 1, 29, 29, 1, 1, 0, 0, 0, 0, 29, 20, 20, 20,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 20, 20, 20,
+    29, 29, 1, 1, 1, 29, 1, 1, 0, 0, 0, 0, 2, 20, 20, 29,
+    54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 26, 26, 26, 26, 26,
+    12, 12, 12, 12, 12, 12, 17, 17, 15, 16, 13, 15, 15, 16, 13, 15,
+    17, 17, 17, 17, 17, 17, 17, 17, 55, 56, 26, 26, 26, 26, 26, 54,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 15, 16, 17, 17, 17, 17, 11,
+    11, 17, 17, 17, 18, 13, 14, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 18, 17, 11, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 54,
+    26, 26, 26, 26, 26, 29, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    74, 3, 29, 29, 74, 74, 74, 74, 74, 74, 18, 18, 18, 13, 14, 3,
+    74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 18, 18, 18, 13, 14, 29,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 29, 29, 29,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 7, 7, 7,
+    7, 5, 7, 7, 7, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    21, 21, 0, 21, 21, 21, 21, 0, 21, 21, 1, 0, 0, 0, 1, 1,
+    0, 0, 0, 1, 21, 0, 21, 21, 18, 0, 0, 0, 0, 0, 21, 21,
+    21, 21, 21, 21, 0, 21, 0, 21, 0, 21, 0, 0, 0, 0, 21, 1,
+    0, 0, 0, 0, 1, 4, 4, 4, 4, 1, 21, 21, 1, 1, 0, 0,
+    18, 18, 18, 18, 18, 0, 1, 1, 1, 1, 21, 18, 21, 21, 1, 21,
+    74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+    73, 73, 73, 0, 1, 73, 73, 73, 73, 74, 21, 21, 29, 29, 29, 29,
+    18, 18, 18, 18, 18, 21, 21, 21, 21, 21, 18, 18, 21, 21, 21, 21,
+    18, 21, 21, 18, 21, 21, 18, 21, 21, 21, 21, 21, 21, 21, 18, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 18, 18,
+    21, 21, 18, 21, 18, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    21, 21, 21, 21, 21, 21, 21, 21, 13, 14, 13, 14, 21, 21, 21, 21,
+    18, 18, 21, 21, 21, 21, 21, 21, 21, 13, 14, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 18, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 18, 18, 18, 18,
+    18, 18, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 29, 29, 29, 29, 29,
+    74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 74, 74, 74, 74, 74, 74,
+    21, 21, 21, 21, 21, 21, 21, 18, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 18, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 18, 18, 18, 18, 18, 18, 18, 18,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 18,
+    21, 21, 21, 21, 21, 21, 21, 21, 13, 14, 13, 14, 13, 14, 13, 14,
+    13, 14, 13, 14, 13, 14, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    74, 74, 74, 74, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    18, 18, 18, 18, 18, 13, 14, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 13, 14, 13, 14, 13, 14, 13, 14, 13, 14,
+    18, 18, 18, 13, 14, 13, 14, 13, 14, 13, 14, 13, 14, 13, 14, 13,
+    14, 13, 14, 13, 14, 13, 14, 13, 14, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 13, 14, 13, 14, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 13, 14, 18, 18,
+    18, 18, 18, 18, 18, 21, 21, 18, 18, 18, 18, 18, 18, 21, 21, 21,
+    21, 21, 21, 21, 29, 29, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 29, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 0, 1, 0, 0, 0,
+    0, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 3, 3, 0, 0,
+    0, 1, 0, 1, 1, 21, 21, 21, 21, 21, 21, 0, 1, 0, 1, 5,
+    5, 5, 0, 1, 29, 29, 29, 29, 29, 17, 17, 17, 17, 74, 17, 17,
+    1, 1, 1, 1, 1, 1, 29, 1, 29, 29, 29, 29, 29, 1, 29, 29,
+    4, 4, 4, 4, 4, 4, 4, 4, 29, 29, 29, 29, 29, 29, 29, 3,
+    17, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 5,
+    4, 4, 4, 4, 4, 4, 4, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    4, 4, 4, 4, 4, 4, 4, 29, 4, 4, 4, 4, 4, 4, 4, 29,
+    17, 17, 15, 16, 15, 16, 17, 17, 17, 15, 16, 17, 15, 16, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 12, 17, 17, 12, 17, 15, 16, 17, 17,
+    15, 16, 13, 14, 13, 14, 13, 14, 13, 14, 17, 17, 17, 17, 17, 3,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 12, 12, 17, 17, 17, 17,
+    12, 17, 13, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    21, 21, 17, 17, 17, 13, 14, 13, 14, 13, 14, 13, 14, 12, 29, 29,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 29, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    21, 21, 21, 21, 21, 21, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 29, 29, 29, 29,
+    54, 17, 17, 17, 21, 3, 4, 73, 13, 14, 13, 14, 13, 14, 13, 14,
+    13, 14, 21, 21, 13, 14, 13, 14, 13, 14, 13, 14, 12, 13, 14, 14,
+    21, 73, 73, 73, 73, 73, 73, 73, 73, 73, 5, 5, 5, 5, 6, 6,
+    12, 3, 3, 3, 3, 3, 21, 21, 73, 73, 73, 3, 4, 17, 21, 21,
+    4, 4, 4, 4, 4, 4, 4, 29, 29, 5, 5, 20, 20, 3, 3, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 17, 3, 3, 3, 4,
+    29, 29, 29, 29, 29, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    21, 21, 74, 74, 74, 74, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 29,
+    74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 74, 74, 74, 74, 74, 74, 74, 74,
+    21, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    4, 4, 4, 4, 4, 68, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 68, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 68, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 68, 4, 4,
+    68, 4, 4, 68, 4, 4, 4, 68, 4, 68, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 68, 4, 4, 4,
+    4, 4, 4, 4, 68, 4, 68, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 68,
+    68, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 68, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 68, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 68, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 68, 4, 68, 4, 68, 4, 4,
+    4, 68, 4, 68, 68, 68, 4, 4, 4, 4, 4, 4, 68, 4, 4, 4,
+    4, 68, 68, 68, 68, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 68, 4, 4, 4, 4,
+    4, 68, 4, 4, 4, 4, 4, 4, 4, 68, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 68, 68,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 68, 68, 68, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 68, 4,
+    4, 4, 68, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 68, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 68, 4, 4, 4, 4, 4, 68, 4, 4, 4,
+    4, 4, 4, 4, 4, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 17, 17, 17,
+    72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 4, 4, 29, 29, 29, 29,
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 4, 5,
+    7, 7, 7, 17, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 17, 3,
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 3, 3, 5, 5,
+    4, 4, 4, 4, 4, 4, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+    5, 5, 17, 17, 17, 17, 17, 17, 29, 29, 29, 29, 29, 29, 29, 29,
+    20, 20, 20, 20, 20, 20, 20, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    20, 20, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    1, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    3, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 0, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 3, 20, 20, 0, 1, 0, 1, 4,
+    0, 1, 0, 1, 1, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 29, 29, 29, 29, 29,
+    0, 1, 29, 1, 29, 1, 0, 1, 0, 1, 29, 29, 29, 29, 29, 29,
+    29, 29, 3, 3, 3, 0, 1, 4, 3, 3, 1, 4, 4, 4, 4, 4,
+    4, 4, 5, 4, 4, 4, 5, 4, 4, 4, 4, 5, 4, 4, 4, 4,
+    4, 4, 4, 6, 6, 5, 5, 6, 21, 21, 21, 21, 5, 29, 29, 29,
+    74, 74, 74, 74, 74, 74, 21, 21, 19, 21, 29, 29, 29, 29, 29, 29,
+    4, 4, 4, 4, 17, 17, 17, 17, 29, 29, 29, 29, 29, 29, 29, 29,
+    6, 6, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 5, 5, 29, 29, 29, 29, 29, 29, 29, 29, 17, 17,
+    5, 5, 4, 4, 4, 4, 4, 4, 17, 17, 17, 4, 17, 4, 4, 5,
+    4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 17, 17,
+    4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 6, 6, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 17,
+    4, 4, 4, 5, 6, 6, 5, 5, 5, 5, 6, 6, 5, 5, 6, 6,
+    6, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 29, 3,
+    72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 29, 29, 29, 29, 17, 17,
+    4, 4, 4, 4, 4, 5, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 4, 4, 4, 4, 4, 29,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 6,
+    6, 5, 5, 6, 6, 5, 5, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    4, 4, 4, 5, 4, 4, 4, 4, 4, 4, 4, 4, 5, 6, 29, 29,
+    72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 29, 29, 17, 17, 17, 17,
+    3, 4, 4, 4, 4, 4, 4, 21, 21, 21, 4, 6, 5, 6, 4, 4,
+    5, 4, 5, 5, 5, 4, 4, 5, 5, 4, 4, 4, 4, 4, 5, 5,
+    4, 5, 4, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 4, 4, 3, 17, 17,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 6, 5, 5, 6, 6,
+    17, 17, 4, 3, 3, 6, 5, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 4, 4, 4, 4, 4, 4, 29, 29, 4, 4, 4, 4, 4, 4, 29,
+    29, 4, 4, 4, 4, 4, 4, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 20, 3, 3, 3, 3,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 20, 20, 29, 29, 29, 29,
+    4, 4, 4, 6, 6, 5, 6, 6, 5, 6, 6, 17, 6, 5, 29, 29,
+    4, 4, 4, 4, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    4, 4, 4, 4, 4, 4, 4, 29, 29, 29, 29, 4, 4, 4, 4, 4,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    4, 4, 4, 68, 4, 4, 4, 4, 68, 4, 4, 4, 4, 4, 4, 4,
+    4, 68, 4, 68, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    1, 1, 1, 1, 1, 1, 1, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 1, 1, 1, 1, 1, 29, 29, 29, 29, 29, 4, 5, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 18, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 29, 4, 4, 4, 4, 4, 29, 4, 29,
+    4, 4, 29, 4, 4, 29, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 14, 13,
+    29, 29, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 29, 29, 29, 29, 29, 29, 29, 21,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 19, 21, 21, 21,
+    17, 17, 17, 17, 17, 17, 17, 13, 14, 17, 29, 29, 29, 29, 29, 29,
+    17, 12, 12, 11, 11, 13, 14, 13, 14, 13, 14, 13, 14, 13, 14, 13,
+    14, 13, 14, 13, 14, 17, 17, 13, 14, 17, 17, 17, 17, 11, 11, 11,
+    17, 17, 17, 29, 17, 17, 17, 17, 12, 13, 14, 13, 14, 13, 14, 17,
+    17, 17, 18, 12, 18, 18, 18, 29, 17, 19, 17, 17, 29, 29, 29, 29,
+    4, 4, 4, 4, 4, 29, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 29, 26,
+    29, 17, 17, 17, 19, 17, 17, 17, 13, 14, 17, 18, 17, 12, 17, 17,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 13, 18, 14, 18, 13,
+    14, 17, 13, 14, 17, 17, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 3,
+    29, 29, 4, 4, 4, 4, 4, 4, 29, 29, 4, 4, 4, 4, 4, 4,
+    29, 29, 4, 4, 4, 4, 4, 4, 29, 29, 4, 4, 4, 29, 29, 29,
+    19, 19, 18, 20, 21, 19, 19, 29, 21, 18, 18, 18, 18, 21, 21, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 26, 26, 26, 21, 21, 29, 29,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 4, 4, 29, 4,
+    17, 17, 17, 29, 29, 29, 29, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    74, 74, 74, 74, 29, 29, 29, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    73, 73, 73, 73, 73, 74, 74, 74, 74, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 74, 74, 21, 21, 21, 29,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 29, 29, 29,
+    21, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 5, 29, 29,
+    5, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 29, 29, 29, 29,
+    74, 74, 74, 74, 29, 29, 29, 29, 29, 29, 29, 29, 29, 4, 4, 4,
+    4, 73, 4, 4, 4, 4, 4, 4, 4, 4, 73, 29, 29, 29, 29, 29,
+    4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 29, 29, 29, 29, 29,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 17,
+    4, 4, 4, 4, 29, 29, 29, 29, 4, 4, 4, 4, 4, 4, 4, 4,
+    17, 73, 73, 73, 73, 73, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 29, 29, 29, 29, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 29, 29, 29, 29,
+    4, 4, 4, 4, 4, 4, 4, 4, 29, 29, 29, 29, 29, 29, 29, 29,
+    4, 4, 4, 4, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 17,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 0, 0, 0, 0,
+    0, 0, 0, 29, 0, 0, 29, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 29, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 29, 1, 1, 1, 1, 1, 1, 1, 29, 1, 1, 29, 29, 29,
+    3, 3, 3, 3, 3, 3, 29, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 29, 3, 3, 3, 3, 3, 3, 3, 3, 3, 29, 29, 29, 29, 29,
+    4, 4, 4, 4, 4, 4, 29, 29, 4, 29, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 29, 4, 4, 29, 29, 29, 4, 29, 29, 4,
+    4, 4, 4, 4, 4, 4, 29, 17, 74, 74, 74, 74, 74, 74, 74, 74,
+    4, 4, 4, 4, 4, 4, 4, 21, 21, 74, 74, 74, 74, 74, 74, 74,
+    29, 29, 29, 29, 29, 29, 29, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    4, 4, 4, 29, 4, 4, 29, 29, 29, 29, 29, 74, 74, 74, 74, 74,
+    4, 4, 4, 4, 4, 4, 74, 74, 74, 74, 74, 74, 29, 29, 29, 17,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 29, 29, 29, 29, 17,
+    4, 4, 4, 4, 4, 4, 4, 4, 29, 29, 29, 29, 74, 74, 4, 4,
+    29, 29, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    4, 5, 5, 5, 29, 5, 5, 29, 29, 29, 29, 29, 5, 5, 5, 5,
+    4, 4, 4, 4, 29, 4, 4, 4, 29, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 29, 29, 5, 5, 5, 29, 29, 29, 29, 5,
+    74, 74, 74, 74, 74, 74, 74, 74, 74, 29, 29, 29, 29, 29, 29, 29,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 29, 29, 29, 29, 29, 29, 29,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 74, 74, 17,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 74, 74, 74,
+    4, 4, 4, 4, 4, 4, 4, 4, 21, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 5, 5, 29, 29, 29, 29, 74, 74, 74, 74, 74,
+    17, 17, 17, 17, 17, 17, 17, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    4, 4, 4, 4, 4, 4, 29, 29, 29, 17, 17, 17, 17, 17, 17, 17,
+    4, 4, 4, 4, 4, 4, 29, 29, 74, 74, 74, 74, 74, 74, 74, 74,
+    4, 4, 4, 29, 29, 29, 29, 29, 74, 74, 74, 74, 74, 74, 74, 74,
+    4, 4, 29, 29, 29, 29, 29, 29, 29, 17, 17, 17, 17, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 74, 74, 74, 74, 74, 74, 74,
+    0, 0, 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    1, 1, 1, 29, 29, 29, 29, 29, 29, 29, 74, 74, 74, 74, 74, 74,
+    4, 4, 4, 4, 5, 5, 5, 5, 29, 29, 29, 29, 29, 29, 29, 29,
+    74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 29,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 5, 5, 12, 29, 29,
+    4, 4, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    74, 74, 74, 74, 74, 74, 74, 4, 29, 29, 29, 29, 29, 29, 29, 29,
+    5, 74, 74, 74, 74, 17, 17, 17, 17, 17, 29, 29, 29, 29, 29, 29,
+    4, 4, 5, 5, 5, 5, 17, 17, 17, 17, 29, 29, 29, 29, 29, 29,
+    4, 4, 4, 4, 4, 74, 74, 74, 74, 74, 74, 74, 29, 29, 29, 29,
+    6, 5, 6, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 17, 17, 17, 17, 17, 17, 17, 29, 29,
+    74, 74, 74, 74, 74, 74, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+    5, 4, 4, 5, 5, 4, 29, 29, 29, 29, 29, 29, 29, 29, 29, 5,
+    6, 6, 6, 5, 5, 5, 5, 6, 6, 5, 5, 17, 17, 26, 17, 17,
+    17, 17, 5, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 26, 29, 29,
+    5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 6, 5, 5, 5,
+    5, 5, 5, 5, 5, 29, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+    17, 17, 17, 17, 4, 6, 6, 4, 29, 29, 29, 29, 29, 29, 29, 29,
+    4, 4, 4, 5, 17, 17, 4, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    4, 4, 4, 6, 6, 6, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6,
+    6, 4, 4, 4, 4, 17, 17, 17, 17, 5, 5, 5, 5, 17, 6, 5,
+    72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 4, 17, 4, 17, 17, 17,
+    29, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    74, 74, 74, 74, 74, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 6, 6, 6, 5,
+    5, 5, 6, 6, 5, 6, 5, 5, 17, 17, 17, 17, 17, 17, 5, 29,
+    4, 4, 4, 4, 4, 4, 4, 29, 4, 29, 4, 4, 4, 4, 29, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 17, 29, 29, 29, 29, 29, 29,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5,
+    6, 6, 6, 5, 5, 5, 5, 5, 5, 5, 5, 29, 29, 29, 29, 29,
+    5, 5, 6, 6, 29, 4, 4, 4, 4, 4, 4, 4, 4, 29, 29, 4,
+    4, 29, 4, 4, 29, 4, 4, 4, 4, 4, 29, 5, 5, 4, 6, 6,
+    5, 6, 6, 6, 6, 29, 29, 6, 6, 29, 29, 6, 6, 6, 29, 29,
+    4, 29, 29, 29, 29, 29, 29, 6, 29, 29, 29, 29, 29, 4, 4, 4,
+    4, 4, 6, 6, 29, 29, 5, 5, 5, 5, 5, 5, 5, 29, 29, 29,
+    5, 5, 5, 5, 5, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    4, 4, 4, 4, 4, 6, 6, 6, 5, 5, 5, 5, 5, 5, 5, 5,
+    6, 6, 5, 5, 5, 6, 5, 4, 4, 4, 4, 17, 17, 17, 17, 17,
+    72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 17, 17, 29, 17, 5, 4,
+    6, 6, 6, 5, 5, 5, 5, 5, 5, 6, 5, 6, 6, 6, 6, 5,
+    5, 6, 5, 5, 4, 4, 17, 4, 29, 29, 29, 29, 29, 29, 29, 29,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 6,
+    6, 6, 5, 5, 5, 5, 29, 29, 6, 6, 6, 6, 5, 5, 6, 5,
+    5, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 4, 4, 4, 4, 5, 5, 29, 29,
+    6, 6, 6, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 5, 6, 5,
+    5, 17, 17, 17, 4, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 29, 29, 29,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 6, 5, 6, 6,
+    5, 5, 5, 5, 5, 5, 6, 5, 4, 17, 29, 29, 29, 29, 29, 29,
+    6, 6, 5, 5, 5, 5, 6, 5, 5, 5, 5, 5, 29, 29, 29, 29,
+    72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 74, 74, 17, 17, 17, 21,
+    5, 5, 5, 5, 5, 5, 5, 5, 6, 5, 5, 17, 29, 29, 29, 29,
+    74, 74, 74, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 4,
+    4, 4, 4, 4, 4, 4, 4, 29, 29, 4, 29, 29, 4, 4, 4, 4,
+    4, 4, 4, 4, 29, 4, 4, 29, 4, 4, 4, 4, 4, 4, 4, 4,
+    6, 6, 6, 6, 6, 6, 29, 6, 6, 29, 29, 5, 5, 6, 5, 4,
+    6, 4, 6, 5, 17, 17, 17, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    4, 4, 4, 4, 4, 4, 4, 4, 29, 29, 4, 4, 4, 4, 4, 4,
+    4, 6, 6, 6, 5, 5, 5, 5, 29, 29, 5, 5, 6, 6, 6, 6,
+    5, 4, 17, 4, 6, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 4, 4, 4, 4, 4,
+    4, 4, 4, 5, 5, 5, 5, 5, 5, 6, 4, 5, 5, 5, 5, 17,
+    17, 17, 17, 17, 17, 17, 17, 5, 29, 29, 29, 29, 29, 29, 29, 29,
+    4, 5, 5, 5, 5, 5, 5, 6, 6, 5, 5, 5, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 6, 5, 5, 17, 17, 17, 4, 17, 17,
+    17, 17, 17, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    5, 5, 5, 5, 5, 5, 5, 29, 5, 5, 5, 5, 5, 5, 6, 5,
+    4, 17, 17, 17, 17, 17, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    17, 17, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    29, 29, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 29, 6, 5, 5, 5, 5, 5, 5,
+    5, 6, 5, 5, 6, 5, 5, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    4, 4, 4, 4, 4, 4, 4, 29, 4, 4, 29, 4, 4, 4, 4, 4,
+    4, 5, 5, 5, 5, 5, 5, 29, 29, 29, 5, 29, 5, 5, 29, 5,
+    5, 5, 5, 5, 5, 5, 4, 5, 29, 29, 29, 29, 29, 29, 29, 29,
+    4, 4, 4, 4, 4, 4, 29, 4, 4, 29, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 6, 6, 6, 6, 6, 29,
+    5, 5, 29, 6, 6, 5, 6, 5, 4, 29, 29, 29, 29, 29, 29, 29,
+    4, 4, 4, 5, 5, 6, 6, 17, 17, 29, 29, 29, 29, 29, 29, 29,
+    74, 74, 74, 74, 74, 21, 21, 21, 21, 21, 21, 21, 21, 19, 19, 19,
+    19, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 17,
+    73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 29,
+    17, 17, 17, 17, 17, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    4, 17, 17, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 29, 29, 29, 29, 29, 29, 29,
+    5, 5, 5, 5, 5, 17, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    5, 5, 5, 5, 5, 5, 5, 17, 17, 17, 17, 17, 21, 21, 21, 21,
+    3, 3, 3, 3, 17, 21, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 29, 74, 74, 74, 74, 74,
+    74, 74, 29, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 29, 29, 29, 29, 29, 4, 4, 4,
+    74, 74, 74, 74, 74, 74, 74, 17, 17, 17, 17, 29, 29, 29, 29, 29,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 29, 29, 29, 5,
+    4, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 29, 29, 29, 29, 29, 29, 29, 5,
+    5, 5, 5, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 17, 3, 5, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    6, 6, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    3, 3, 3, 3, 29, 3, 3, 3, 3, 3, 3, 3, 29, 3, 3, 29,
+    4, 4, 4, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 4, 4, 4, 4, 29, 29, 29, 29, 29, 29, 29, 29,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 29, 21, 5, 5, 17,
+    26, 26, 26, 26, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 29, 29,
+    5, 5, 5, 5, 5, 5, 5, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    21, 21, 21, 21, 21, 21, 21, 29, 29, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 6, 6, 5, 5, 5, 21, 21, 21, 6, 6, 6,
+    6, 6, 6, 26, 26, 26, 26, 26, 26, 26, 26, 5, 5, 5, 5, 5,
+    5, 5, 5, 21, 21, 5, 5, 5, 5, 5, 5, 5, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 5, 5, 5, 5, 21, 21,
+    21, 21, 5, 5, 5, 21, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    74, 74, 74, 74, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 29, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 29, 0, 0,
+    29, 29, 0, 29, 29, 0, 0, 29, 29, 0, 0, 0, 0, 29, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 29, 1, 29, 1, 1, 1,
+    1, 1, 1, 1, 29, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 29, 0, 0, 0, 0, 29, 29, 0, 0, 0,
+    0, 0, 0, 0, 0, 29, 0, 0, 0, 0, 0, 0, 0, 29, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 29, 0, 0, 0, 0, 29,
+    0, 0, 0, 0, 0, 29, 0, 29, 29, 29, 0, 0, 0, 0, 0, 0,
+    0, 29, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 29, 29, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 18, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 18, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 18, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 18, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 18,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 18, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 18, 1, 1, 1, 1, 1, 1, 0, 1, 29, 29, 72, 72,
+    72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+    5, 5, 5, 5, 5, 5, 5, 21, 21, 21, 21, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 21, 21, 21,
+    21, 21, 21, 21, 21, 5, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 5, 21, 21, 17, 17, 17, 17, 17, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 5, 5, 5, 5, 5,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 4, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 29,
+    5, 5, 5, 5, 5, 5, 5, 29, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 29, 29, 5, 5, 5, 5, 5,
+    5, 5, 29, 5, 5, 29, 5, 5, 5, 5, 5, 29, 29, 29, 29, 29,
+    5, 5, 5, 5, 5, 5, 5, 3, 3, 3, 3, 3, 3, 3, 29, 29,
+    72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 29, 29, 29, 29, 4, 21,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 29,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5,
+    72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 29, 29, 29, 29, 29, 19,
+    4, 4, 4, 4, 4, 4, 4, 29, 4, 4, 4, 4, 29, 4, 4, 29,
+    4, 4, 4, 4, 4, 29, 29, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    1, 1, 1, 1, 5, 5, 5, 5, 5, 5, 5, 3, 29, 29, 29, 29,
+    74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 21, 74, 74, 74,
+    19, 74, 74, 74, 74, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 21, 74,
+    74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 29, 29,
+    4, 4, 4, 4, 29, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    29, 4, 4, 29, 4, 29, 29, 4, 29, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 29, 4, 4, 4, 4, 29, 4, 29, 4, 29, 29, 29, 29,
+    29, 29, 4, 29, 29, 29, 29, 4, 29, 4, 29, 4, 29, 4, 4, 4,
+    29, 4, 4, 29, 4, 29, 29, 4, 29, 4, 29, 4, 29, 4, 29, 4,
+    29, 4, 4, 29, 4, 29, 29, 4, 4, 4, 4, 29, 4, 4, 4, 4,
+    4, 4, 4, 29, 4, 4, 4, 4, 29, 4, 4, 4, 4, 29, 4, 29,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 4, 4, 4, 4, 4,
+    29, 4, 4, 4, 29, 4, 4, 4, 4, 4, 29, 4, 4, 4, 4, 4,
+    18, 18, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 29, 29,
+    29, 29, 29, 29, 29, 29, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 29, 29, 29, 29, 29, 29, 29,
+    21, 21, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 20, 20, 20, 20, 20,
+    21, 21, 21, 21, 21, 21, 21, 21, 29, 29, 29, 29, 29, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 29, 29, 29, 29, 29, 29, 29, 29,
+    21, 21, 21, 21, 21, 29, 29, 29, 21, 21, 21, 21, 21, 29, 29, 29,
+    21, 21, 21, 29, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    4, 4, 4, 68, 4, 4, 4, 4, 4, 4, 4, 4, 68, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 68, 4, 4, 4, 4, 4, 4,
+    29, 26, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 29, 29,
+};
+// clang-format on
+
+// clang-format off
+const Pow10Entry pow10_significands[POW10_ENTRIES] = {
+    {0xff77b1fcbebcdc4f, 0x25e8e89c13bb0f7b},
+    {0x9faacf3df73609b1, 0x77b191618c54e9ad},
+    {0xc795830d75038c1d, 0xd59df5b9ef6a2418},
+    {0xf97ae3d0d2446f25, 0x4b0573286b44ad1e},
+    {0x9becce62836ac577, 0x4ee367f9430aec33},
+    {0xc2e801fb244576d5, 0x229c41f793cda740},
+    {0xf3a20279ed56d48a, 0x6b43527578c11110},
+    {0x9845418c345644d6, 0x830a13896b78aaaa},
+    {0xbe5691ef416bd60c, 0x23cc986bc656d554},
+    {0xedec366b11c6cb8f, 0x2cbfbe86b7ec8aa9},
+    {0x94b3a202eb1c3f39, 0x7bf7d71432f3d6aa},
+    {0xb9e08a83a5e34f07, 0xdaf5ccd93fb0cc54},
+    {0xe858ad248f5c22c9, 0xd1b3400f8f9cff69},
+    {0x91376c36d99995be, 0x23100809b9c21fa2},
+    {0xb58547448ffffb2d, 0xabd40a0c2832a78b},
+    {0xe2e69915b3fff9f9, 0x16c90c8f323f516d},
+    {0x8dd01fad907ffc3b, 0xae3da7d97f6792e4},
+    {0xb1442798f49ffb4a, 0x99cd11cfdf41779d},
+    {0xdd95317f31c7fa1d, 0x40405643d711d584},
+    {0x8a7d3eef7f1cfc52, 0x482835ea666b2573},
+    {0xad1c8eab5ee43b66, 0xda3243650005eed0},
+    {0xd863b256369d4a40, 0x90bed43e40076a83},
+    {0x873e4f75e2224e68, 0x5a7744a6e804a292},
+    {0xa90de3535aaae202, 0x711515d0a205cb37},
+    {0xd3515c2831559a83, 0x0d5a5b44ca873e04},
+    {0x8412d9991ed58091, 0xe858790afe9486c3},
+    {0xa5178fff668ae0b6, 0x626e974dbe39a873},
+    {0xce5d73ff402d98e3, 0xfb0a3d212dc81290},
+    {0x80fa687f881c7f8e, 0x7ce66634bc9d0b9a},
+    {0xa139029f6a239f72, 0x1c1fffc1ebc44e81},
+    {0xc987434744ac874e, 0xa327ffb266b56221},
+    {0xfbe9141915d7a922, 0x4bf1ff9f0062baa9},
+    {0x9d71ac8fada6c9b5, 0x6f773fc3603db4aa},
+    {0xc4ce17b399107c22, 0xcb550fb4384d21d4},
+    {0xf6019da07f549b2b, 0x7e2a53a146606a49},
+    {0x99c102844f94e0fb, 0x2eda7444cbfc426e},
+    {0xc0314325637a1939, 0xfa911155fefb5309},
+    {0xf03d93eebc589f88, 0x793555ab7eba27cb},
+    {0x96267c7535b763b5, 0x4bc1558b2f3458df},
+    {0xbbb01b9283253ca2, 0x9eb1aaedfb016f17},
+    {0xea9c227723ee8bcb, 0x465e15a979c1cadd},
+    {0x92a1958a7675175f, 0x0bfacd89ec191eca},
+    {0xb749faed14125d36, 0xcef980ec671f667c},
+    {0xe51c79a85916f484, 0x82b7e12780e7401b},
+    {0x8f31cc0937ae58d2, 0xd1b2ecb8b0908811},
+    {0xb2fe3f0b8599ef07, 0x861fa7e6dcb4aa16},
+    {0xdfbdcece67006ac9, 0x67a791e093e1d49b},
+    {0x8bd6a141006042bd, 0xe0c8bb2c5c6d24e1},
+    {0xaecc49914078536d, 0x58fae9f773886e19},
+    {0xda7f5bf590966848, 0xaf39a475506a899f},
+    {0x888f99797a5e012d, 0x6d8406c952429604},
+    {0xaab37fd7d8f58178, 0xc8e5087ba6d33b84},
+    {0xd5605fcdcf32e1d6, 0xfb1e4a9a90880a65},
+    {0x855c3be0a17fcd26, 0x5cf2eea09a550680},
+    {0xa6b34ad8c9dfc06f, 0xf42faa48c0ea481f},
+    {0xd0601d8efc57b08b, 0xf13b94daf124da27},
+    {0x823c12795db6ce57, 0x76c53d08d6b70859},
+    {0xa2cb1717b52481ed, 0x54768c4b0c64ca6f},
+    {0xcb7ddcdda26da268, 0xa9942f5dcf7dfd0a},
+    {0xfe5d54150b090b02, 0xd3f93b35435d7c4d},
+    {0x9efa548d26e5a6e1, 0xc47bc5014a1a6db0},
+    {0xc6b8e9b0709f109a, 0x359ab6419ca1091c},
+    {0xf867241c8cc6d4c0, 0xc30163d203c94b63},
+    {0x9b407691d7fc44f8, 0x79e0de63425dcf1e},
+    {0xc21094364dfb5636, 0x985915fc12f542e5},
+    {0xf294b943e17a2bc4, 0x3e6f5b7b17b2939e},
+    {0x979cf3ca6cec5b5a, 0xa705992ceecf9c43},
+    {0xbd8430bd08277231, 0x50c6ff782a838354},
+    {0xece53cec4a314ebd, 0xa4f8bf5635246429},
+    {0x940f4613ae5ed136, 0x871b7795e136be9a},
+    {0xb913179899f68584, 0x28e2557b59846e40},
+    {0xe757dd7ec07426e5, 0x331aeada2fe589d0},
+    {0x9096ea6f3848984f, 0x3ff0d2c85def7622},
+    {0xb4bca50b065abe63, 0x0fed077a756b53aa},
+    {0xe1ebce4dc7f16dfb, 0xd3e8495912c62895},
+    {0x8d3360f09cf6e4bd, 0x64712dd7abbbd95d},
+    {0xb080392cc4349dec, 0xbd8d794d96aacfb4},
+    {0xdca04777f541c567, 0xecf0d7a0fc5583a1},
+    {0x89e42caaf9491b60, 0xf41686c49db57245},
+    {0xac5d37d5b79b6239, 0x311c2875c522ced6},
+    {0xd77485cb25823ac7, 0x7d633293366b828c},
+    {0x86a8d39ef77164bc, 0xae5dff9c02033198},
+    {0xa8530886b54dbdeb, 0xd9f57f830283fdfd},
+    {0xd267caa862a12d66, 0xd072df63c324fd7c},
+    {0x8380dea93da4bc60, 0x4247cb9e59f71e6e},
+    {0xa46116538d0deb78, 0x52d9be85f074e609},
+    {0xcd795be870516656, 0x67902e276c921f8c},
+    {0x806bd9714632dff6, 0x00ba1cd8a3db53b7},
+    {0xa086cfcd97bf97f3, 0x80e8a40eccd228a5},
+    {0xc8a883c0fdaf7df0, 0x6122cd128006b2ce},
+    {0xfad2a4b13d1b5d6c, 0x796b805720085f82},
+    {0x9cc3a6eec6311a63, 0xcbe3303674053bb1},
+    {0xc3f490aa77bd60fc, 0xbedbfc4411068a9d},
+    {0xf4f1b4d515acb93b, 0xee92fb5515482d45},
+    {0x991711052d8bf3c5, 0x751bdd152d4d1c4b},
+    {0xbf5cd54678eef0b6, 0xd262d45a78a0635e},
+    {0xef340a98172aace4, 0x86fb897116c87c35},
+    {0x9580869f0e7aac0e, 0xd45d35e6ae3d4da1},
+    {0xbae0a846d2195712, 0x8974836059cca10a},
+    {0xe998d258869facd7, 0x2bd1a438703fc94c},
+    {0x91ff83775423cc06, 0x7b6306a34627ddd0},
+    {0xb67f6455292cbf08, 0x1a3bc84c17b1d543},
+    {0xe41f3d6a7377eeca, 0x20caba5f1d9e4a94},
+    {0x8e938662882af53e, 0x547eb47b7282ee9d},
+    {0xb23867fb2a35b28d, 0xe99e619a4f23aa44},
+    {0xdec681f9f4c31f31, 0x6405fa00e2ec94d5},
+    {0x8b3c113c38f9f37e, 0xde83bc408dd3dd05},
+    {0xae0b158b4738705e, 0x9624ab50b148d446},
+    {0xd98ddaee19068c76, 0x3badd624dd9b0958},
+    {0x87f8a8d4cfa417c9, 0xe54ca5d70a80e5d7},
+    {0xa9f6d30a038d1dbc, 0x5e9fcf4ccd211f4d},
+    {0xd47487cc8470652b, 0x7647c32000696720},
+    {0x84c8d4dfd2c63f3b, 0x29ecd9f40041e074},
+    {0xa5fb0a17c777cf09, 0xf468107100525891},
+    {0xcf79cc9db955c2cc, 0x7182148d4066eeb5},
+    {0x81ac1fe293d599bf, 0xc6f14cd848405531},
+    {0xa21727db38cb002f, 0xb8ada00e5a506a7d},
+    {0xca9cf1d206fdc03b, 0xa6d90811f0e4851d},
+    {0xfd442e4688bd304a, 0x908f4a166d1da664},
+    {0x9e4a9cec15763e2e, 0x9a598e4e043287ff},
+    {0xc5dd44271ad3cdba, 0x40eff1e1853f29fe},
+    {0xf7549530e188c128, 0xd12bee59e68ef47d},
+    {0x9a94dd3e8cf578b9, 0x82bb74f8301958cf},
+    {0xc13a148e3032d6e7, 0xe36a52363c1faf02},
+    {0xf18899b1bc3f8ca1, 0xdc44e6c3cb279ac2},
+    {0x96f5600f15a7b7e5, 0x29ab103a5ef8c0ba},
+    {0xbcb2b812db11a5de, 0x7415d448f6b6f0e8},
+    {0xebdf661791d60f56, 0x111b495b3464ad22},
+    {0x936b9fcebb25c995, 0xcab10dd900beec35},
+    {0xb84687c269ef3bfb, 0x3d5d514f40eea743},
+    {0xe65829b3046b0afa, 0x0cb4a5a3112a5113},
+    {0x8ff71a0fe2c2e6dc, 0x47f0e785eaba72ac},
+    {0xb3f4e093db73a093, 0x59ed216765690f57},
+    {0xe0f218b8d25088b8, 0x306869c13ec3532d},
+    {0x8c974f7383725573, 0x1e414218c73a13fc},
+    {0xafbd2350644eeacf, 0xe5d1929ef90898fb},
+    {0xdbac6c247d62a583, 0xdf45f746b74abf3a},
+    {0x894bc396ce5da772, 0x6b8bba8c328eb784},
+    {0xab9eb47c81f5114f, 0x066ea92f3f326565},
+    {0xd686619ba27255a2, 0xc80a537b0efefebe},
+    {0x8613fd0145877585, 0xbd06742ce95f5f37},
+    {0xa798fc4196e952e7, 0x2c48113823b73705},
+    {0xd17f3b51fca3a7a0, 0xf75a15862ca504c6},
+    {0x82ef85133de648c4, 0x9a984d73dbe722fc},
+    {0xa3ab66580d5fdaf5, 0xc13e60d0d2e0ebbb},
+    {0xcc963fee10b7d1b3, 0x318df905079926a9},
+    {0xffbbcfe994e5c61f, 0xfdf17746497f7053},
+    {0x9fd561f1fd0f9bd3, 0xfeb6ea8bedefa634},
+    {0xc7caba6e7c5382c8, 0xfe64a52ee96b8fc1},
+    {0xf9bd690a1b68637b, 0x3dfdce7aa3c673b1},
+    {0x9c1661a651213e2d, 0x06bea10ca65c084f},
+    {0xc31bfa0fe5698db8, 0x486e494fcff30a63},
+    {0xf3e2f893dec3f126, 0x5a89dba3c3efccfb},
+    {0x986ddb5c6b3a76b7, 0xf89629465a75e01d},
+    {0xbe89523386091465, 0xf6bbb397f1135824},
+    {0xee2ba6c0678b597f, 0x746aa07ded582e2d},
+    {0x94db483840b717ef, 0xa8c2a44eb4571cdd},
+    {0xba121a4650e4ddeb, 0x92f34d62616ce414},
+    {0xe896a0d7e51e1566, 0x77b020baf9c81d18},
+    {0x915e2486ef32cd60, 0x0ace1474dc1d122f},
+    {0xb5b5ada8aaff80b8, 0x0d819992132456bb},
+    {0xe3231912d5bf60e6, 0x10e1fff697ed6c6a},
+    {0x8df5efabc5979c8f, 0xca8d3ffa1ef463c2},
+    {0xb1736b96b6fd83b3, 0xbd308ff8a6b17cb3},
+    {0xddd0467c64bce4a0, 0xac7cb3f6d05ddbdf},
+    {0x8aa22c0dbef60ee4, 0x6bcdf07a423aa96c},
+    {0xad4ab7112eb3929d, 0x86c16c98d2c953c7},
+    {0xd89d64d57a607744, 0xe871c7bf077ba8b8},
+    {0x87625f056c7c4a8b, 0x11471cd764ad4973},
+    {0xa93af6c6c79b5d2d, 0xd598e40d3dd89bd0},
+    {0xd389b47879823479, 0x4aff1d108d4ec2c4},
+    {0x843610cb4bf160cb, 0xcedf722a585139bb},
+    {0xa54394fe1eedb8fe, 0xc2974eb4ee658829},
+    {0xce947a3da6a9273e, 0x733d226229feea33},
+    {0x811ccc668829b887, 0x0806357d5a3f5260},
+    {0xa163ff802a3426a8, 0xca07c2dcb0cf26f8},
+    {0xc9bcff6034c13052, 0xfc89b393dd02f0b6},
+    {0xfc2c3f3841f17c67, 0xbbac2078d443ace3},
+    {0x9d9ba7832936edc0, 0xd54b944b84aa4c0e},
+    {0xc5029163f384a931, 0x0a9e795e65d4df12},
+    {0xf64335bcf065d37d, 0x4d4617b5ff4a16d6},
+    {0x99ea0196163fa42e, 0x504bced1bf8e4e46},
+    {0xc06481fb9bcf8d39, 0xe45ec2862f71e1d7},
+    {0xf07da27a82c37088, 0x5d767327bb4e5a4d},
+    {0x964e858c91ba2655, 0x3a6a07f8d510f870},
+    {0xbbe226efb628afea, 0x890489f70a55368c},
+    {0xeadab0aba3b2dbe5, 0x2b45ac74ccea842f},
+    {0x92c8ae6b464fc96f, 0x3b0b8bc90012929e},
+    {0xb77ada0617e3bbcb, 0x09ce6ebb40173745},
+    {0xe55990879ddcaabd, 0xcc420a6a101d0516},
+    {0x8f57fa54c2a9eab6, 0x9fa946824a12232e},
+    {0xb32df8e9f3546564, 0x47939822dc96abfa},
+    {0xdff9772470297ebd, 0x59787e2b93bc56f8},
+    {0x8bfbea76c619ef36, 0x57eb4edb3c55b65b},
+    {0xaefae51477a06b03, 0xede622920b6b23f2},
+    {0xdab99e59958885c4, 0xe95fab368e45ecee},
+    {0x88b402f7fd75539b, 0x11dbcb0218ebb415},
+    {0xaae103b5fcd2a881, 0xd652bdc29f26a11a},
+    {0xd59944a37c0752a2, 0x4be76d3346f04960},
+    {0x857fcae62d8493a5, 0x6f70a4400c562ddc},
+    {0xa6dfbd9fb8e5b88e, 0xcb4ccd500f6bb953},
+    {0xd097ad07a71f26b2, 0x7e2000a41346a7a8},
+    {0x825ecc24c873782f, 0x8ed400668c0c28c9},
+    {0xa2f67f2dfa90563b, 0x728900802f0f32fb},
+    {0xcbb41ef979346bca, 0x4f2b40a03ad2ffba},
+    {0xfea126b7d78186bc, 0xe2f610c84987bfa9},
+    {0x9f24b832e6b0f436, 0x0dd9ca7d2df4d7ca},
+    {0xc6ede63fa05d3143, 0x91503d1c79720dbc},
+    {0xf8a95fcf88747d94, 0x75a44c6397ce912b},
+    {0x9b69dbe1b548ce7c, 0xc986afbe3ee11abb},
+    {0xc24452da229b021b, 0xfbe85badce996169},
+    {0xf2d56790ab41c2a2, 0xfae27299423fb9c4},
+    {0x97c560ba6b0919a5, 0xdccd879fc967d41b},
+    {0xbdb6b8e905cb600f, 0x5400e987bbc1c921},
+    {0xed246723473e3813, 0x290123e9aab23b69},
+    {0x9436c0760c86e30b, 0xf9a0b6720aaf6522},
+    {0xb94470938fa89bce, 0xf808e40e8d5b3e6a},
+    {0xe7958cb87392c2c2, 0xb60b1d1230b20e05},
+    {0x90bd77f3483bb9b9, 0xb1c6f22b5e6f48c3},
+    {0xb4ecd5f01a4aa828, 0x1e38aeb6360b1af4},
+    {0xe2280b6c20dd5232, 0x25c6da63c38de1b1},
+    {0x8d590723948a535f, 0x579c487e5a38ad0f},
+    {0xb0af48ec79ace837, 0x2d835a9df0c6d852},
+    {0xdcdb1b2798182244, 0xf8e431456cf88e66},
+    {0x8a08f0f8bf0f156b, 0x1b8e9ecb641b5900},
+    {0xac8b2d36eed2dac5, 0xe272467e3d222f40},
+    {0xd7adf884aa879177, 0x5b0ed81dcc6abb10},
+    {0x86ccbb52ea94baea, 0x98e947129fc2b4ea},
+    {0xa87fea27a539e9a5, 0x3f2398d747b36225},
+    {0xd29fe4b18e88640e, 0x8eec7f0d19a03aae},
+    {0x83a3eeeef9153e89, 0x1953cf68300424ad},
+    {0xa48ceaaab75a8e2b, 0x5fa8c3423c052dd8},
+    {0xcdb02555653131b6, 0x3792f412cb06794e},
+    {0x808e17555f3ebf11, 0xe2bbd88bbee40bd1},
+    {0xa0b19d2ab70e6ed6, 0x5b6aceaeae9d0ec5},
+    {0xc8de047564d20a8b, 0xf245825a5a445276},
+    {0xfb158592be068d2e, 0xeed6e2f0f0d56713},
+    {0x9ced737bb6c4183d, 0x55464dd69685606c},
+    {0xc428d05aa4751e4c, 0xaa97e14c3c26b887},
+    {0xf53304714d9265df, 0xd53dd99f4b3066a9},
+    {0x993fe2c6d07b7fab, 0xe546a8038efe402a},
+    {0xbf8fdb78849a5f96, 0xde98520472bdd034},
+    {0xef73d256a5c0f77c, 0x963e66858f6d4441},
+    {0x95a8637627989aad, 0xdde7001379a44aa9},
+    {0xbb127c53b17ec159, 0x5560c018580d5d53},
+    {0xe9d71b689dde71af, 0xaab8f01e6e10b4a7},
+    {0x9226712162ab070d, 0xcab3961304ca70e9},
+    {0xb6b00d69bb55c8d1, 0x3d607b97c5fd0d23},
+    {0xe45c10c42a2b3b05, 0x8cb89a7db77c506b},
+    {0x8eb98a7a9a5b04e3, 0x77f3608e92adb243},
+    {0xb267ed1940f1c61c, 0x55f038b237591ed4},
+    {0xdf01e85f912e37a3, 0x6b6c46dec52f6689},
+    {0x8b61313bbabce2c6, 0x2323ac4b3b3da016},
+    {0xae397d8aa96c1b77, 0xabec975e0a0d081b},
+    {0xd9c7dced53c72255, 0x96e7bd358c904a22},
+    {0x881cea14545c7575, 0x7e50d64177da2e55},
+    {0xaa242499697392d2, 0xdde50bd1d5d0b9ea},
+    {0xd4ad2dbfc3d07787, 0x955e4ec64b44e865},
+    {0x84ec3c97da624ab4, 0xbd5af13bef0b113f},
+    {0xa6274bbdd0fadd61, 0xecb1ad8aeacdd58f},
+    {0xcfb11ead453994ba, 0x67de18eda5814af3},
+    {0x81ceb32c4b43fcf4, 0x80eacf948770ced8},
+    {0xa2425ff75e14fc31, 0xa1258379a94d028e},
+    {0xcad2f7f5359a3b3e, 0x096ee45813a04331},
+    {0xfd87b5f28300ca0d, 0x8bca9d6e188853fd},
+    {0x9e74d1b791e07e48, 0x775ea264cf55347e},
+    {0xc612062576589dda, 0x95364afe032a819e},
+    {0xf79687aed3eec551, 0x3a83ddbd83f52205},
+    {0x9abe14cd44753b52, 0xc4926a9672793543},
+    {0xc16d9a0095928a27, 0x75b7053c0f178294},
+    {0xf1c90080baf72cb1, 0x5324c68b12dd6339},
+    {0x971da05074da7bee, 0xd3f6fc16ebca5e04},
+    {0xbce5086492111aea, 0x88f4bb1ca6bcf585},
+    {0xec1e4a7db69561a5, 0x2b31e9e3d06c32e6},
+    {0x9392ee8e921d5d07, 0x3aff322e62439fd0},
+    {0xb877aa3236a4b449, 0x09befeb9fad487c3},
+    {0xe69594bec44de15b, 0x4c2ebe687989a9b4},
+    {0x901d7cf73ab0acd9, 0x0f9d37014bf60a11},
+    {0xb424dc35095cd80f, 0x538484c19ef38c95},
+    {0xe12e13424bb40e13, 0x2865a5f206b06fba},
+    {0x8cbccc096f5088cb, 0xf93f87b7442e45d4},
+    {0xafebff0bcb24aafe, 0xf78f69a51539d749},
+    {0xdbe6fecebdedd5be, 0xb573440e5a884d1c},
+    {0x89705f4136b4a597, 0x31680a88f8953031},
+    {0xabcc77118461cefc, 0xfdc20d2b36ba7c3e},
+    {0xd6bf94d5e57a42bc, 0x3d32907604691b4d},
+    {0x8637bd05af6c69b5, 0xa63f9a49c2c1b110},
+    {0xa7c5ac471b478423, 0x0fcf80dc33721d54},
+    {0xd1b71758e219652b, 0xd3c36113404ea4a9},
+    {0x83126e978d4fdf3b, 0x645a1cac083126ea},
+    {0xa3d70a3d70a3d70a, 0x3d70a3d70a3d70a4},
+    {0xcccccccccccccccc, 0xcccccccccccccccd},
+    {0x8000000000000000, 0x0000000000000000},
+    {0xa000000000000000, 0x0000000000000000},
+    {0xc800000000000000, 0x0000000000000000},
+    {0xfa00000000000000, 0x0000000000000000},
+    {0x9c40000000000000, 0x0000000000000000},
+    {0xc350000000000000, 0x0000000000000000},
+    {0xf424000000000000, 0x0000000000000000},
+    {0x9896800000000000, 0x0000000000000000},
+    {0xbebc200000000000, 0x0000000000000000},
+    {0xee6b280000000000, 0x0000000000000000},
+    {0x9502f90000000000, 0x0000000000000000},
+    {0xba43b74000000000, 0x0000000000000000},
+    {0xe8d4a51000000000, 0x0000000000000000},
+    {0x9184e72a00000000, 0x0000000000000000},
+    {0xb5e620f480000000, 0x0000000000000000},
+    {0xe35fa931a0000000, 0x0000000000000000},
+    {0x8e1bc9bf04000000, 0x0000000000000000},
+    {0xb1a2bc2ec5000000, 0x0000000000000000},
+    {0xde0b6b3a76400000, 0x0000000000000000},
+    {0x8ac7230489e80000, 0x0000000000000000},
+    {0xad78ebc5ac620000, 0x0000000000000000},
+    {0xd8d726b7177a8000, 0x0000000000000000},
+    {0x878678326eac9000, 0x0000000000000000},
+    {0xa968163f0a57b400, 0x0000000000000000},
+    {0xd3c21bcecceda100, 0x0000000000000000},
+    {0x84595161401484a0, 0x0000000000000000},
+    {0xa56fa5b99019a5c8, 0x0000000000000000},
+    {0xcecb8f27f4200f3a, 0x0000000000000000},
+    {0x813f3978f8940984, 0x4000000000000000},
+    {0xa18f07d736b90be5, 0x5000000000000000},
+    {0xc9f2c9cd04674ede, 0xa400000000000000},
+    {0xfc6f7c4045812296, 0x4d00000000000000},
+    {0x9dc5ada82b70b59d, 0xf020000000000000},
+    {0xc5371912364ce305, 0x6c28000000000000},
+    {0xf684df56c3e01bc6, 0xc732000000000000},
+    {0x9a130b963a6c115c, 0x3c7f400000000000},
+    {0xc097ce7bc90715b3, 0x4b9f100000000000},
+    {0xf0bdc21abb48db20, 0x1e86d40000000000},
+    {0x96769950b50d88f4, 0x1314448000000000},
+    {0xbc143fa4e250eb31, 0x17d955a000000000},
+    {0xeb194f8e1ae525fd, 0x5dcfab0800000000},
+    {0x92efd1b8d0cf37be, 0x5aa1cae500000000},
+    {0xb7abc627050305ad, 0xf14a3d9e40000000},
+    {0xe596b7b0c643c719, 0x6d9ccd05d0000000},
+    {0x8f7e32ce7bea5c6f, 0xe4820023a2000000},
+    {0xb35dbf821ae4f38b, 0xdda2802c8a800000},
+    {0xe0352f62a19e306e, 0xd50b2037ad200000},
+    {0x8c213d9da502de45, 0x4526f422cc340000},
+    {0xaf298d050e4395d6, 0x9670b12b7f410000},
+    {0xdaf3f04651d47b4c, 0x3c0cdd765f114000},
+    {0x88d8762bf324cd0f, 0xa5880a69fb6ac800},
+    {0xab0e93b6efee0053, 0x8eea0d047a457a00},
+    {0xd5d238a4abe98068, 0x72a4904598d6d880},
+    {0x85a36366eb71f041, 0x47a6da2b7f864750},
+    {0xa70c3c40a64e6c51, 0x999090b65f67d924},
+    {0xd0cf4b50cfe20765, 0xfff4b4e3f741cf6d},
+    {0x82818f1281ed449f, 0xbff8f10e7a8921a5},
+    {0xa321f2d7226895c7, 0xaff72d52192b6a0e},
+    {0xcbea6f8ceb02bb39, 0x9bf4f8a69f764491},
+    {0xfee50b7025c36a08, 0x02f236d04753d5b5},
+    {0x9f4f2726179a2245, 0x01d762422c946591},
+    {0xc722f0ef9d80aad6, 0x424d3ad2b7b97ef6},
+    {0xf8ebad2b84e0d58b, 0xd2e0898765a7deb3},
+    {0x9b934c3b330c8577, 0x63cc55f49f88eb30},
+    {0xc2781f49ffcfa6d5, 0x3cbf6b71c76b25fc},
+    {0xf316271c7fc3908a, 0x8bef464e3945ef7b},
+    {0x97edd871cfda3a56, 0x97758bf0e3cbb5ad},
+    {0xbde94e8e43d0c8ec, 0x3d52eeed1cbea318},
+    {0xed63a231d4c4fb27, 0x4ca7aaa863ee4bde},
+    {0x945e455f24fb1cf8, 0x8fe8caa93e74ef6b},
+    {0xb975d6b6ee39e436, 0xb3e2fd538e122b45},
+    {0xe7d34c64a9c85d44, 0x60dbbca87196b617},
+    {0x90e40fbeea1d3a4a, 0xbc8955e946fe31ce},
+    {0xb51d13aea4a488dd, 0x6babab6398bdbe42},
+    {0xe264589a4dcdab14, 0xc696963c7eed2dd2},
+    {0x8d7eb76070a08aec, 0xfc1e1de5cf543ca3},
+    {0xb0de65388cc8ada8, 0x3b25a55f43294bcc},
+    {0xdd15fe86affad912, 0x49ef0eb713f39ebf},
+    {0x8a2dbf142dfcc7ab, 0x6e3569326c784338},
+    {0xacb92ed9397bf996, 0x49c2c37f07965405},
+    {0xd7e77a8f87daf7fb, 0xdc33745ec97be907},
+    {0x86f0ac99b4e8dafd, 0x69a028bb3ded71a4},
+    {0xa8acd7c0222311bc, 0xc40832ea0d68ce0d},
+    {0xd2d80db02aabd62b, 0xf50a3fa490c30191},
+    {0x83c7088e1aab65db, 0x792667c6da79e0fb},
+    {0xa4b8cab1a1563f52, 0x577001b891185939},
+    {0xcde6fd5e09abcf26, 0xed4c0226b55e6f87},
+    {0x80b05e5ac60b6178, 0x544f8158315b05b5},
+    {0xa0dc75f1778e39d6, 0x696361ae3db1c722},
+    {0xc913936dd571c84c, 0x03bc3a19cd1e38ea},
+    {0xfb5878494ace3a5f, 0x04ab48a04065c724},
+    {0x9d174b2dcec0e47b, 0x62eb0d64283f9c77},
+    {0xc45d1df942711d9a, 0x3ba5d0bd324f8395},
+    {0xf5746577930d6500, 0xca8f44ec7ee3647a},
+    {0x9968bf6abbe85f20, 0x7e998b13cf4e1ecc},
+    {0xbfc2ef456ae276e8, 0x9e3fedd8c321a67f},
+    {0xefb3ab16c59b14a2, 0xc5cfe94ef3ea101f},
+    {0x95d04aee3b80ece5, 0xbba1f1d158724a13},
+    {0xbb445da9ca61281f, 0x2a8a6e45ae8edc98},
+    {0xea1575143cf97226, 0xf52d09d71a3293be},
+    {0x924d692ca61be758, 0x593c2626705f9c57},
+    {0xb6e0c377cfa2e12e, 0x6f8b2fb00c77836d},
+    {0xe498f455c38b997a, 0x0b6dfb9c0f956448},
+    {0x8edf98b59a373fec, 0x4724bd4189bd5ead},
+    {0xb2977ee300c50fe7, 0x58edec91ec2cb658},
+    {0xdf3d5e9bc0f653e1, 0x2f2967b66737e3ee},
+    {0x8b865b215899f46c, 0xbd79e0d20082ee75},
+    {0xae67f1e9aec07187, 0xecd8590680a3aa12},
+    {0xda01ee641a708de9, 0xe80e6f4820cc9496},
+    {0x884134fe908658b2, 0x3109058d147fdcde},
+    {0xaa51823e34a7eede, 0xbd4b46f0599fd416},
+    {0xd4e5e2cdc1d1ea96, 0x6c9e18ac7007c91b},
+    {0x850fadc09923329e, 0x03e2cf6bc604ddb1},
+    {0xa6539930bf6bff45, 0x84db8346b786151d},
+    {0xcfe87f7cef46ff16, 0xe612641865679a64},
+    {0x81f14fae158c5f6e, 0x4fcb7e8f3f60c07f},
+    {0xa26da3999aef7749, 0xe3be5e330f38f09e},
+    {0xcb090c8001ab551c, 0x5cadf5bfd3072cc6},
+    {0xfdcb4fa002162a63, 0x73d9732fc7c8f7f7},
+    {0x9e9f11c4014dda7e, 0x2867e7fddcdd9afb},
+    {0xc646d63501a1511d, 0xb281e1fd541501b9},
+    {0xf7d88bc24209a565, 0x1f225a7ca91a4227},
+    {0x9ae757596946075f, 0x3375788de9b06959},
+    {0xc1a12d2fc3978937, 0x0052d6b1641c83af},
+    {0xf209787bb47d6b84, 0xc0678c5dbd23a49b},
+    {0x9745eb4d50ce6332, 0xf840b7ba963646e1},
+    {0xbd176620a501fbff, 0xb650e5a93bc3d899},
+    {0xec5d3fa8ce427aff, 0xa3e51f138ab4cebf},
+    {0x93ba47c980e98cdf, 0xc66f336c36b10138},
+    {0xb8a8d9bbe123f017, 0xb80b0047445d4185},
+    {0xe6d3102ad96cec1d, 0xa60dc059157491e6},
+    {0x9043ea1ac7e41392, 0x87c89837ad68db30},
+    {0xb454e4a179dd1877, 0x29babe4598c311fc},
+    {0xe16a1dc9d8545e94, 0xf4296dd6fef3d67b},
+    {0x8ce2529e2734bb1d, 0x1899e4a65f58660d},
+    {0xb01ae745b101e9e4, 0x5ec05dcff72e7f90},
+    {0xdc21a1171d42645d, 0x76707543f4fa1f74},
+    {0x899504ae72497eba, 0x6a06494a791c53a9},
+    {0xabfa45da0edbde69, 0x0487db9d17636893},
+    {0xd6f8d7509292d603, 0x45a9d2845d3c42b7},
+    {0x865b86925b9bc5c2, 0x0b8a2392ba45a9b3},
+    {0xa7f26836f282b732, 0x8e6cac7768d7141f},
+    {0xd1ef0244af2364ff, 0x3207d795430cd927},
+    {0x8335616aed761f1f, 0x7f44e6bd49e807b9},
+    {0xa402b9c5a8d3a6e7, 0x5f16206c9c6209a7},
+    {0xcd036837130890a1, 0x36dba887c37a8c10},
+    {0x802221226be55a64, 0xc2494954da2c978a},
+    {0xa02aa96b06deb0fd, 0xf2db9baa10b7bd6d},
+    {0xc83553c5c8965d3d, 0x6f92829494e5acc8},
+    {0xfa42a8b73abbf48c, 0xcb772339ba1f17fa},
+    {0x9c69a97284b578d7, 0xff2a760414536efc},
+    {0xc38413cf25e2d70d, 0xfef5138519684abb},
+    {0xf46518c2ef5b8cd1, 0x7eb258665fc25d6a},
+    {0x98bf2f79d5993802, 0xef2f773ffbd97a62},
+    {0xbeeefb584aff8603, 0xaafb550ffacfd8fb},
+    {0xeeaaba2e5dbf6784, 0x95ba2a53f983cf39},
+    {0x952ab45cfa97a0b2, 0xdd945a747bf26184},
+    {0xba756174393d88df, 0x94f971119aeef9e5},
+    {0xe912b9d1478ceb17, 0x7a37cd5601aab85e},
+    {0x91abb422ccb812ee, 0xac62e055c10ab33b},
+    {0xb616a12b7fe617aa, 0x577b986b314d600a},
+    {0xe39c49765fdf9d94, 0xed5a7e85fda0b80c},
+    {0x8e41ade9fbebc27d, 0x14588f13be847308},
+    {0xb1d219647ae6b31c, 0x596eb2d8ae258fc9},
+    {0xde469fbd99a05fe3, 0x6fca5f8ed9aef3bc},
+    {0x8aec23d680043bee, 0x25de7bb9480d5855},
+    {0xada72ccc20054ae9, 0xaf561aa79a10ae6b},
+    {0xd910f7ff28069da4, 0x1b2ba1518094da05},
+    {0x87aa9aff79042286, 0x90fb44d2f05d0843},
+    {0xa99541bf57452b28, 0x353a1607ac744a54},
+    {0xd3fa922f2d1675f2, 0x42889b8997915ce9},
+    {0x847c9b5d7c2e09b7, 0x69956135febada12},
+    {0xa59bc234db398c25, 0x43fab9837e699096},
+    {0xcf02b2c21207ef2e, 0x94f967e45e03f4bc},
+    {0x8161afb94b44f57d, 0x1d1be0eebac278f6},
+    {0xa1ba1ba79e1632dc, 0x6462d92a69731733},
+    {0xca28a291859bbf93, 0x7d7b8f7503cfdcff},
+    {0xfcb2cb35e702af78, 0x5cda735244c3d43f},
+    {0x9defbf01b061adab, 0x3a0888136afa64a8},
+    {0xc56baec21c7a1916, 0x088aaa1845b8fdd1},
+    {0xf6c69a72a3989f5b, 0x8aad549e57273d46},
+    {0x9a3c2087a63f6399, 0x36ac54e2f678864c},
+    {0xc0cb28a98fcf3c7f, 0x84576a1bb416a7de},
+    {0xf0fdf2d3f3c30b9f, 0x656d44a2a11c51d6},
+    {0x969eb7c47859e743, 0x9f644ae5a4b1b326},
+    {0xbc4665b596706114, 0x873d5d9f0dde1fef},
+    {0xeb57ff22fc0c7959, 0xa90cb506d155a7eb},
+    {0x9316ff75dd87cbd8, 0x09a7f12442d588f3},
+    {0xb7dcbf5354e9bece, 0x0c11ed6d538aeb30},
+    {0xe5d3ef282a242e81, 0x8f1668c8a86da5fb},
+    {0x8fa475791a569d10, 0xf96e017d694487bd},
+    {0xb38d92d760ec4455, 0x37c981dcc395a9ad},
+    {0xe070f78d3927556a, 0x85bbe253f47b1418},
+    {0x8c469ab843b89562, 0x93956d7478ccec8f},
+    {0xaf58416654a6babb, 0x387ac8d1970027b3},
+    {0xdb2e51bfe9d0696a, 0x06997b05fcc0319f},
+    {0x88fcf317f22241e2, 0x441fece3bdf81f04},
+    {0xab3c2fddeeaad25a, 0xd527e81cad7626c4},
+    {0xd60b3bd56a5586f1, 0x8a71e223d8d3b075},
+    {0x85c7056562757456, 0xf6872d5667844e4a},
+    {0xa738c6bebb12d16c, 0xb428f8ac016561dc},
+    {0xd106f86e69d785c7, 0xe13336d701beba53},
+    {0x82a45b450226b39c, 0xecc0024661173474},
+    {0xa34d721642b06084, 0x27f002d7f95d0191},
+    {0xcc20ce9bd35c78a5, 0x31ec038df7b441f5},
+    {0xff290242c83396ce, 0x7e67047175a15272},
+    {0x9f79a169bd203e41, 0x0f0062c6e984d387},
+    {0xc75809c42c684dd1, 0x52c07b78a3e60869},
+    {0xf92e0c3537826145, 0xa7709a56ccdf8a83},
+    {0x9bbcc7a142b17ccb, 0x88a66076400bb692},
+    {0xc2abf989935ddbfe, 0x6acff893d00ea436},
+    {0xf356f7ebf83552fe, 0x0583f6b8c4124d44},
+    {0x98165af37b2153de, 0xc3727a337a8b704b},
+    {0xbe1bf1b059e9a8d6, 0x744f18c0592e4c5d},
+    {0xeda2ee1c7064130c, 0x1162def06f79df74},
+    {0x9485d4d1c63e8be7, 0x8addcb5645ac2ba9},
+    {0xb9a74a0637ce2ee1, 0x6d953e2bd7173693},
+    {0xe8111c87c5c1ba99, 0xc8fa8db6ccdd0438},
+    {0x910ab1d4db9914a0, 0x1d9c9892400a22a3},
+    {0xb54d5e4a127f59c8, 0x2503beb6d00cab4c},
+    {0xe2a0b5dc971f303a, 0x2e44ae64840fd61e},
+    {0x8da471a9de737e24, 0x5ceaecfed289e5d3},
+    {0xb10d8e1456105dad, 0x7425a83e872c5f48},
+    {0xdd50f1996b947518, 0xd12f124e28f7771a},
+    {0x8a5296ffe33cc92f, 0x82bd6b70d99aaa70},
+    {0xace73cbfdc0bfb7b, 0x636cc64d1001550c},
+    {0xd8210befd30efa5a, 0x3c47f7e05401aa4f},
+    {0x8714a775e3e95c78, 0x65acfaec34810a72},
+    {0xa8d9d1535ce3b396, 0x7f1839a741a14d0e},
+    {0xd31045a8341ca07c, 0x1ede48111209a051},
+    {0x83ea2b892091e44d, 0x934aed0aab460433},
+    {0xa4e4b66b68b65d60, 0xf81da84d56178540},
+    {0xce1de40642e3f4b9, 0x36251260ab9d668f},
+    {0x80d2ae83e9ce78f3, 0xc1d72b7c6b42601a},
+    {0xa1075a24e4421730, 0xb24cf65b8612f820},
+    {0xc94930ae1d529cfc, 0xdee033f26797b628},
+    {0xfb9b7cd9a4a7443c, 0x169840ef017da3b2},
+    {0x9d412e0806e88aa5, 0x8e1f289560ee864f},
+    {0xc491798a08a2ad4e, 0xf1a6f2bab92a27e3},
+    {0xf5b5d7ec8acb58a2, 0xae10af696774b1dc},
+    {0x9991a6f3d6bf1765, 0xacca6da1e0a8ef2a},
+    {0xbff610b0cc6edd3f, 0x17fd090a58d32af4},
+    {0xeff394dcff8a948e, 0xddfc4b4cef07f5b1},
+    {0x95f83d0a1fb69cd9, 0x4abdaf101564f98f},
+    {0xbb764c4ca7a4440f, 0x9d6d1ad41abe37f2},
+    {0xea53df5fd18d5513, 0x84c86189216dc5ee},
+    {0x92746b9be2f8552c, 0x32fd3cf5b4e49bb5},
+    {0xb7118682dbb66a77, 0x3fbc8c33221dc2a2},
+    {0xe4d5e82392a40515, 0x0fabaf3feaa5334b},
+    {0x8f05b1163ba6832d, 0x29cb4d87f2a7400f},
+    {0xb2c71d5bca9023f8, 0x743e20e9ef511013},
+    {0xdf78e4b2bd342cf6, 0x914da9246b255417},
+    {0x8bab8eefb6409c1a, 0x1ad089b6c2f7548f},
+    {0xae9672aba3d0c320, 0xa184ac2473b529b2},
+    {0xda3c0f568cc4f3e8, 0xc9e5d72d90a2741f},
+    {0x8865899617fb1871, 0x7e2fa67c7a658893},
+    {0xaa7eebfb9df9de8d, 0xddbb901b98feeab8},
+    {0xd51ea6fa85785631, 0x552a74227f3ea566},
+    {0x8533285c936b35de, 0xd53a88958f872760},
+    {0xa67ff273b8460356, 0x8a892abaf368f138},
+    {0xd01fef10a657842c, 0x2d2b7569b0432d86},
+    {0x8213f56a67f6b29b, 0x9c3b29620e29fc74},
+    {0xa298f2c501f45f42, 0x8349f3ba91b47b90},
+    {0xcb3f2f7642717713, 0x241c70a936219a74},
+    {0xfe0efb53d30dd4d7, 0xed238cd383aa0111},
+    {0x9ec95d1463e8a506, 0xf4363804324a40ab},
+    {0xc67bb4597ce2ce48, 0xb143c6053edcd0d6},
+    {0xf81aa16fdc1b81da, 0xdd94b7868e94050b},
+    {0x9b10a4e5e9913128, 0xca7cf2b4191c8327},
+    {0xc1d4ce1f63f57d72, 0xfd1c2f611f63a3f1},
+    {0xf24a01a73cf2dccf, 0xbc633b39673c8ced},
+    {0x976e41088617ca01, 0xd5be0503e085d814},
+    {0xbd49d14aa79dbc82, 0x4b2d8644d8a74e19},
+    {0xec9c459d51852ba2, 0xddf8e7d60ed1219f},
+    {0x93e1ab8252f33b45, 0xcabb90e5c942b504},
+    {0xb8da1662e7b00a17, 0x3d6a751f3b936244},
+    {0xe7109bfba19c0c9d, 0x0cc512670a783ad5},
+    {0x906a617d450187e2, 0x27fb2b80668b24c6},
+    {0xb484f9dc9641e9da, 0xb1f9f660802dedf7},
+    {0xe1a63853bbd26451, 0x5e7873f8a0396974},
+    {0x8d07e33455637eb2, 0xdb0b487b6423e1e9},
+    {0xb049dc016abc5e5f, 0x91ce1a9a3d2cda63},
+    {0xdc5c5301c56b75f7, 0x7641a140cc7810fc},
+    {0x89b9b3e11b6329ba, 0xa9e904c87fcb0a9e},
+    {0xac2820d9623bf429, 0x546345fa9fbdcd45},
+    {0xd732290fbacaf133, 0xa97c177947ad4096},
+    {0x867f59a9d4bed6c0, 0x49ed8eabcccc485e},
+    {0xa81f301449ee8c70, 0x5c68f256bfff5a75},
+    {0xd226fc195c6a2f8c, 0x73832eec6fff3112},
+    {0x83585d8fd9c25db7, 0xc831fd53c5ff7eac},
+    {0xa42e74f3d032f525, 0xba3e7ca8b77f5e56},
+    {0xcd3a1230c43fb26f, 0x28ce1bd2e55f35ec},
+    {0x80444b5e7aa7cf85, 0x7980d163cf5b81b4},
+    {0xa0555e361951c366, 0xd7e105bcc3326220},
+    {0xc86ab5c39fa63440, 0x8dd9472bf3fefaa8},
+    {0xfa856334878fc150, 0xb14f98f6f0feb952},
+    {0x9c935e00d4b9d8d2, 0x6ed1bf9a569f33d4},
+    {0xc3b8358109e84f07, 0x0a862f80ec4700c9},
+    {0xf4a642e14c6262c8, 0xcd27bb612758c0fb},
+    {0x98e7e9cccfbd7dbd, 0x8038d51cb897789d},
+    {0xbf21e44003acdd2c, 0xe0470a63e6bd56c4},
+    {0xeeea5d5004981478, 0x1858ccfce06cac75},
+    {0x95527a5202df0ccb, 0x0f37801e0c43ebc9},
+    {0xbaa718e68396cffd, 0xd30560258f54e6bb},
+    {0xe950df20247c83fd, 0x47c6b82ef32a206a},
+    {0x91d28b7416cdd27e, 0x4cdc331d57fa5442},
+    {0xb6472e511c81471d, 0xe0133fe4adf8e953},
+    {0xe3d8f9e563a198e5, 0x58180fddd97723a7},
+    {0x8e679c2f5e44ff8f, 0x570f09eaa7ea7649},
+    {0xb201833b35d63f73, 0x2cd2cc6551e513db},
+    {0xde81e40a034bcf4f, 0xf8077f7ea65e58d2},
+    {0x8b112e86420f6191, 0xfb04afaf27faf783},
+    {0xadd57a27d29339f6, 0x79c5db9af1f9b564},
+    {0xd94ad8b1c7380874, 0x18375281ae7822bd},
+    {0x87cec76f1c830548, 0x8f2293910d0b15b6},
+    {0xa9c2794ae3a3c69a, 0xb2eb3875504ddb23},
+    {0xd433179d9c8cb841, 0x5fa60692a46151ec},
+    {0x849feec281d7f328, 0xdbc7c41ba6bcd334},
+    {0xa5c7ea73224deff3, 0x12b9b522906c0801},
+    {0xcf39e50feae16bef, 0xd768226b34870a01},
+    {0x81842f29f2cce375, 0xe6a1158300d46641},
+    {0xa1e53af46f801c53, 0x60495ae3c1097fd1},
+    {0xca5e89b18b602368, 0x385bb19cb14bdfc5},
+    {0xfcf62c1dee382c42, 0x46729e03dd9ed7b6},
+    {0x9e19db92b4e31ba9, 0x6c07a2c26a8346d2},
+    {0xc5a05277621be293, 0xc7098b7305241886},
+    {0xf70867153aa2db38, 0xb8cbee4fc66d1ea8},
+};
+
+const Pow10Entry pow5_significands[POW5_ENTRIES] = {
+    {0xeef453d6923bd65a, 0x113faa2906a13b3f},
+    {0x9558b4661b6565f8, 0x4ac7ca59a424c507},
+    {0xbaaee17fa23ebf76, 0x5d79bcf00d2df649},
+    {0xe95a99df8ace6f53, 0xf4d82c2c107973dc},
+    {0x91d8a02bb6c10594, 0x79071b9b8a4be869},
+    {0xb64ec836a47146f9, 0x9748e2826cdee284},
+    {0xe3e27a444d8d98b7, 0xfd1b1b2308169b25},
+    {0x8e6d8c6ab0787f72, 0xfe30f0f5e50e20f7},
+    {0xb208ef855c969f4f, 0xbdbd2d335e51a935},
+    {0xde8b2b66b3bc4723, 0xad2c788035e61382},
+    {0x8b16fb203055ac76, 0x4c3bcb5021afcc31},
+    {0xaddcb9e83c6b1793, 0xdf4abe242a1bbf3d},
+    {0xd953e8624b85dd78, 0xd71d6dad34a2af0d},
+    {0x87d4713d6f33aa6b, 0x8672648c40e5ad68},
+    {0xa9c98d8ccb009506, 0x680efdaf511f18c2},
+    {0xd43bf0effdc0ba48, 0x0212bd1b2566def2},
+    {0x84a57695fe98746d, 0x014bb630f7604b57},
+    {0xa5ced43b7e3e9188, 0x419ea3bd35385e2d},
+    {0xcf42894a5dce35ea, 0x52064cac828675b9},
+    {0x818995ce7aa0e1b2, 0x7343efebd1940993},
+    {0xa1ebfb4219491a1f, 0x1014ebe6c5f90bf8},
+    {0xca66fa129f9b60a6, 0xd41a26e077774ef6},
+    {0xfd00b897478238d0, 0x8920b098955522b4},
+    {0x9e20735e8cb16382, 0x55b46e5f5d5535b0},
+    {0xc5a890362fddbc62, 0xeb2189f734aa831d},
+    {0xf712b443bbd52b7b, 0xa5e9ec7501d523e4},
+    {0x9a6bb0aa55653b2d, 0x47b233c92125366e},
+    {0xc1069cd4eabe89f8, 0x999ec0bb696e840a},
+    {0xf148440a256e2c76, 0xc00670ea43ca250d},
+    {0x96cd2a865764dbca, 0x380406926a5e5728},
+    {0xbc807527ed3e12bc, 0xc605083704f5ecf2},
+    {0xeba09271e88d976b, 0xf7864a44c633682e},
+    {0x93445b8731587ea3, 0x7ab3ee6afbe0211d},
+    {0xb8157268fdae9e4c, 0x5960ea05bad82964},
+    {0xe61acf033d1a45df, 0x6fb92487298e33bd},
+    {0x8fd0c16206306bab, 0xa5d3b6d479f8e056},
+    {0xb3c4f1ba87bc8696, 0x8f48a4899877186c},
+    {0xe0b62e2929aba83c, 0x331acdabfe94de87},
+    {0x8c71dcd9ba0b4925, 0x9ff0c08b7f1d0b14},
+    {0xaf8e5410288e1b6f, 0x07ecf0ae5ee44dd9},
+    {0xdb71e91432b1a24a, 0xc9e82cd9f69d6150},
+    {0x892731ac9faf056e, 0xbe311c083a225cd2},
+    {0xab70fe17c79ac6ca, 0x6dbd630a48aaf406},
+    {0xd64d3d9db981787d, 0x092cbbccdad5b108},
+    {0x85f0468293f0eb4e, 0x25bbf56008c58ea5},
+    {0xa76c582338ed2621, 0xaf2af2b80af6f24e},
+    {0xd1476e2c07286faa, 0x1af5af660db4aee1},
+    {0x82cca4db847945ca, 0x50d98d9fc890ed4d},
+    {0xa37fce126597973c, 0xe50ff107bab528a0},
+    {0xcc5fc196fefd7d0c, 0x1e53ed49a96272c8},
+    {0xff77b1fcbebcdc4f, 0x25e8e89c13bb0f7a},
+    {0x9faacf3df73609b1, 0x77b191618c54e9ac},
+    {0xc795830d75038c1d, 0xd59df5b9ef6a2417},
+    {0xf97ae3d0d2446f25, 0x4b0573286b44ad1d},
+    {0x9becce62836ac577, 0x4ee367f9430aec32},
+    {0xc2e801fb244576d5, 0x229c41f793cda73f},
+    {0xf3a20279ed56d48a, 0x6b43527578c1110f},
+    {0x9845418c345644d6, 0x830a13896b78aaa9},
+    {0xbe5691ef416bd60c, 0x23cc986bc656d553},
+    {0xedec366b11c6cb8f, 0x2cbfbe86b7ec8aa8},
+    {0x94b3a202eb1c3f39, 0x7bf7d71432f3d6a9},
+    {0xb9e08a83a5e34f07, 0xdaf5ccd93fb0cc53},
+    {0xe858ad248f5c22c9, 0xd1b3400f8f9cff68},
+    {0x91376c36d99995be, 0x23100809b9c21fa1},
+    {0xb58547448ffffb2d, 0xabd40a0c2832a78a},
+    {0xe2e69915b3fff9f9, 0x16c90c8f323f516c},
+    {0x8dd01fad907ffc3b, 0xae3da7d97f6792e3},
+    {0xb1442798f49ffb4a, 0x99cd11cfdf41779c},
+    {0xdd95317f31c7fa1d, 0x40405643d711d583},
+    {0x8a7d3eef7f1cfc52, 0x482835ea666b2572},
+    {0xad1c8eab5ee43b66, 0xda3243650005eecf},
+    {0xd863b256369d4a40, 0x90bed43e40076a82},
+    {0x873e4f75e2224e68, 0x5a7744a6e804a291},
+    {0xa90de3535aaae202, 0x711515d0a205cb36},
+    {0xd3515c2831559a83, 0x0d5a5b44ca873e03},
+    {0x8412d9991ed58091, 0xe858790afe9486c2},
+    {0xa5178fff668ae0b6, 0x626e974dbe39a872},
+    {0xce5d73ff402d98e3, 0xfb0a3d212dc8128f},
+    {0x80fa687f881c7f8e, 0x7ce66634bc9d0b99},
+    {0xa139029f6a239f72, 0x1c1fffc1ebc44e80},
+    {0xc987434744ac874e, 0xa327ffb266b56220},
+    {0xfbe9141915d7a922, 0x4bf1ff9f0062baa8},
+    {0x9d71ac8fada6c9b5, 0x6f773fc3603db4a9},
+    {0xc4ce17b399107c22, 0xcb550fb4384d21d3},
+    {0xf6019da07f549b2b, 0x7e2a53a146606a48},
+    {0x99c102844f94e0fb, 0x2eda7444cbfc426d},
+    {0xc0314325637a1939, 0xfa911155fefb5308},
+    {0xf03d93eebc589f88, 0x793555ab7eba27ca},
+    {0x96267c7535b763b5, 0x4bc1558b2f3458de},
+    {0xbbb01b9283253ca2, 0x9eb1aaedfb016f16},
+    {0xea9c227723ee8bcb, 0x465e15a979c1cadc},
+    {0x92a1958a7675175f, 0x0bfacd89ec191ec9},
+    {0xb749faed14125d36, 0xcef980ec671f667b},
+    {0xe51c79a85916f484, 0x82b7e12780e7401a},
+    {0x8f31cc0937ae58d2, 0xd1b2ecb8b0908810},
+    {0xb2fe3f0b8599ef07, 0x861fa7e6dcb4aa15},
+    {0xdfbdcece67006ac9, 0x67a791e093e1d49a},
+    {0x8bd6a141006042bd, 0xe0c8bb2c5c6d24e0},
+    {0xaecc49914078536d, 0x58fae9f773886e18},
+    {0xda7f5bf590966848, 0xaf39a475506a899e},
+    {0x888f99797a5e012d, 0x6d8406c952429603},
+    {0xaab37fd7d8f58178, 0xc8e5087ba6d33b83},
+    {0xd5605fcdcf32e1d6, 0xfb1e4a9a90880a64},
+    {0x855c3be0a17fcd26, 0x5cf2eea09a55067f},
+    {0xa6b34ad8c9dfc06f, 0xf42faa48c0ea481e},
+    {0xd0601d8efc57b08b, 0xf13b94daf124da26},
+    {0x823c12795db6ce57, 0x76c53d08d6b70858},
+    {0xa2cb1717b52481ed, 0x54768c4b0c64ca6e},
+    {0xcb7ddcdda26da268, 0xa9942f5dcf7dfd09},
+    {0xfe5d54150b090b02, 0xd3f93b35435d7c4c},
+    {0x9efa548d26e5a6e1, 0xc47bc5014a1a6daf},
+    {0xc6b8e9b0709f109a, 0x359ab6419ca1091b},
+    {0xf867241c8cc6d4c0, 0xc30163d203c94b62},
+    {0x9b407691d7fc44f8, 0x79e0de63425dcf1d},
+    {0xc21094364dfb5636, 0x985915fc12f542e4},
+    {0xf294b943e17a2bc4, 0x3e6f5b7b17b2939d},
+    {0x979cf3ca6cec5b5a, 0xa705992ceecf9c42},
+    {0xbd8430bd08277231, 0x50c6ff782a838353},
+    {0xece53cec4a314ebd, 0xa4f8bf5635246428},
+    {0x940f4613ae5ed136, 0x871b7795e136be99},
+    {0xb913179899f68584, 0x28e2557b59846e3f},
+    {0xe757dd7ec07426e5, 0x331aeada2fe589cf},
+    {0x9096ea6f3848984f, 0x3ff0d2c85def7621},
+    {0xb4bca50b065abe63, 0x0fed077a756b53a9},
+    {0xe1ebce4dc7f16dfb, 0xd3e8495912c62894},
+    {0x8d3360f09cf6e4bd, 0x64712dd7abbbd95c},
+    {0xb080392cc4349dec, 0xbd8d794d96aacfb3},
+    {0xdca04777f541c567, 0xecf0d7a0fc5583a0},
+    {0x89e42caaf9491b60, 0xf41686c49db57244},
+    {0xac5d37d5b79b6239, 0x311c2875c522ced5},
+    {0xd77485cb25823ac7, 0x7d633293366b828b},
+    {0x86a8d39ef77164bc, 0xae5dff9c02033197},
+    {0xa8530886b54dbdeb, 0xd9f57f830283fdfc},
+    {0xd267caa862a12d66, 0xd072df63c324fd7b},
+    {0x8380dea93da4bc60, 0x4247cb9e59f71e6d},
+    {0xa46116538d0deb78, 0x52d9be85f074e608},
+    {0xcd795be870516656, 0x67902e276c921f8b},
+    {0x806bd9714632dff6, 0x00ba1cd8a3db53b6},
+    {0xa086cfcd97bf97f3, 0x80e8a40eccd228a4},
+    {0xc8a883c0fdaf7df0, 0x6122cd128006b2cd},
+    {0xfad2a4b13d1b5d6c, 0x796b805720085f81},
+    {0x9cc3a6eec6311a63, 0xcbe3303674053bb0},
+    {0xc3f490aa77bd60fc, 0xbedbfc4411068a9c},
+    {0xf4f1b4d515acb93b, 0xee92fb5515482d44},
+    {0x991711052d8bf3c5, 0x751bdd152d4d1c4a},
+    {0xbf5cd54678eef0b6, 0xd262d45a78a0635d},
+    {0xef340a98172aace4, 0x86fb897116c87c34},
+    {0x9580869f0e7aac0e, 0xd45d35e6ae3d4da0},
+    {0xbae0a846d2195712, 0x8974836059cca109},
+    {0xe998d258869facd7, 0x2bd1a438703fc94b},
+    {0x91ff83775423cc06, 0x7b6306a34627ddcf},
+    {0xb67f6455292cbf08, 0x1a3bc84c17b1d542},
+    {0xe41f3d6a7377eeca, 0x20caba5f1d9e4a93},
+    {0x8e938662882af53e, 0x547eb47b7282ee9c},
+    {0xb23867fb2a35b28d, 0xe99e619a4f23aa43},
+    {0xdec681f9f4c31f31, 0x6405fa00e2ec94d4},
+    {0x8b3c113c38f9f37e, 0xde83bc408dd3dd04},
+    {0xae0b158b4738705e, 0x9624ab50b148d445},
+    {0xd98ddaee19068c76, 0x3badd624dd9b0957},
+    {0x87f8a8d4cfa417c9, 0xe54ca5d70a80e5d6},
+    {0xa9f6d30a038d1dbc, 0x5e9fcf4ccd211f4c},
+    {0xd47487cc8470652b, 0x7647c3200069671f},
+    {0x84c8d4dfd2c63f3b, 0x29ecd9f40041e073},
+    {0xa5fb0a17c777cf09, 0xf468107100525890},
+    {0xcf79cc9db955c2cc, 0x7182148d4066eeb4},
+    {0x81ac1fe293d599bf, 0xc6f14cd848405530},
+    {0xa21727db38cb002f, 0xb8ada00e5a506a7c},
+    {0xca9cf1d206fdc03b, 0xa6d90811f0e4851c},
+    {0xfd442e4688bd304a, 0x908f4a166d1da663},
+    {0x9e4a9cec15763e2e, 0x9a598e4e043287fe},
+    {0xc5dd44271ad3cdba, 0x40eff1e1853f29fd},
+    {0xf7549530e188c128, 0xd12bee59e68ef47c},
+    {0x9a94dd3e8cf578b9, 0x82bb74f8301958ce},
+    {0xc13a148e3032d6e7, 0xe36a52363c1faf01},
+    {0xf18899b1bc3f8ca1, 0xdc44e6c3cb279ac1},
+    {0x96f5600f15a7b7e5, 0x29ab103a5ef8c0b9},
+    {0xbcb2b812db11a5de, 0x7415d448f6b6f0e7},
+    {0xebdf661791d60f56, 0x111b495b3464ad21},
+    {0x936b9fcebb25c995, 0xcab10dd900beec34},
+    {0xb84687c269ef3bfb, 0x3d5d514f40eea742},
+    {0xe65829b3046b0afa, 0x0cb4a5a3112a5112},
+    {0x8ff71a0fe2c2e6dc, 0x47f0e785eaba72ab},
+    {0xb3f4e093db73a093, 0x59ed216765690f56},
+    {0xe0f218b8d25088b8, 0x306869c13ec3532c},
+    {0x8c974f7383725573, 0x1e414218c73a13fb},
+    {0xafbd2350644eeacf, 0xe5d1929ef90898fa},
+    {0xdbac6c247d62a583, 0xdf45f746b74abf39},
+    {0x894bc396ce5da772, 0x6b8bba8c328eb783},
+    {0xab9eb47c81f5114f, 0x066ea92f3f326564},
+    {0xd686619ba27255a2, 0xc80a537b0efefebd},
+    {0x8613fd0145877585, 0xbd06742ce95f5f36},
+    {0xa798fc4196e952e7, 0x2c48113823b73704},
+    {0xd17f3b51fca3a7a0, 0xf75a15862ca504c5},
+    {0x82ef85133de648c4, 0x9a984d73dbe722fb},
+    {0xa3ab66580d5fdaf5, 0xc13e60d0d2e0ebba},
+    {0xcc963fee10b7d1b3, 0x318df905079926a8},
+    {0xffbbcfe994e5c61f, 0xfdf17746497f7052},
+    {0x9fd561f1fd0f9bd3, 0xfeb6ea8bedefa633},
+    {0xc7caba6e7c5382c8, 0xfe64a52ee96b8fc0},
+    {0xf9bd690a1b68637b, 0x3dfdce7aa3c673b0},
+    {0x9c1661a651213e2d, 0x06bea10ca65c084e},
+    {0xc31bfa0fe5698db8, 0x486e494fcff30a62},
+    {0xf3e2f893dec3f126, 0x5a89dba3c3efccfa},
+    {0x986ddb5c6b3a76b7, 0xf89629465a75e01c},
+    {0xbe89523386091465, 0xf6bbb397f1135823},
+    {0xee2ba6c0678b597f, 0x746aa07ded582e2c},
+    {0x94db483840b717ef, 0xa8c2a44eb4571cdc},
+    {0xba121a4650e4ddeb, 0x92f34d62616ce413},
+    {0xe896a0d7e51e1566, 0x77b020baf9c81d17},
+    {0x915e2486ef32cd60, 0x0ace1474dc1d122e},
+    {0xb5b5ada8aaff80b8, 0x0d819992132456ba},
+    {0xe3231912d5bf60e6, 0x10e1fff697ed6c69},
+    {0x8df5efabc5979c8f, 0xca8d3ffa1ef463c1},
+    {0xb1736b96b6fd83b3, 0xbd308ff8a6b17cb2},
+    {0xddd0467c64bce4a0, 0xac7cb3f6d05ddbde},
+    {0x8aa22c0dbef60ee4, 0x6bcdf07a423aa96b},
+    {0xad4ab7112eb3929d, 0x86c16c98d2c953c6},
+    {0xd89d64d57a607744, 0xe871c7bf077ba8b7},
+    {0x87625f056c7c4a8b, 0x11471cd764ad4972},
+    {0xa93af6c6c79b5d2d, 0xd598e40d3dd89bcf},
+    {0xd389b47879823479, 0x4aff1d108d4ec2c3},
+    {0x843610cb4bf160cb, 0xcedf722a585139ba},
+    {0xa54394fe1eedb8fe, 0xc2974eb4ee658828},
+    {0xce947a3da6a9273e, 0x733d226229feea32},
+    {0x811ccc668829b887, 0x0806357d5a3f525f},
+    {0xa163ff802a3426a8, 0xca07c2dcb0cf26f7},
+    {0xc9bcff6034c13052, 0xfc89b393dd02f0b5},
+    {0xfc2c3f3841f17c67, 0xbbac2078d443ace2},
+    {0x9d9ba7832936edc0, 0xd54b944b84aa4c0d},
+    {0xc5029163f384a931, 0x0a9e795e65d4df11},
+    {0xf64335bcf065d37d, 0x4d4617b5ff4a16d5},
+    {0x99ea0196163fa42e, 0x504bced1bf8e4e45},
+    {0xc06481fb9bcf8d39, 0xe45ec2862f71e1d6},
+    {0xf07da27a82c37088, 0x5d767327bb4e5a4c},
+    {0x964e858c91ba2655, 0x3a6a07f8d510f86f},
+    {0xbbe226efb628afea, 0x890489f70a55368b},
+    {0xeadab0aba3b2dbe5, 0x2b45ac74ccea842e},
+    {0x92c8ae6b464fc96f, 0x3b0b8bc90012929d},
+    {0xb77ada0617e3bbcb, 0x09ce6ebb40173744},
+    {0xe55990879ddcaabd, 0xcc420a6a101d0515},
+    {0x8f57fa54c2a9eab6, 0x9fa946824a12232d},
+    {0xb32df8e9f3546564, 0x47939822dc96abf9},
+    {0xdff9772470297ebd, 0x59787e2b93bc56f7},
+    {0x8bfbea76c619ef36, 0x57eb4edb3c55b65a},
+    {0xaefae51477a06b03, 0xede622920b6b23f1},
+    {0xdab99e59958885c4, 0xe95fab368e45eced},
+    {0x88b402f7fd75539b, 0x11dbcb0218ebb414},
+    {0xaae103b5fcd2a881, 0xd652bdc29f26a119},
+    {0xd59944a37c0752a2, 0x4be76d3346f0495f},
+    {0x857fcae62d8493a5, 0x6f70a4400c562ddb},
+    {0xa6dfbd9fb8e5b88e, 0xcb4ccd500f6bb952},
+    {0xd097ad07a71f26b2, 0x7e2000a41346a7a7},
+    {0x825ecc24c873782f, 0x8ed400668c0c28c8},
+    {0xa2f67f2dfa90563b, 0x728900802f0f32fa},
+    {0xcbb41ef979346bca, 0x4f2b40a03ad2ffb9},
+    {0xfea126b7d78186bc, 0xe2f610c84987bfa8},
+    {0x9f24b832e6b0f436, 0x0dd9ca7d2df4d7c9},
+    {0xc6ede63fa05d3143, 0x91503d1c79720dbb},
+    {0xf8a95fcf88747d94, 0x75a44c6397ce912a},
+    {0x9b69dbe1b548ce7c, 0xc986afbe3ee11aba},
+    {0xc24452da229b021b, 0xfbe85badce996168},
+    {0xf2d56790ab41c2a2, 0xfae27299423fb9c3},
+    {0x97c560ba6b0919a5, 0xdccd879fc967d41a},
+    {0xbdb6b8e905cb600f, 0x5400e987bbc1c920},
+    {0xed246723473e3813, 0x290123e9aab23b68},
+    {0x9436c0760c86e30b, 0xf9a0b6720aaf6521},
+    {0xb94470938fa89bce, 0xf808e40e8d5b3e69},
+    {0xe7958cb87392c2c2, 0xb60b1d1230b20e04},
+    {0x90bd77f3483bb9b9, 0xb1c6f22b5e6f48c2},
+    {0xb4ecd5f01a4aa828, 0x1e38aeb6360b1af3},
+    {0xe2280b6c20dd5232, 0x25c6da63c38de1b0},
+    {0x8d590723948a535f, 0x579c487e5a38ad0e},
+    {0xb0af48ec79ace837, 0x2d835a9df0c6d851},
+    {0xdcdb1b2798182244, 0xf8e431456cf88e65},
+    {0x8a08f0f8bf0f156b, 0x1b8e9ecb641b58ff},
+    {0xac8b2d36eed2dac5, 0xe272467e3d222f3f},
+    {0xd7adf884aa879177, 0x5b0ed81dcc6abb0f},
+    {0x86ccbb52ea94baea, 0x98e947129fc2b4e9},
+    {0xa87fea27a539e9a5, 0x3f2398d747b36224},
+    {0xd29fe4b18e88640e, 0x8eec7f0d19a03aad},
+    {0x83a3eeeef9153e89, 0x1953cf68300424ac},
+    {0xa48ceaaab75a8e2b, 0x5fa8c3423c052dd7},
+    {0xcdb02555653131b6, 0x3792f412cb06794d},
+    {0x808e17555f3ebf11, 0xe2bbd88bbee40bd0},
+    {0xa0b19d2ab70e6ed6, 0x5b6aceaeae9d0ec4},
+    {0xc8de047564d20a8b, 0xf245825a5a445275},
+    {0xfb158592be068d2e, 0xeed6e2f0f0d56712},
+    {0x9ced737bb6c4183d, 0x55464dd69685606b},
+    {0xc428d05aa4751e4c, 0xaa97e14c3c26b886},
+    {0xf53304714d9265df, 0xd53dd99f4b3066a8},
+    {0x993fe2c6d07b7fab, 0xe546a8038efe4029},
+    {0xbf8fdb78849a5f96, 0xde98520472bdd033},
+    {0xef73d256a5c0f77c, 0x963e66858f6d4440},
+    {0x95a8637627989aad, 0xdde7001379a44aa8},
+    {0xbb127c53b17ec159, 0x5560c018580d5d52},
+    {0xe9d71b689dde71af, 0xaab8f01e6e10b4a6},
+    {0x9226712162ab070d, 0xcab3961304ca70e8},
+    {0xb6b00d69bb55c8d1, 0x3d607b97c5fd0d22},
+    {0xe45c10c42a2b3b05, 0x8cb89a7db77c506a},
+    {0x8eb98a7a9a5b04e3, 0x77f3608e92adb242},
+    {0xb267ed1940f1c61c, 0x55f038b237591ed3},
+    {0xdf01e85f912e37a3, 0x6b6c46dec52f6688},
+    {0x8b61313bbabce2c6, 0x2323ac4b3b3da015},
+    {0xae397d8aa96c1b77, 0xabec975e0a0d081a},
+    {0xd9c7dced53c72255, 0x96e7bd358c904a21},
+    {0x881cea14545c7575, 0x7e50d64177da2e54},
+    {0xaa242499697392d2, 0xdde50bd1d5d0b9e9},
+    {0xd4ad2dbfc3d07787, 0x955e4ec64b44e864},
+    {0x84ec3c97da624ab4, 0xbd5af13bef0b113e},
+    {0xa6274bbdd0fadd61, 0xecb1ad8aeacdd58e},
+    {0xcfb11ead453994ba, 0x67de18eda5814af2},
+    {0x81ceb32c4b43fcf4, 0x80eacf948770ced7},
+    {0xa2425ff75e14fc31, 0xa1258379a94d028d},
+    {0xcad2f7f5359a3b3e, 0x096ee45813a04330},
+    {0xfd87b5f28300ca0d, 0x8bca9d6e188853fc},
+    {0x9e74d1b791e07e48, 0x775ea264cf55347e},
+    {0xc612062576589dda, 0x95364afe032a819e},
+    {0xf79687aed3eec551, 0x3a83ddbd83f52205},
+    {0x9abe14cd44753b52, 0xc4926a9672793543},
+    {0xc16d9a0095928a27, 0x75b7053c0f178294},
+    {0xf1c90080baf72cb1, 0x5324c68b12dd6339},
+    {0x971da05074da7bee, 0xd3f6fc16ebca5e04},
+    {0xbce5086492111aea, 0x88f4bb1ca6bcf585},
+    {0xec1e4a7db69561a5, 0x2b31e9e3d06c32e6},
+    {0x9392ee8e921d5d07, 0x3aff322e62439fd0},
+    {0xb877aa3236a4b449, 0x09befeb9fad487c3},
+    {0xe69594bec44de15b, 0x4c2ebe687989a9b4},
+    {0x901d7cf73ab0acd9, 0x0f9d37014bf60a11},
+    {0xb424dc35095cd80f, 0x538484c19ef38c95},
+    {0xe12e13424bb40e13, 0x2865a5f206b06fba},
+    {0x8cbccc096f5088cb, 0xf93f87b7442e45d4},
+    {0xafebff0bcb24aafe, 0xf78f69a51539d749},
+    {0xdbe6fecebdedd5be, 0xb573440e5a884d1c},
+    {0x89705f4136b4a597, 0x31680a88f8953031},
+    {0xabcc77118461cefc, 0xfdc20d2b36ba7c3e},
+    {0xd6bf94d5e57a42bc, 0x3d32907604691b4d},
+    {0x8637bd05af6c69b5, 0xa63f9a49c2c1b110},
+    {0xa7c5ac471b478423, 0x0fcf80dc33721d54},
+    {0xd1b71758e219652b, 0xd3c36113404ea4a9},
+    {0x83126e978d4fdf3b, 0x645a1cac083126ea},
+    {0xa3d70a3d70a3d70a, 0x3d70a3d70a3d70a4},
+    {0xcccccccccccccccc, 0xcccccccccccccccd},
+    {0x8000000000000000, 0x0000000000000000},
+    {0xa000000000000000, 0x0000000000000000},
+    {0xc800000000000000, 0x0000000000000000},
+    {0xfa00000000000000, 0x0000000000000000},
+    {0x9c40000000000000, 0x0000000000000000},
+    {0xc350000000000000, 0x0000000000000000},
+    {0xf424000000000000, 0x0000000000000000},
+    {0x9896800000000000, 0x0000000000000000},
+    {0xbebc200000000000, 0x0000000000000000},
+    {0xee6b280000000000, 0x0000000000000000},
+    {0x9502f90000000000, 0x0000000000000000},
+    {0xba43b74000000000, 0x0000000000000000},
+    {0xe8d4a51000000000, 0x0000000000000000},
+    {0x9184e72a00000000, 0x0000000000000000},
+    {0xb5e620f480000000, 0x0000000000000000},
+    {0xe35fa931a0000000, 0x0000000000000000},
+    {0x8e1bc9bf04000000, 0x0000000000000000},
+    {0xb1a2bc2ec5000000, 0x0000000000000000},
+    {0xde0b6b3a76400000, 0x0000000000000000},
+    {0x8ac7230489e80000, 0x0000000000000000},
+    {0xad78ebc5ac620000, 0x0000000000000000},
+    {0xd8d726b7177a8000, 0x0000000000000000},
+    {0x878678326eac9000, 0x0000000000000000},
+    {0xa968163f0a57b400, 0x0000000000000000},
+    {0xd3c21bcecceda100, 0x0000000000000000},
+    {0x84595161401484a0, 0x0000000000000000},
+    {0xa56fa5b99019a5c8, 0x0000000000000000},
+    {0xcecb8f27f4200f3a, 0x0000000000000000},
+    {0x813f3978f8940984, 0x4000000000000000},
+    {0xa18f07d736b90be5, 0x5000000000000000},
+    {0xc9f2c9cd04674ede, 0xa400000000000000},
+    {0xfc6f7c4045812296, 0x4d00000000000000},
+    {0x9dc5ada82b70b59d, 0xf020000000000000},
+    {0xc5371912364ce305, 0x6c28000000000000},
+    {0xf684df56c3e01bc6, 0xc732000000000000},
+    {0x9a130b963a6c115c, 0x3c7f400000000000},
+    {0xc097ce7bc90715b3, 0x4b9f100000000000},
+    {0xf0bdc21abb48db20, 0x1e86d40000000000},
+    {0x96769950b50d88f4, 0x1314448000000000},
+    {0xbc143fa4e250eb31, 0x17d955a000000000},
+    {0xeb194f8e1ae525fd, 0x5dcfab0800000000},
+    {0x92efd1b8d0cf37be, 0x5aa1cae500000000},
+    {0xb7abc627050305ad, 0xf14a3d9e40000000},
+    {0xe596b7b0c643c719, 0x6d9ccd05d0000000},
+    {0x8f7e32ce7bea5c6f, 0xe4820023a2000000},
+    {0xb35dbf821ae4f38b, 0xdda2802c8a800000},
+    {0xe0352f62a19e306e, 0xd50b2037ad200000},
+    {0x8c213d9da502de45, 0x4526f422cc340000},
+    {0xaf298d050e4395d6, 0x9670b12b7f410000},
+    {0xdaf3f04651d47b4c, 0x3c0cdd765f114000},
+    {0x88d8762bf324cd0f, 0xa5880a69fb6ac800},
+    {0xab0e93b6efee0053, 0x8eea0d047a457a00},
+    {0xd5d238a4abe98068, 0x72a4904598d6d880},
+    {0x85a36366eb71f041, 0x47a6da2b7f864750},
+    {0xa70c3c40a64e6c51, 0x999090b65f67d924},
+    {0xd0cf4b50cfe20765, 0xfff4b4e3f741cf6d},
+    {0x82818f1281ed449f, 0xbff8f10e7a8921a4},
+    {0xa321f2d7226895c7, 0xaff72d52192b6a0d},
+    {0xcbea6f8ceb02bb39, 0x9bf4f8a69f764490},
+    {0xfee50b7025c36a08, 0x02f236d04753d5b4},
+    {0x9f4f2726179a2245, 0x01d762422c946590},
+    {0xc722f0ef9d80aad6, 0x424d3ad2b7b97ef5},
+    {0xf8ebad2b84e0d58b, 0xd2e0898765a7deb2},
+    {0x9b934c3b330c8577, 0x63cc55f49f88eb2f},
+    {0xc2781f49ffcfa6d5, 0x3cbf6b71c76b25fb},
+    {0xf316271c7fc3908a, 0x8bef464e3945ef7a},
+    {0x97edd871cfda3a56, 0x97758bf0e3cbb5ac},
+    {0xbde94e8e43d0c8ec, 0x3d52eeed1cbea317},
+    {0xed63a231d4c4fb27, 0x4ca7aaa863ee4bdd},
+    {0x945e455f24fb1cf8, 0x8fe8caa93e74ef6a},
+    {0xb975d6b6ee39e436, 0xb3e2fd538e122b44},
+    {0xe7d34c64a9c85d44, 0x60dbbca87196b616},
+    {0x90e40fbeea1d3a4a, 0xbc8955e946fe31cd},
+    {0xb51d13aea4a488dd, 0x6babab6398bdbe41},
+    {0xe264589a4dcdab14, 0xc696963c7eed2dd1},
+    {0x8d7eb76070a08aec, 0xfc1e1de5cf543ca2},
+    {0xb0de65388cc8ada8, 0x3b25a55f43294bcb},
+    {0xdd15fe86affad912, 0x49ef0eb713f39ebe},
+    {0x8a2dbf142dfcc7ab, 0x6e3569326c784337},
+    {0xacb92ed9397bf996, 0x49c2c37f07965404},
+    {0xd7e77a8f87daf7fb, 0xdc33745ec97be906},
+    {0x86f0ac99b4e8dafd, 0x69a028bb3ded71a3},
+    {0xa8acd7c0222311bc, 0xc40832ea0d68ce0c},
+    {0xd2d80db02aabd62b, 0xf50a3fa490c30190},
+    {0x83c7088e1aab65db, 0x792667c6da79e0fa},
+    {0xa4b8cab1a1563f52, 0x577001b891185938},
+    {0xcde6fd5e09abcf26, 0xed4c0226b55e6f86},
+    {0x80b05e5ac60b6178, 0x544f8158315b05b4},
+    {0xa0dc75f1778e39d6, 0x696361ae3db1c721},
+    {0xc913936dd571c84c, 0x03bc3a19cd1e38e9},
+    {0xfb5878494ace3a5f, 0x04ab48a04065c723},
+    {0x9d174b2dcec0e47b, 0x62eb0d64283f9c76},
+    {0xc45d1df942711d9a, 0x3ba5d0bd324f8394},
+    {0xf5746577930d6500, 0xca8f44ec7ee36479},
+    {0x9968bf6abbe85f20, 0x7e998b13cf4e1ecb},
+    {0xbfc2ef456ae276e8, 0x9e3fedd8c321a67e},
+    {0xefb3ab16c59b14a2, 0xc5cfe94ef3ea101e},
+    {0x95d04aee3b80ece5, 0xbba1f1d158724a12},
+    {0xbb445da9ca61281f, 0x2a8a6e45ae8edc97},
+    {0xea1575143cf97226, 0xf52d09d71a3293bd},
+    {0x924d692ca61be758, 0x593c2626705f9c56},
+    {0xb6e0c377cfa2e12e, 0x6f8b2fb00c77836c},
+    {0xe498f455c38b997a, 0x0b6dfb9c0f956447},
+    {0x8edf98b59a373fec, 0x4724bd4189bd5eac},
+    {0xb2977ee300c50fe7, 0x58edec91ec2cb657},
+    {0xdf3d5e9bc0f653e1, 0x2f2967b66737e3ed},
+    {0x8b865b215899f46c, 0xbd79e0d20082ee74},
+    {0xae67f1e9aec07187, 0xecd8590680a3aa11},
+    {0xda01ee641a708de9, 0xe80e6f4820cc9495},
+    {0x884134fe908658b2, 0x3109058d147fdcdd},
+    {0xaa51823e34a7eede, 0xbd4b46f0599fd415},
+    {0xd4e5e2cdc1d1ea96, 0x6c9e18ac7007c91a},
+    {0x850fadc09923329e, 0x03e2cf6bc604ddb0},
+    {0xa6539930bf6bff45, 0x84db8346b786151c},
+    {0xcfe87f7cef46ff16, 0xe612641865679a63},
+    {0x81f14fae158c5f6e, 0x4fcb7e8f3f60c07e},
+    {0xa26da3999aef7749, 0xe3be5e330f38f09d},
+    {0xcb090c8001ab551c, 0x5cadf5bfd3072cc5},
+    {0xfdcb4fa002162a63, 0x73d9732fc7c8f7f6},
+    {0x9e9f11c4014dda7e, 0x2867e7fddcdd9afa},
+    {0xc646d63501a1511d, 0xb281e1fd541501b8},
+    {0xf7d88bc24209a565, 0x1f225a7ca91a4226},
+    {0x9ae757596946075f, 0x3375788de9b06958},
+    {0xc1a12d2fc3978937, 0x0052d6b1641c83ae},
+    {0xf209787bb47d6b84, 0xc0678c5dbd23a49a},
+    {0x9745eb4d50ce6332, 0xf840b7ba963646e0},
+    {0xbd176620a501fbff, 0xb650e5a93bc3d898},
+    {0xec5d3fa8ce427aff, 0xa3e51f138ab4cebe},
+    {0x93ba47c980e98cdf, 0xc66f336c36b10137},
+    {0xb8a8d9bbe123f017, 0xb80b0047445d4184},
+    {0xe6d3102ad96cec1d, 0xa60dc059157491e5},
+    {0x9043ea1ac7e41392, 0x87c89837ad68db2f},
+    {0xb454e4a179dd1877, 0x29babe4598c311fb},
+    {0xe16a1dc9d8545e94, 0xf4296dd6fef3d67a},
+    {0x8ce2529e2734bb1d, 0x1899e4a65f58660c},
+    {0xb01ae745b101e9e4, 0x5ec05dcff72e7f8f},
+    {0xdc21a1171d42645d, 0x76707543f4fa1f73},
+    {0x899504ae72497eba, 0x6a06494a791c53a8},
+    {0xabfa45da0edbde69, 0x0487db9d17636892},
+    {0xd6f8d7509292d603, 0x45a9d2845d3c42b6},
+    {0x865b86925b9bc5c2, 0x0b8a2392ba45a9b2},
+    {0xa7f26836f282b732, 0x8e6cac7768d7141e},
+    {0xd1ef0244af2364ff, 0x3207d795430cd926},
+    {0x8335616aed761f1f, 0x7f44e6bd49e807b8},
+    {0xa402b9c5a8d3a6e7, 0x5f16206c9c6209a6},
+    {0xcd036837130890a1, 0x36dba887c37a8c0f},
+    {0x802221226be55a64, 0xc2494954da2c9789},
+    {0xa02aa96b06deb0fd, 0xf2db9baa10b7bd6c},
+    {0xc83553c5c8965d3d, 0x6f92829494e5acc7},
+    {0xfa42a8b73abbf48c, 0xcb772339ba1f17f9},
+    {0x9c69a97284b578d7, 0xff2a760414536efb},
+    {0xc38413cf25e2d70d, 0xfef5138519684aba},
+    {0xf46518c2ef5b8cd1, 0x7eb258665fc25d69},
+    {0x98bf2f79d5993802, 0xef2f773ffbd97a61},
+    {0xbeeefb584aff8603, 0xaafb550ffacfd8fa},
+    {0xeeaaba2e5dbf6784, 0x95ba2a53f983cf38},
+    {0x952ab45cfa97a0b2, 0xdd945a747bf26183},
+    {0xba756174393d88df, 0x94f971119aeef9e4},
+    {0xe912b9d1478ceb17, 0x7a37cd5601aab85d},
+    {0x91abb422ccb812ee, 0xac62e055c10ab33a},
+    {0xb616a12b7fe617aa, 0x577b986b314d6009},
+    {0xe39c49765fdf9d94, 0xed5a7e85fda0b80b},
+    {0x8e41ade9fbebc27d, 0x14588f13be847307},
+    {0xb1d219647ae6b31c, 0x596eb2d8ae258fc8},
+    {0xde469fbd99a05fe3, 0x6fca5f8ed9aef3bb},
+    {0x8aec23d680043bee, 0x25de7bb9480d5854},
+    {0xada72ccc20054ae9, 0xaf561aa79a10ae6a},
+    {0xd910f7ff28069da4, 0x1b2ba1518094da04},
+    {0x87aa9aff79042286, 0x90fb44d2f05d0842},
+    {0xa99541bf57452b28, 0x353a1607ac744a53},
+    {0xd3fa922f2d1675f2, 0x42889b8997915ce8},
+    {0x847c9b5d7c2e09b7, 0x69956135febada11},
+    {0xa59bc234db398c25, 0x43fab9837e699095},
+    {0xcf02b2c21207ef2e, 0x94f967e45e03f4bb},
+    {0x8161afb94b44f57d, 0x1d1be0eebac278f5},
+    {0xa1ba1ba79e1632dc, 0x6462d92a69731732},
+    {0xca28a291859bbf93, 0x7d7b8f7503cfdcfe},
+    {0xfcb2cb35e702af78, 0x5cda735244c3d43e},
+    {0x9defbf01b061adab, 0x3a0888136afa64a7},
+    {0xc56baec21c7a1916, 0x088aaa1845b8fdd0},
+    {0xf6c69a72a3989f5b, 0x8aad549e57273d45},
+    {0x9a3c2087a63f6399, 0x36ac54e2f678864b},
+    {0xc0cb28a98fcf3c7f, 0x84576a1bb416a7dd},
+    {0xf0fdf2d3f3c30b9f, 0x656d44a2a11c51d5},
+    {0x969eb7c47859e743, 0x9f644ae5a4b1b325},
+    {0xbc4665b596706114, 0x873d5d9f0dde1fee},
+    {0xeb57ff22fc0c7959, 0xa90cb506d155a7ea},
+    {0x9316ff75dd87cbd8, 0x09a7f12442d588f2},
+    {0xb7dcbf5354e9bece, 0x0c11ed6d538aeb2f},
+    {0xe5d3ef282a242e81, 0x8f1668c8a86da5fa},
+    {0x8fa475791a569d10, 0xf96e017d694487bc},
+    {0xb38d92d760ec4455, 0x37c981dcc395a9ac},
+    {0xe070f78d3927556a, 0x85bbe253f47b1417},
+    {0x8c469ab843b89562, 0x93956d7478ccec8e},
+    {0xaf58416654a6babb, 0x387ac8d1970027b2},
+    {0xdb2e51bfe9d0696a, 0x06997b05fcc0319e},
+    {0x88fcf317f22241e2, 0x441fece3bdf81f03},
+    {0xab3c2fddeeaad25a, 0xd527e81cad7626c3},
+    {0xd60b3bd56a5586f1, 0x8a71e223d8d3b074},
+    {0x85c7056562757456, 0xf6872d5667844e49},
+    {0xa738c6bebb12d16c, 0xb428f8ac016561db},
+    {0xd106f86e69d785c7, 0xe13336d701beba52},
+    {0x82a45b450226b39c, 0xecc0024661173473},
+    {0xa34d721642b06084, 0x27f002d7f95d0190},
+    {0xcc20ce9bd35c78a5, 0x31ec038df7b441f4},
+    {0xff290242c83396ce, 0x7e67047175a15271},
+    {0x9f79a169bd203e41, 0x0f0062c6e984d386},
+    {0xc75809c42c684dd1, 0x52c07b78a3e60868},
+    {0xf92e0c3537826145, 0xa7709a56ccdf8a82},
+    {0x9bbcc7a142b17ccb, 0x88a66076400bb691},
+    {0xc2abf989935ddbfe, 0x6acff893d00ea435},
+    {0xf356f7ebf83552fe, 0x0583f6b8c4124d43},
+    {0x98165af37b2153de, 0xc3727a337a8b704a},
+    {0xbe1bf1b059e9a8d6, 0x744f18c0592e4c5c},
+    {0xeda2ee1c7064130c, 0x1162def06f79df73},
+    {0x9485d4d1c63e8be7, 0x8addcb5645ac2ba8},
+    {0xb9a74a0637ce2ee1, 0x6d953e2bd7173692},
+    {0xe8111c87c5c1ba99, 0xc8fa8db6ccdd0437},
+    {0x910ab1d4db9914a0, 0x1d9c9892400a22a2},
+    {0xb54d5e4a127f59c8, 0x2503beb6d00cab4b},
+    {0xe2a0b5dc971f303a, 0x2e44ae64840fd61d},
+    {0x8da471a9de737e24, 0x5ceaecfed289e5d2},
+    {0xb10d8e1456105dad, 0x7425a83e872c5f47},
+    {0xdd50f1996b947518, 0xd12f124e28f77719},
+    {0x8a5296ffe33cc92f, 0x82bd6b70d99aaa6f},
+    {0xace73cbfdc0bfb7b, 0x636cc64d1001550b},
+    {0xd8210befd30efa5a, 0x3c47f7e05401aa4e},
+    {0x8714a775e3e95c78, 0x65acfaec34810a71},
+    {0xa8d9d1535ce3b396, 0x7f1839a741a14d0d},
+    {0xd31045a8341ca07c, 0x1ede48111209a050},
+    {0x83ea2b892091e44d, 0x934aed0aab460432},
+    {0xa4e4b66b68b65d60, 0xf81da84d5617853f},
+    {0xce1de40642e3f4b9, 0x36251260ab9d668e},
+    {0x80d2ae83e9ce78f3, 0xc1d72b7c6b426019},
+    {0xa1075a24e4421730, 0xb24cf65b8612f81f},
+    {0xc94930ae1d529cfc, 0xdee033f26797b627},
+    {0xfb9b7cd9a4a7443c, 0x169840ef017da3b1},
+    {0x9d412e0806e88aa5, 0x8e1f289560ee864e},
+    {0xc491798a08a2ad4e, 0xf1a6f2bab92a27e2},
+    {0xf5b5d7ec8acb58a2, 0xae10af696774b1db},
+    {0x9991a6f3d6bf1765, 0xacca6da1e0a8ef29},
+    {0xbff610b0cc6edd3f, 0x17fd090a58d32af3},
+    {0xeff394dcff8a948e, 0xddfc4b4cef07f5b0},
+    {0x95f83d0a1fb69cd9, 0x4abdaf101564f98e},
+    {0xbb764c4ca7a4440f, 0x9d6d1ad41abe37f1},
+    {0xea53df5fd18d5513, 0x84c86189216dc5ed},
+    {0x92746b9be2f8552c, 0x32fd3cf5b4e49bb4},
+    {0xb7118682dbb66a77, 0x3fbc8c33221dc2a1},
+    {0xe4d5e82392a40515, 0x0fabaf3feaa5334a},
+    {0x8f05b1163ba6832d, 0x29cb4d87f2a7400e},
+    {0xb2c71d5bca9023f8, 0x743e20e9ef511012},
+    {0xdf78e4b2bd342cf6, 0x914da9246b255416},
+    {0x8bab8eefb6409c1a, 0x1ad089b6c2f7548e},
+    {0xae9672aba3d0c320, 0xa184ac2473b529b1},
+    {0xda3c0f568cc4f3e8, 0xc9e5d72d90a2741e},
+    {0x8865899617fb1871, 0x7e2fa67c7a658892},
+    {0xaa7eebfb9df9de8d, 0xddbb901b98feeab7},
+    {0xd51ea6fa85785631, 0x552a74227f3ea565},
+    {0x8533285c936b35de, 0xd53a88958f87275f},
+    {0xa67ff273b8460356, 0x8a892abaf368f137},
+    {0xd01fef10a657842c, 0x2d2b7569b0432d85},
+    {0x8213f56a67f6b29b, 0x9c3b29620e29fc73},
+    {0xa298f2c501f45f42, 0x8349f3ba91b47b8f},
+    {0xcb3f2f7642717713, 0x241c70a936219a73},
+    {0xfe0efb53d30dd4d7, 0xed238cd383aa0110},
+    {0x9ec95d1463e8a506, 0xf4363804324a40aa},
+    {0xc67bb4597ce2ce48, 0xb143c6053edcd0d5},
+    {0xf81aa16fdc1b81da, 0xdd94b7868e94050a},
+    {0x9b10a4e5e9913128, 0xca7cf2b4191c8326},
+    {0xc1d4ce1f63f57d72, 0xfd1c2f611f63a3f0},
+    {0xf24a01a73cf2dccf, 0xbc633b39673c8cec},
+    {0x976e41088617ca01, 0xd5be0503e085d813},
+    {0xbd49d14aa79dbc82, 0x4b2d8644d8a74e18},
+    {0xec9c459d51852ba2, 0xddf8e7d60ed1219e},
+    {0x93e1ab8252f33b45, 0xcabb90e5c942b503},
+    {0xb8da1662e7b00a17, 0x3d6a751f3b936243},
+    {0xe7109bfba19c0c9d, 0x0cc512670a783ad4},
+    {0x906a617d450187e2, 0x27fb2b80668b24c5},
+    {0xb484f9dc9641e9da, 0xb1f9f660802dedf6},
+    {0xe1a63853bbd26451, 0x5e7873f8a0396973},
+    {0x8d07e33455637eb2, 0xdb0b487b6423e1e8},
+    {0xb049dc016abc5e5f, 0x91ce1a9a3d2cda62},
+    {0xdc5c5301c56b75f7, 0x7641a140cc7810fb},
+    {0x89b9b3e11b6329ba, 0xa9e904c87fcb0a9d},
+    {0xac2820d9623bf429, 0x546345fa9fbdcd44},
+    {0xd732290fbacaf133, 0xa97c177947ad4095},
+    {0x867f59a9d4bed6c0, 0x49ed8eabcccc485d},
+    {0xa81f301449ee8c70, 0x5c68f256bfff5a74},
+    {0xd226fc195c6a2f8c, 0x73832eec6fff3111},
+    {0x83585d8fd9c25db7, 0xc831fd53c5ff7eab},
+    {0xa42e74f3d032f525, 0xba3e7ca8b77f5e55},
+    {0xcd3a1230c43fb26f, 0x28ce1bd2e55f35eb},
+    {0x80444b5e7aa7cf85, 0x7980d163cf5b81b3},
+    {0xa0555e361951c366, 0xd7e105bcc332621f},
+    {0xc86ab5c39fa63440, 0x8dd9472bf3fefaa7},
+    {0xfa856334878fc150, 0xb14f98f6f0feb951},
+    {0x9c935e00d4b9d8d2, 0x6ed1bf9a569f33d3},
+    {0xc3b8358109e84f07, 0x0a862f80ec4700c8},
+    {0xf4a642e14c6262c8, 0xcd27bb612758c0fa},
+    {0x98e7e9cccfbd7dbd, 0x8038d51cb897789c},
+    {0xbf21e44003acdd2c, 0xe0470a63e6bd56c3},
+    {0xeeea5d5004981478, 0x1858ccfce06cac74},
+    {0x95527a5202df0ccb, 0x0f37801e0c43ebc8},
+    {0xbaa718e68396cffd, 0xd30560258f54e6ba},
+    {0xe950df20247c83fd, 0x47c6b82ef32a2069},
+    {0x91d28b7416cdd27e, 0x4cdc331d57fa5441},
+    {0xb6472e511c81471d, 0xe0133fe4adf8e952},
+    {0xe3d8f9e563a198e5, 0x58180fddd97723a6},
+    {0x8e679c2f5e44ff8f, 0x570f09eaa7ea7648},
+};
 // clang-format on
 
 } // namespace pystd2026
@@ -12,25 +12,65 @@ struct UnicodeConversionMultiChar {
     UnicodeConversionResult converted;
 };
 
-struct UnicodeConversionSingleChar {
-    uint32_t from_codepoint;
-    uint32_t to_codepoint;
-};
+// Single codepoint case mappings are stored in three stages. See
+// tools/genupper.py for a description of the layout.
+#define CASE_MAPPING_BLOCK_SHIFT 6
+#define CASE_MAPPING_BLOCK_MASK ((1 << CASE_MAPPING_BLOCK_SHIFT) - 1)
+#define CASE_MAPPING_MULTICHAR 1
 
+// clang-format off
+#define UPPERCASING_NUM_CODEPOINTS 125312
+#define UPPERCASING_STAGE1_ENTRIES 1958
+#define UPPERCASING_STAGE2_ENTRIES 3648
+#define UPPERCASING_DELTA_ENTRIES 97
 #define NUM_UPPERCASING_MULTICHAR_ENTRIES 102
 
 extern const UnicodeConversionMultiChar uppercasing_multi[NUM_UPPERCASING_MULTICHAR_ENTRIES];
+extern const uint8_t uppercasing_stage1[UPPERCASING_STAGE1_ENTRIES];
+extern const uint8_t uppercasing_stage2[UPPERCASING_STAGE2_ENTRIES];
+extern const int32_t uppercasing_deltas[UPPERCASING_DELTA_ENTRIES];
 
-#define NUM_UPPERCASING_SINGLECHAR_ENTRIES 1397
-
-extern const UnicodeConversionSingleChar uppercasing_single[NUM_UPPERCASING_SINGLECHAR_ENTRIES];
-
-// clang-format off
+#define LOWERCASING_NUM_CODEPOINTS 125248
+#define LOWERCASING_STAGE1_ENTRIES 1957
+#define LOWERCASING_STAGE2_ENTRIES 3328
+#define LOWERCASING_DELTA_ENTRIES 82
 #define NUM_LOWERCASING_MULTICHAR_ENTRIES 1
+
 extern const UnicodeConversionMultiChar lowercasing_multi[NUM_LOWERCASING_MULTICHAR_ENTRIES];
+extern const uint8_t lowercasing_stage1[LOWERCASING_STAGE1_ENTRIES];
+extern const uint8_t lowercasing_stage2[LOWERCASING_STAGE2_ENTRIES];
+extern const int32_t lowercasing_deltas[LOWERCASING_DELTA_ENTRIES];
+
+// See tools/genproperties.py for the layout of the property tables.
+#define UNICODE_PROPERTY_STAGE1_SHIFT 9
+#define UNICODE_PROPERTY_STAGE2_SHIFT 4
+#define UNICODE_PROPERTY_CATEGORY_MASK 0x1F
+#define UNICODE_PROPERTY_WHITESPACE_BIT (1 << 5)
+#define UNICODE_PROPERTY_NUMERIC_BIT (1 << 6)
+
+#define UNICODE_PROPERTY_STAGE1_ENTRIES 2176
+#define UNICODE_PROPERTY_STAGE2_ENTRIES 3968
+#define UNICODE_PROPERTY_STAGE3_ENTRIES 11184
+
+extern const uint8_t unicode_property_stage1[UNICODE_PROPERTY_STAGE1_ENTRIES];
+extern const uint16_t unicode_property_stage2[UNICODE_PROPERTY_STAGE2_ENTRIES];
+extern const uint8_t unicode_property_stage3[UNICODE_PROPERTY_STAGE3_ENTRIES];
+
+// See tools/genpow10.py.
+struct Pow10Entry {
+    uint64_t high;
+    uint64_t low;
+};
 
-#define NUM_LOWERCASING_SINGLECHAR_ENTRIES 1406
-extern const UnicodeConversionSingleChar lowercasing_single[NUM_LOWERCASING_SINGLECHAR_ENTRIES];
+#define POW10_MIN_EXPONENT -292
+#define POW10_MAX_EXPONENT 326
+#define POW10_ENTRIES 619
+#define POW5_MIN_EXPONENT -342
+#define POW5_MAX_EXPONENT 308
+#define POW5_ENTRIES 651
 
+extern const Pow10Entry pow10_significands[POW10_ENTRIES];
+extern const Pow10Entry pow5_significands[POW5_ENTRIES];
+// clang-format on
 
 } // namespace pystd2026
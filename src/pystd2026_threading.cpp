@@ -3,9 +3,42 @@
 
 #include <pystd2026_threading.hpp>
 #include <errno.h>
+#include <sched.h>
+#include <unistd.h>
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <fcntl.h>
+#include <stdio.h>
 
 namespace pystd2026 {
 
+namespace {
+
+size_t online_cpu_count() {
+    const long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (size_t)count : 1;
+}
+
+const uint32_t NO_READER_SLOT = UINT32_MAX;
+
+// Threads get reader slots of big reader locks and epoch domains
+// round robin in the order they first enter a read section.
+Atomic<uint32_t> next_reader_slot;
+thread_local uint32_t this_thread_reader_slot = NO_READER_SLOT;
+
+} // namespace
+
+void futex_wait(uint32_t *address, uint32_t expected) {
+    syscall(SYS_futex, address, FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+}
+
+void futex_wake(uint32_t *address, uint32_t num_waiters) {
+    syscall(SYS_futex, address, FUTEX_WAKE_PRIVATE, num_waiters, nullptr, nullptr, 0);
+}
+
+void futex_wake_all(uint32_t *address) { futex_wake(address, INT_MAX); }
+
 Mutex::Mutex() noexcept {
     m = PTHREAD_MUTEX_INITIALIZER;
     pthread_mutex_init(&m, nullptr);
@@ -39,17 +72,384 @@ void Mutex::unlock() {
     }
 }
 
+void FastMutex::lock_contended() noexcept {
+    const int spin_rounds = 100;
+    for(int i = 0; i < spin_rounds; ++i) {
+        cpu_relax();
+        if(state.load(MemoryOrder::Relaxed) == UNLOCKED && try_lock()) {
+            return;
+        }
+    }
+    // From here on the state says that there may be waiters, so
+    // whoever unlocks will wake one of us up.
+    while(state.exchange(LOCKED_WITH_WAITERS, MemoryOrder::Acquire) != UNLOCKED) {
+        futex_wait(state.address(), LOCKED_WITH_WAITERS);
+    }
+}
+
+bool SharedMutex::try_lock() noexcept {
+    uint32_t current = state.load(MemoryOrder::Relaxed);
+    // Whoever gets the lock clears the waiting flag. Other waiting
+    // writers set it again when they wake up.
+    while((current & ~WRITER_WAITING) == 0) {
+        if(state.compare_exchange_weak(
+               current, WRITER, MemoryOrder::Acquire, MemoryOrder::Relaxed)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void SharedMutex::lock_contended() noexcept {
+    const int spin_rounds = 100;
+    for(int i = 0; i < spin_rounds; ++i) {
+        cpu_relax();
+        if(try_lock()) {
+            return;
+        }
+    }
+    while(!try_lock()) {
+        uint32_t current = state.load(MemoryOrder::Relaxed);
+        if((current & ~WRITER_WAITING) == 0) {
+            continue;
+        }
+        if((current & WRITER_WAITING) == 0) {
+            if(!state.compare_exchange_strong(current,
+                                              current | WRITER_WAITING,
+                                              MemoryOrder::Relaxed,
+                                              MemoryOrder::Relaxed)) {
+                continue;
+            }
+            current |= WRITER_WAITING;
+        }
+        sleep_while(current);
+    }
+}
+
+void SharedMutex::lock_shared_contended() noexcept {
+    const int spin_rounds = 100;
+    for(int i = 0; i < spin_rounds; ++i) {
+        cpu_relax();
+        if(try_lock_shared()) {
+            return;
+        }
+    }
+    while(!try_lock_shared()) {
+        const uint32_t current = state.load(MemoryOrder::Relaxed);
+        if((current & (WRITER | WRITER_WAITING)) != 0) {
+            sleep_while(current);
+        }
+    }
+}
+
+void SharedMutex::sleep_while(uint32_t current) noexcept {
+    sleepers.fetch_add(1, MemoryOrder::SeqCst);
+    futex_wait(state.address(), current);
+    sleepers.fetch_sub(1, MemoryOrder::SeqCst);
+}
+
+void SharedMutex::wake_sleepers() noexcept {
+    if(sleepers.load(MemoryOrder::SeqCst) != 0) {
+        futex_wake_all(state.address());
+    }
+}
+
+BigReaderLock::BigReaderLock() : slots{online_cpu_count()} {}
+
+BigReaderLock::ReaderSlot &BigReaderLock::slot_for_this_thread() noexcept {
+    if(this_thread_reader_slot == NO_READER_SLOT) {
+        this_thread_reader_slot = next_reader_slot.fetch_add(1, MemoryOrder::Relaxed);
+    }
+    return slots.unsafe_at(this_thread_reader_slot % slots.size());
+}
+
+void BigReaderLock::lock_shared() noexcept {
+    ReaderSlot &slot = slot_for_this_thread();
+    while(true) {
+        slot.readers.fetch_add(1, MemoryOrder::SeqCst);
+        if(writer_active.load(MemoryOrder::SeqCst) == 0) {
+            return;
+        }
+        // Back off so that the writer can proceed.
+        unlock_shared();
+        while(writer_active.load(MemoryOrder::Acquire) != 0) {
+            futex_wait(writer_active.address(), 1);
+        }
+    }
+}
+
+void BigReaderLock::unlock_shared() noexcept {
+    ReaderSlot &slot = slot_for_this_thread();
+    if(slot.readers.fetch_sub(1, MemoryOrder::SeqCst) == 1 &&
+       writer_active.load(MemoryOrder::SeqCst) != 0) {
+        futex_wake(slot.readers.address(), 1);
+    }
+}
+
+void BigReaderLock::lock() noexcept {
+    writer_mutex.lock();
+    writer_active.store(1, MemoryOrder::SeqCst);
+    // New readers now back off, wait for the current ones to leave.
+    const int spin_rounds = 100;
+    for(size_t i = 0; i < slots.size(); ++i) {
+        ReaderSlot &slot = slots.unsafe_at(i);
+        int spins = 0;
+        uint32_t readers;
+        while((readers = slot.readers.load(MemoryOrder::SeqCst)) != 0) {
+            if(++spins < spin_rounds) {
+                cpu_relax();
+            } else {
+                futex_wait(slot.readers.address(), readers);
+            }
+        }
+    }
+}
+
+void BigReaderLock::unlock() noexcept {
+    writer_active.store(0, MemoryOrder::SeqCst);
+    futex_wake_all(writer_active.address());
+    writer_mutex.unlock();
+}
+
+EpochDomain::EpochDomain() : slots{online_cpu_count()} {}
+
+EpochDomain::~EpochDomain() { free_objects(retired); }
+
+EpochDomain::ReaderSlot &EpochDomain::slot_for_this_thread() noexcept {
+    if(this_thread_reader_slot == NO_READER_SLOT) {
+        this_thread_reader_slot = next_reader_slot.fetch_add(1, MemoryOrder::Relaxed);
+    }
+    return slots.unsafe_at(this_thread_reader_slot % slots.size());
+}
+
+void EpochDomain::wait_for_readers(uint32_t parity) noexcept {
+    const int spin_rounds = 100;
+    for(size_t i = 0; i < slots.size(); ++i) {
+        Atomic<uint32_t> &readers = slots.unsafe_at(i).readers[parity];
+        int spins = 0;
+        while(readers.load(MemoryOrder::SeqCst) != 0) {
+            if(++spins < spin_rounds) {
+                cpu_relax();
+            } else {
+                sched_yield();
+            }
+        }
+    }
+}
+
+void EpochDomain::synchronize() noexcept {
+    LockGuard<FastMutex> lg(synchronize_mutex);
+    // A reader may have read the epoch just before a flip and counted
+    // itself in the old parity just after it. Flipping twice and
+    // draining both parities covers such stragglers. New readers
+    // always go to the other parity than the one being drained, so
+    // they can not hold up the wait.
+    for(int round = 0; round < 2; ++round) {
+        const uint32_t previous = epoch.fetch_add(1, MemoryOrder::SeqCst);
+        atomic_thread_fence(MemoryOrder::SeqCst);
+        wait_for_readers(previous & 1);
+    }
+}
+
+void EpochDomain::free_objects(Vector<RetiredObject> &objects) {
+    for(auto &r : objects) {
+        r.deleter(r.object);
+    }
+    objects.clear();
+}
+
+void EpochDomain::retire(void *object, void (*deleter)(void *)) {
+    Vector<RetiredObject> batch;
+    {
+        LockGuard<FastMutex> lg(retired_mutex);
+        retired.push_back(RetiredObject{object, deleter});
+        if(retired.size() < RETIRE_BATCH_SIZE) {
+            retired_count.store(retired.size(), MemoryOrder::Relaxed);
+            return;
+        }
+        batch = ::pystd2026::move(retired);
+        retired_count.store(0, MemoryOrder::Relaxed);
+    }
+    synchronize();
+    free_objects(batch);
+}
+
+void EpochDomain::collect() {
+    Vector<RetiredObject> batch;
+    {
+        LockGuard<FastMutex> lg(retired_mutex);
+        batch = ::pystd2026::move(retired);
+        retired_count.store(0, MemoryOrder::Relaxed);
+    }
+    synchronize();
+    free_objects(batch);
+}
+
+void ConditionVariable::notify_one() {
+    __atomic_add_fetch(&sequence, 1, __ATOMIC_SEQ_CST);
+    if(__atomic_load_n(&waiters, __ATOMIC_SEQ_CST) != 0) {
+        futex_wake(&sequence, 1);
+    }
+}
+
+void ConditionVariable::notify_all() {
+    __atomic_add_fetch(&sequence, 1, __ATOMIC_SEQ_CST);
+    if(__atomic_load_n(&waiters, __ATOMIC_SEQ_CST) != 0) {
+        futex_wake_all(&sequence);
+    }
+}
+
+bool Semaphore::try_acquire() {
+    uint32_t current = __atomic_load_n(&count, __ATOMIC_RELAXED);
+    while(current != 0) {
+        if(__atomic_compare_exchange_n(
+               &count, &current, current - 1, true, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void Semaphore::acquire() {
+    while(!try_acquire()) {
+        __atomic_add_fetch(&waiters, 1, __ATOMIC_SEQ_CST);
+        // Sleeps only if the count is still zero.
+        futex_wait(&count, 0);
+        __atomic_sub_fetch(&waiters, 1, __ATOMIC_SEQ_CST);
+    }
+}
+
+void Semaphore::release(uint32_t amount) {
+    __atomic_add_fetch(&count, amount, __ATOMIC_SEQ_CST);
+    if(__atomic_load_n(&waiters, __ATOMIC_SEQ_CST) != 0) {
+        futex_wake(&count, amount);
+    }
+}
+
+void Latch::count_down(uint32_t amount) {
+    const uint32_t previous = __atomic_fetch_sub(&count, amount, __ATOMIC_ACQ_REL);
+    if(previous < amount) {
+        internal_failure("Latch counted below zero.");
+    }
+    if(previous == amount) {
+        futex_wake_all(&count);
+    }
+}
+
+void Latch::wait() {
+    uint32_t current;
+    while((current = __atomic_load_n(&count, __ATOMIC_ACQUIRE)) != 0) {
+        futex_wait(&count, current);
+    }
+}
+
+Barrier::Barrier(uint32_t num_threads_) : num_threads{num_threads_}, remaining{num_threads_} {
+    if(num_threads == 0) {
+        throw PyException("Barrier needs at least one thread.");
+    }
+}
+
+void Barrier::arrive_and_wait() {
+    const uint32_t current_generation = __atomic_load_n(&generation, __ATOMIC_ACQUIRE);
+    if(__atomic_sub_fetch(&remaining, 1, __ATOMIC_ACQ_REL) == 0) {
+        // Nobody can arrive for the next round before the generation
+        // changes, so the count can be reset first.
+        __atomic_store_n(&remaining, num_threads, __ATOMIC_RELAXED);
+        __atomic_add_fetch(&generation, 1, __ATOMIC_RELEASE);
+        futex_wake_all(&generation);
+        return;
+    }
+    while(__atomic_load_n(&generation, __ATOMIC_ACQUIRE) == current_generation) {
+        futex_wait(&generation, current_generation);
+    }
+}
+
+Vector<int> numa_node_cpus(int node) {
+    char path[64];
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", node);
+    const int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if(fd < 0) {
+        throw PyException("Unknown NUMA node.");
+    }
+    char buf[4096];
+    const ssize_t num_read = read(fd, buf, sizeof(buf));
+    close(fd);
+    if(num_read <= 0 || num_read == sizeof(buf)) {
+        throw PyException("Could not read NUMA node CPU list.");
+    }
+    // The format is like "0-3,8-11\n".
+    CStringView cpulist(buf, (size_t)num_read);
+    if(cpulist.data()[cpulist.size() - 1] == '\n') {
+        cpulist = cpulist.substr(0, cpulist.size() - 1);
+    }
+    Vector<int> cpus;
+    for(CStringView range : cpulist.split_view(',')) {
+        if(range.is_empty()) {
+            continue;
+        }
+        const size_t dash = range.find('-');
+        auto first = parse_int<int>(range.substr(0, dash));
+        auto last = dash == (size_t)-1 ? parse_int<int>(range)
+                                       : parse_int<int>(range.substr(dash + 1));
+        if(!first || !last) {
+            throw PyException("Malformed NUMA node CPU list.");
+        }
+        for(int cpu = first.value(); cpu <= last.value(); ++cpu) {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
 Thread::Thread(void *(*thread_main_func)(void *), void *ctx) {
+    start(thread_main_func, ctx, ThreadOptions{});
+}
+
+Thread::Thread(void *(*thread_main_func)(void *), void *ctx, const ThreadOptions &options) {
+    start(thread_main_func, ctx, options);
+}
+
+void Thread::start(void *(*thread_main_func)(void *), void *ctx, const ThreadOptions &options) {
+    if(options.name.size() > 15) {
+        throw PyException("Thread name is longer than 15 bytes.");
+    }
     pthread_attr_t attr;
     auto rc = pthread_attr_init(&attr);
     if(rc != 0) {
         throw PyException(strerror(rc));
     }
+    if(options.stack_size != 0) {
+        rc = pthread_attr_setstacksize(&attr, options.stack_size);
+        if(rc != 0) {
+            pthread_attr_destroy(&attr);
+            throw PyException("Invalid thread stack size.");
+        }
+    }
+    if(!options.cpu_affinity.is_empty()) {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        for(const int cpu : options.cpu_affinity) {
+            if(cpu < 0 || cpu >= CPU_SETSIZE) {
+                pthread_attr_destroy(&attr);
+                throw PyException("CPU index out of range.");
+            }
+            CPU_SET(cpu, &cpus);
+        }
+        rc = pthread_attr_setaffinity_np(&attr, sizeof(cpus), &cpus);
+        if(rc != 0) {
+            pthread_attr_destroy(&attr);
+            throw PyException(strerror(rc));
+        }
+    }
     rc = pthread_create(&thread, &attr, thread_main_func, ctx);
     pthread_attr_destroy(&attr);
     if(rc != 0) {
         throw PyException(strerror(rc));
     }
+    if(!options.name.is_empty()) {
+        // Only fails if the name is too long, which was checked above.
+        pthread_setname_np(thread, options.name.c_str());
+    }
 }
 
 Thread::~Thread() {
@@ -68,4 +468,400 @@ void Thread::detach() {
     thread_is_finalized = true;
 }
 
+namespace {
+
+static_assert(sizeof(PoolTask) % sizeof(uint64_t) == 0);
+static_assert(is_trivially_copyable_v<PoolTask>);
+
+const size_t TASK_WORDS = sizeof(PoolTask) / sizeof(uint64_t);
+// Rounds of looking for work before a worker goes to sleep.
+const int SPIN_ROUNDS = 64;
+
+// Tasks are copied a word at a time with atomic operations, because
+// a thief may read a slot while the owner is writing to it. Such a
+// read is always discarded by the failing compare and swap on top.
+struct TaskSlot {
+    uint64_t words[TASK_WORDS];
+
+    void store(const PoolTask &task) {
+        uint64_t source[TASK_WORDS];
+        memcpy(source, &task, sizeof(source));
+        for(size_t i = 0; i < TASK_WORDS; ++i) {
+            __atomic_store_n(&words[i], source[i], __ATOMIC_RELAXED);
+        }
+    }
+
+    void load(PoolTask &task) const {
+        uint64_t result[TASK_WORDS];
+        for(size_t i = 0; i < TASK_WORDS; ++i) {
+            result[i] = __atomic_load_n(&words[i], __ATOMIC_RELAXED);
+        }
+        memcpy(&task, result, sizeof(result));
+    }
+};
+
+// The Chase-Lev deque with the memory orderings from Lê et al.,
+// "Correct and Efficient Work-Stealing for Weak Memory Models".
+// The capacity is fixed, a full deque makes push fail.
+class WorkStealingDeque {
+public:
+    static constexpr int64_t CAPACITY = 1024;
+
+    bool push(const PoolTask &task) {
+        const int64_t b = __atomic_load_n(&bottom, __ATOMIC_RELAXED);
+        const int64_t t = __atomic_load_n(&top, __ATOMIC_ACQUIRE);
+        if(b - t >= CAPACITY) {
+            return false;
+        }
+        slots[b & (CAPACITY - 1)].store(task);
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+        __atomic_store_n(&bottom, b + 1, __ATOMIC_RELAXED);
+        return true;
+    }
+
+    bool pop(PoolTask &task) {
+        const int64_t b = __atomic_load_n(&bottom, __ATOMIC_RELAXED) - 1;
+        __atomic_store_n(&bottom, b, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        int64_t t = __atomic_load_n(&top, __ATOMIC_RELAXED);
+        if(t > b) {
+            __atomic_store_n(&bottom, b + 1, __ATOMIC_RELAXED);
+            return false;
+        }
+        slots[b & (CAPACITY - 1)].load(task);
+        if(t == b) {
+            // Last item, race against thieves for it.
+            const bool won = __atomic_compare_exchange_n(
+                &top, &t, t + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+            __atomic_store_n(&bottom, b + 1, __ATOMIC_RELAXED);
+            return won;
+        }
+        return true;
+    }
+
+    bool steal(PoolTask &task) {
+        int64_t t = __atomic_load_n(&top, __ATOMIC_ACQUIRE);
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        const int64_t b = __atomic_load_n(&bottom, __ATOMIC_ACQUIRE);
+        if(t >= b) {
+            return false;
+        }
+        slots[t & (CAPACITY - 1)].load(task);
+        return __atomic_compare_exchange_n(
+            &top, &t, t + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+    }
+
+    bool looks_empty() const {
+        return __atomic_load_n(&bottom, __ATOMIC_SEQ_CST) <=
+               __atomic_load_n(&top, __ATOMIC_SEQ_CST);
+    }
+
+private:
+    alignas(CACHE_LINE_SIZE) int64_t top = 0;
+    alignas(CACHE_LINE_SIZE) int64_t bottom = 0;
+    alignas(CACHE_LINE_SIZE) TaskSlot slots[CAPACITY];
+};
+
+} // namespace
+
+struct alignas(CACHE_LINE_SIZE) PoolWorker {
+    WorkStealingDeque deque;
+    ThreadPoolState *pool;
+    size_t index;
+    uint64_t random_state;
+};
+
+namespace {
+
+thread_local PoolWorker *current_worker = nullptr;
+
+} // namespace
+
+struct ThreadPoolState {
+    Vector<unique_ptr<PoolWorker>> workers;
+    Vector<unique_ptr<Thread>> threads;
+
+    pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+    pthread_cond_t work_available = PTHREAD_COND_INITIALIZER;
+    pthread_cond_t became_idle = PTHREAD_COND_INITIALIZER;
+
+    // Tasks from threads outside the pool and overflow from full
+    // deques. Protected by the mutex.
+    Vector<PoolTask> shared_queue;
+    size_t shared_queue_head = 0;
+    int64_t shared_queue_size = 0;
+
+    // Tasks that have been submitted but not finished.
+    int64_t pending_tasks = 0;
+    int64_t sleeping_workers = 0;
+    int64_t idle_waiters = 0;
+    bool stopping = false;
+
+    ~ThreadPoolState() {
+        pthread_cond_destroy(&became_idle);
+        pthread_cond_destroy(&work_available);
+        pthread_mutex_destroy(&mutex);
+    }
+
+    PoolWorker *worker_for_this_thread() {
+        return current_worker && current_worker->pool == this ? current_worker : nullptr;
+    }
+
+    void push_shared(const PoolTask &task) {
+        pthread_mutex_lock(&mutex);
+        shared_queue.push_back(task);
+        __atomic_add_fetch(&shared_queue_size, 1, __ATOMIC_SEQ_CST);
+        pthread_mutex_unlock(&mutex);
+    }
+
+    bool pop_shared(PoolTask &task) {
+        if(__atomic_load_n(&shared_queue_size, __ATOMIC_SEQ_CST) == 0) {
+            return false;
+        }
+        pthread_mutex_lock(&mutex);
+        const bool found = shared_queue_head < shared_queue.size();
+        if(found) {
+            task = shared_queue[shared_queue_head++];
+            __atomic_sub_fetch(&shared_queue_size, 1, __ATOMIC_SEQ_CST);
+            if(shared_queue_head == shared_queue.size()) {
+                shared_queue.clear();
+                shared_queue_head = 0;
+            }
+        }
+        pthread_mutex_unlock(&mutex);
+        return found;
+    }
+
+    bool steal_from_others(PoolWorker *thief, PoolTask &task) {
+        const size_t num_workers = workers.size();
+        size_t start = 0;
+        if(thief) {
+            // Xorshift, so that thieves do not all go for the same victim.
+            uint64_t x = thief->random_state;
+            x ^= x << 13;
+            x ^= x >> 7;
+            x ^= x << 17;
+            thief->random_state = x;
+            start = x % num_workers;
+        }
+        for(size_t i = 0; i < num_workers; ++i) {
+            PoolWorker *victim = workers[(start + i) % num_workers].get();
+            if(victim != thief && victim->deque.steal(task)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool find_task(PoolWorker *worker, PoolTask &task) {
+        if(worker && worker->deque.pop(task)) {
+            return true;
+        }
+        return pop_shared(task) || steal_from_others(worker, task);
+    }
+
+    bool has_visible_work() {
+        if(__atomic_load_n(&shared_queue_size, __ATOMIC_SEQ_CST) != 0) {
+            return true;
+        }
+        for(const auto &w : workers) {
+            if(!w->deque.looks_empty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void wake_one_sleeper() {
+        if(__atomic_load_n(&sleeping_workers, __ATOMIC_SEQ_CST) > 0) {
+            pthread_mutex_lock(&mutex);
+            pthread_cond_signal(&work_available);
+            pthread_mutex_unlock(&mutex);
+        }
+    }
+
+    void run_task(PoolTask &task) {
+        try {
+            task.run();
+        } catch(...) {
+            internal_failure("Thread pool task threw an exception.");
+        }
+        if(__atomic_sub_fetch(&pending_tasks, 1, __ATOMIC_SEQ_CST) == 0 &&
+           __atomic_load_n(&idle_waiters, __ATOMIC_SEQ_CST) > 0) {
+            pthread_mutex_lock(&mutex);
+            pthread_cond_broadcast(&became_idle);
+            pthread_mutex_unlock(&mutex);
+        }
+    }
+
+    // Returns false when the pool is shutting down.
+    bool sleep_until_work() {
+        pthread_mutex_lock(&mutex);
+        __atomic_add_fetch(&sleeping_workers, 1, __ATOMIC_SEQ_CST);
+        // Submitters push before reading sleeping_workers and we
+        // increment it before looking for work, so one of us sees
+        // the other.
+        while(!stopping && !has_visible_work()) {
+            pthread_cond_wait(&work_available, &mutex);
+        }
+        __atomic_sub_fetch(&sleeping_workers, 1, __ATOMIC_SEQ_CST);
+        const bool keep_running = !stopping || has_visible_work();
+        pthread_mutex_unlock(&mutex);
+        return keep_running;
+    }
+
+    void worker_main(PoolWorker *worker) {
+        current_worker = worker;
+        PoolTask task;
+        while(true) {
+            bool found = false;
+            for(int round = 0; round < SPIN_ROUNDS && !found; ++round) {
+                found = find_task(worker, task);
+                if(!found && round >= SPIN_ROUNDS / 2) {
+                    sched_yield();
+                }
+            }
+            if(found) {
+                run_task(task);
+            } else if(!sleep_until_work()) {
+                break;
+            }
+        }
+        current_worker = nullptr;
+    }
+};
+
+namespace {
+
+void *pool_worker_main(void *ctx) {
+    auto *worker = static_cast<PoolWorker *>(ctx);
+    worker->pool->worker_main(worker);
+    return nullptr;
+}
+
+} // namespace
+
+ThreadPool::ThreadPool(size_t num_workers) : state{new ThreadPoolState} {
+    if(num_workers == 0) {
+        num_workers = online_cpu_count();
+    }
+    for(size_t i = 0; i < num_workers; ++i) {
+        auto *worker = new PoolWorker;
+        worker->pool = state.get();
+        worker->index = i;
+        worker->random_state = 0x9E3779B97F4A7C15ULL * (i + 1);
+        state->workers.push_back(unique_ptr<PoolWorker>(worker));
+    }
+    // Workers look at each other's deques, so all of them must
+    // exist before any thread starts.
+    try {
+        for(size_t i = 0; i < num_workers; ++i) {
+            state->threads.push_back(
+                unique_ptr<Thread>(new Thread(pool_worker_main, state->workers[i].get())));
+        }
+    } catch(...) {
+        // The destructor does not run, so stop the threads that did
+        // start or joining them would block forever.
+        pthread_mutex_lock(&state->mutex);
+        state->stopping = true;
+        pthread_cond_broadcast(&state->work_available);
+        pthread_mutex_unlock(&state->mutex);
+        state->threads.clear();
+        throw;
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    wait_idle();
+    pthread_mutex_lock(&state->mutex);
+    state->stopping = true;
+    pthread_cond_broadcast(&state->work_available);
+    pthread_mutex_unlock(&state->mutex);
+    state->threads.clear();
+}
+
+void ThreadPool::submit_task(const PoolTask &task) {
+    __atomic_add_fetch(&state->pending_tasks, 1, __ATOMIC_SEQ_CST);
+    PoolWorker *worker = state->worker_for_this_thread();
+    if(!worker || !worker->deque.push(task)) {
+        state->push_shared(task);
+    }
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    state->wake_one_sleeper();
+}
+
+bool ThreadPool::run_pending_task() {
+    PoolTask task;
+    if(!state->find_task(state->worker_for_this_thread(), task)) {
+        return false;
+    }
+    state->run_task(task);
+    return true;
+}
+
+void ThreadPool::wait_idle() {
+    while(__atomic_load_n(&state->pending_tasks, __ATOMIC_SEQ_CST) > 0) {
+        if(run_pending_task()) {
+            continue;
+        }
+        if(state->worker_for_this_thread()) {
+            // Tasks still running elsewhere may submit more work.
+            sched_yield();
+            continue;
+        }
+        pthread_mutex_lock(&state->mutex);
+        __atomic_add_fetch(&state->idle_waiters, 1, __ATOMIC_SEQ_CST);
+        while(__atomic_load_n(&state->pending_tasks, __ATOMIC_SEQ_CST) > 0 &&
+              !state->has_visible_work()) {
+            pthread_cond_wait(&state->became_idle, &state->mutex);
+        }
+        __atomic_sub_fetch(&state->idle_waiters, 1, __ATOMIC_SEQ_CST);
+        pthread_mutex_unlock(&state->mutex);
+    }
+}
+
+size_t ThreadPool::num_workers() const { return state->workers.size(); }
+
+void ThreadPool::wait_for(Latch &latch) {
+    while(!latch.try_wait()) {
+        if(!run_pending_task()) {
+            latch.wait();
+        }
+    }
+}
+
+Vector<Optional<Bytes>> load_many(ThreadPool &pool, Span<Path> paths) {
+    Vector<Optional<Bytes>> results;
+    results.append_with_default(paths.size());
+    Path *path_data = paths.data();
+    Optional<Bytes> *result_data = results.data();
+    const size_t num_paths = paths.size();
+    Atomic<size_t> next_index;
+    const size_t num_tasks = pool.num_workers() < num_paths ? pool.num_workers() : num_paths;
+    Latch remaining((uint32_t)num_tasks);
+    auto loader = [&next_index, &remaining, path_data, result_data, num_paths] {
+        size_t i;
+        while((i = next_index.fetch_add(1, MemoryOrder::Relaxed)) < num_paths) {
+            result_data[i] = path_data[i].load_bytes();
+        }
+        remaining.count_down();
+    };
+    for(size_t i = 0; i < num_tasks; ++i) {
+        pool.submit(loader);
+    }
+    // The loads wait on I/O, so the caller mostly sleeps here.
+    pool.wait_for(remaining);
+    return results;
+}
+
+Vector<Optional<Bytes>> load_many(Span<Path> paths, size_t num_threads) {
+    ThreadPool pool(num_threads);
+    return load_many(pool, paths);
+}
+
+ThreadPool &default_thread_pool() {
+    static ThreadPool pool;
+    return pool;
+}
+
 } // namespace pystd2026
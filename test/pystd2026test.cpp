@@ -6,11 +6,15 @@
 
 #include <pystd2026_hashtable.hpp>
 #include <pystd2026_variant.hpp>
+#include <pystd2026_format.hpp>
 #include <pystd2026_rotate.hpp>
 #include <pystd2026_stablepartition.hpp>
 #include <pystd2026_nth_element.hpp>
 #include <pystd_testconfig.hpp>
 #include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include <fcntl.h>
 
 namespace {
 
@@ -73,6 +77,113 @@ int test_cstring_split() {
     return 0;
 }
 
+int test_cstring_split_view() {
+    TEST_START;
+    pystd2026::CString record("a,,bc,");
+    pystd2026::Vector<pystd2026::CStringView> parts;
+    for(const auto piece : record.split_view(',')) {
+        parts.push_back(piece);
+    }
+    ASSERT(parts.size() == 4);
+    ASSERT(parts[0] == "a");
+    ASSERT(parts[1] == "");
+    ASSERT(parts[2] == "bc");
+    ASSERT(parts[3] == "");
+    ASSERT(parts[2].data() == record.data() + 3);
+
+    parts.clear();
+    for(const auto piece : pystd2026::CStringView("").split_view(',')) {
+        parts.push_back(piece);
+    }
+    ASSERT(parts.size() == 1);
+    ASSERT(parts[0].is_empty());
+
+    parts.clear();
+    for(const auto piece : pystd2026::CStringView("1::2:::3").split_view("::")) {
+        parts.push_back(piece);
+    }
+    ASSERT(parts.size() == 3);
+    ASSERT(parts[0] == "1");
+    ASSERT(parts[1] == "2");
+    ASSERT(parts[2] == ":3");
+
+    parts.clear();
+    for(const auto piece :
+        record.view().split_view_if([](char c) { return c == ',' || c == 'b'; })) {
+        parts.push_back(piece);
+    }
+    ASSERT(parts.size() == 2);
+    ASSERT(parts[0] == "a");
+    ASSERT(parts[1] == "c");
+
+    bool thrown = false;
+    try {
+        record.split_view("");
+    } catch(const pystd2026::PyException &) {
+        thrown = true;
+    }
+    ASSERT(thrown);
+    return 0;
+}
+
+int test_cstring_tokenizer() {
+    TEST_START;
+    // Pieces and gaps of varying lengths so that they straddle the
+    // 64 byte block boundaries in different ways.
+    pystd2026::CString source;
+    for(size_t i = 0; i < 200; ++i) {
+        for(size_t j = 0; j < i % 71 + 1; ++j) {
+            source += (char)('a' + j % 26);
+        }
+        const char *separators = " \t\n\r";
+        for(size_t j = 0; j < i % 5 + 1; ++j) {
+            source += separators[(i + j) % 4];
+        }
+    }
+    source += "tail";
+    // Reference pieces found one byte at a time.
+    pystd2026::Vector<pystd2026::CStringView> expected;
+    size_t piece_start = 0;
+    for(size_t i = 0; i <= source.size(); ++i) {
+        if(i == source.size() || strchr(" \t\n\r", source[i])) {
+            if(i > piece_start) {
+                expected.push_back(
+                    pystd2026::CStringView(source.data() + piece_start, i - piece_start));
+            }
+            piece_start = i + 1;
+        }
+    }
+    ASSERT(expected.size() == 201);
+    ASSERT(source.split().size() == 201);
+
+    pystd2026::WhitespaceTokenizer tokenizer(source.view());
+    pystd2026::Vector<pystd2026::CStringView> pieces;
+    size_t batches = 0;
+    while(tokenizer.next_batch(pieces, 7) > 0) {
+        ++batches;
+    }
+    ASSERT(batches == 29);
+    ASSERT(pieces.size() == expected.size());
+    for(size_t i = 0; i < pieces.size(); ++i) {
+        ASSERT(pieces[i] == expected[i]);
+    }
+
+    pystd2026::U8String u8source("  大刀 bb\tcc");
+    pystd2026::WhitespaceTokenizer u8tokenizer(u8source.view());
+    pystd2026::Vector<pystd2026::U8StringView> u8pieces;
+    ASSERT(u8tokenizer.next_batch(u8pieces, 100) == 3);
+    ASSERT(u8tokenizer.next_batch(u8pieces, 100) == 0);
+    ASSERT(u8pieces[0] == "大刀");
+    ASSERT(u8pieces[2] == "cc");
+
+    pystd2026::WhitespaceTokenizer loctokenizer(pystd2026::CStringView("a  bcd "));
+    pystd2026::Vector<pystd2026::PieceLocation> locations;
+    ASSERT(loctokenizer.next_batch(locations, 100) == 2);
+    ASSERT(locations[1].offset == 3);
+    ASSERT(locations[1].size == 3);
+    return 0;
+}
+
 int test_cstring_splice() {
     TEST_START;
     pystd2026::CString text("This is short.");
@@ -97,6 +208,36 @@ int test_cstring_casing() {
     return 0;
 }
 
+int test_cstring_find() {
+    TEST_START;
+    pystd2026::CStringView text("abcabcabd");
+
+    ASSERT(text.find('a') == 0);
+    ASSERT(text.find('d') == 8);
+    ASSERT(text.find('x') == (size_t)-1);
+    ASSERT(text.rfind('a') == 6);
+    ASSERT(text.rfind('x') == (size_t)-1);
+
+    ASSERT(text.find("abc") == 0);
+    ASSERT(text.find("cab") == 2);
+    ASSERT(text.find("abd") == 6);
+    ASSERT(text.find("abcabcabd") == 0);
+    ASSERT(text.find("abe") == (size_t)-1);
+    ASSERT(text.find("abcabcabdx") == (size_t)-1);
+    ASSERT(text.find("") == 0);
+
+    ASSERT(text.rfind("abc") == 3);
+    ASSERT(text.rfind("ab") == 6);
+    ASSERT(text.rfind("abcabcabd") == 0);
+    ASSERT(text.rfind("bd") == 7);
+    ASSERT(text.rfind("bx") == (size_t)-1);
+
+    pystd2026::CString str("a.b.c");
+    ASSERT(str.rfind('.') == 3);
+    ASSERT(str.find(".c") == 3);
+    return 0;
+}
+
 int test_cstringview_natural_order() {
     TEST_START;
     pystd2026::CStringView str1("abc");
@@ -128,14 +269,90 @@ int test_cstringview_natural_order() {
     return 0;
 }
 
+int test_cstring_parse_int() {
+    TEST_START;
+    using pystd2026::parse_int;
+    using pystd2026::ParseError;
+    ASSERT(parse_int<int>("0").value() == 0);
+    ASSERT(parse_int<int>("-0").value() == 0);
+    ASSERT(parse_int<int>("+42").value() == 42);
+    ASSERT(parse_int<int>("-2147483648").value() == -2147483647 - 1);
+    ASSERT(parse_int<int>("2147483648").error() == ParseError::OutOfRange);
+    ASSERT(parse_int<int8_t>("-129").error() == ParseError::OutOfRange);
+    ASSERT(parse_int<uint8_t>("255").value() == 255);
+    ASSERT(parse_int<uint8_t>("-1").error() == ParseError::OutOfRange);
+    ASSERT(parse_int<uint64_t>("18446744073709551615").value() == 18446744073709551615ULL);
+    ASSERT(parse_int<uint64_t>("18446744073709551616").error() == ParseError::OutOfRange);
+    ASSERT(parse_int<int64_t>("-9223372036854775808").value() == -9223372036854775807LL - 1);
+    ASSERT(parse_int<int64_t>("123456789012345678").value() == 123456789012345678LL);
+    ASSERT(parse_int<int64_t>("00000000000000000000000000007").value() == 7);
+    ASSERT(parse_int<int>("").error() == ParseError::Empty);
+    ASSERT(parse_int<int>("-").error() == ParseError::InvalidCharacter);
+    ASSERT(parse_int<int>("12a").error() == ParseError::InvalidCharacter);
+    ASSERT(parse_int<int>(" 12").error() == ParseError::InvalidCharacter);
+    ASSERT(parse_int<int>("12345678x").error() == ParseError::InvalidCharacter);
+    ASSERT(parse_int<int>("99999999999999999999x").error() == ParseError::InvalidCharacter);
+    ASSERT(parse_int<int>("ff", 16).value() == 255);
+    ASSERT(parse_int<int>("-Zz", 36).value() == -1295);
+    ASSERT(parse_int<int>("102", 2).error() == ParseError::InvalidCharacter);
+
+    pystd2026::CStringView view("12345");
+    ASSERT(parse_int<int>(view.substr(1, 3)).value() == 234);
+    return 0;
+}
+
+int test_cstring_parse_float() {
+    TEST_START;
+    using pystd2026::parse_float;
+    using pystd2026::ParseError;
+    ASSERT(parse_float("0").value() == 0.0);
+    ASSERT(signbit(parse_float("-0.0").value()));
+    ASSERT(parse_float("1.5").value() == 1.5);
+    ASSERT(parse_float("-.25").value() == -0.25);
+    ASSERT(parse_float("5.").value() == 5.0);
+    ASSERT(parse_float("1e10").value() == 1e10);
+    ASSERT(parse_float("1E-5").value() == 1e-5);
+    ASSERT(parse_float("0.1").value() == 0.1);
+    ASSERT(parse_float("0.30000000000000004").value() == 0.30000000000000004);
+    ASSERT(parse_float("9007199254740993").value() == 9007199254740992.0);
+    ASSERT(parse_float("1.7976931348623157e308").value() == 1.7976931348623157e308);
+    ASSERT(parse_float("1.7976931348623159e308").value() == INFINITY);
+    ASSERT(parse_float("4.9e-324").value() == 4.9e-324);
+    ASSERT(parse_float("2.4703282292062327e-324").value() == 0.0);
+    ASSERT(parse_float("2.4703282292062328e-324").value() == 4.9e-324);
+    ASSERT(parse_float("2.2250738585072011e-308").value() == 2.2250738585072011e-308);
+    ASSERT(parse_float("3.14159265358979323846264338327950288").value() == 3.141592653589793);
+    ASSERT(parse_float("1e100000000000").value() == INFINITY);
+    ASSERT(parse_float("-1e-100000000000").value() == 0.0);
+    ASSERT(parse_float("inf").value() == INFINITY);
+    ASSERT(parse_float("-Infinity").value() == -INFINITY);
+    ASSERT(isnan(parse_float("NaN").value()));
+    ASSERT(parse_float("").error() == ParseError::Empty);
+    ASSERT(parse_float(".").error() == ParseError::InvalidCharacter);
+    ASSERT(parse_float("1e").error() == ParseError::InvalidCharacter);
+    ASSERT(parse_float("1e+").error() == ParseError::InvalidCharacter);
+    ASSERT(parse_float("1.5x").error() == ParseError::InvalidCharacter);
+    ASSERT(parse_float("1_0").error() == ParseError::InvalidCharacter);
+    ASSERT(parse_float("infinit").error() == ParseError::InvalidCharacter);
+
+    pystd2026::CStringView view("x2.5e1y");
+    ASSERT(parse_float(view.substr(1, 5)).value() == 25.0);
+    return 0;
+}
+
 int test_c_strings() {
     TEST_START;
     int failing_subtests = 0;
     failing_subtests += test_cstring_strip();
     failing_subtests += test_cstring_split();
+    failing_subtests += test_cstring_split_view();
+    failing_subtests += test_cstring_tokenizer();
     failing_subtests += test_cstring_splice();
     failing_subtests += test_cstring_casing();
+    failing_subtests += test_cstring_find();
     failing_subtests += test_cstringview_natural_order();
+    failing_subtests += test_cstring_parse_int();
+    failing_subtests += test_cstring_parse_float();
     return failing_subtests;
 }
 
@@ -273,6 +490,88 @@ int test_u8_split() {
     ASSERT(parts[0] == "aa");
     ASSERT(parts[1] == "bb");
     ASSERT(parts[2] == "cc");
+
+    // More pieces than the closure takes from the tokenizer at a time.
+    pystd2026::U8String many;
+    for(int i = 0; i < 100; ++i) {
+        many += pystd2026::U8String(i % 2 ? "\t大刀 " : " ab\n");
+    }
+    auto closure = many.view().split_ascii();
+    size_t num_pieces = 0;
+    while(auto piece = closure.next()) {
+        ASSERT(*piece == (num_pieces % 2 ? daikatana : "ab"));
+        ++num_pieces;
+    }
+    ASSERT(num_pieces == 100);
+    ASSERT(!closure.next());
+    return 0;
+}
+
+int test_u8_split_template() {
+    TEST_START;
+    // Contains an ideographic space and a no-break space.
+    pystd2026::U8String source("  大刀\u3000bb\u00a0cc  ");
+    pystd2026::Vector<pystd2026::U8StringView> parts;
+    source.split(
+        [&parts](const pystd2026::U8StringView &piece) {
+            parts.push_back(piece);
+            return true;
+        },
+        pystd2026::IsUnicodeWhitespace{});
+    ASSERT(parts.size() == 3);
+    ASSERT(parts[0] == daikatana);
+    ASSERT(parts[1] == "bb");
+    ASSERT(parts[2] == "cc");
+
+    parts.clear();
+    source.split(
+        [&parts](const pystd2026::U8StringView &piece) {
+            parts.push_back(piece);
+            return parts.size() < 2;
+        },
+        [](uint32_t codepoint) { return codepoint == 'b' || codepoint == 0x5200; });
+    ASSERT(parts.size() == 2);
+    ASSERT(parts[0] == "  大");
+    ASSERT(parts[1] == "\u3000");
+    return 0;
+}
+
+int test_u8_split_view() {
+    TEST_START;
+    pystd2026::U8String source("大刀, bb,\u3000cc");
+    pystd2026::Vector<pystd2026::U8StringView> parts;
+    for(const auto piece : source.split_view(',')) {
+        parts.push_back(piece);
+    }
+    ASSERT(parts.size() == 3);
+    ASSERT(parts[0] == daikatana);
+    ASSERT(parts[1] == " bb");
+    ASSERT(parts[2] == "\u3000cc");
+
+    parts.clear();
+    for(const auto piece : source.split_view("刀")) {
+        parts.push_back(piece);
+    }
+    ASSERT(parts.size() == 2);
+    ASSERT(parts[0] == "大");
+    ASSERT(parts[1] == ", bb,\u3000cc");
+
+    parts.clear();
+    for(const auto piece : source.split_view_if(pystd2026::IsUnicodeWhitespace{})) {
+        parts.push_back(piece);
+    }
+    ASSERT(parts.size() == 3);
+    ASSERT(parts[0] == "大刀,");
+    ASSERT(parts[1] == "bb,");
+    ASSERT(parts[2] == "cc");
+
+    bool thrown = false;
+    try {
+        source.split_view('\xe5');
+    } catch(const pystd2026::PyException &) {
+        thrown = true;
+    }
+    ASSERT(thrown);
     return 0;
 }
 
@@ -359,6 +658,74 @@ int test_u8_casing() {
     return 0;
 }
 
+int test_u8_casing_long() {
+    TEST_START;
+    // Long enough to go through the block conversion,
+    // with non-ASCII text in between the blocks.
+    const pystd2026::U8String START("The Quick Brown Fox @[`{ Jumps Över The Lazy Dög ÅÄÖ ß end");
+    const pystd2026::U8String UPPER("THE QUICK BROWN FOX @[`{ JUMPS ÖVER THE LAZY DÖG ÅÄÖ SS END");
+    const pystd2026::U8String LOWER("the quick brown fox @[`{ jumps över the lazy dög åäö ß end");
+
+    ASSERT(START.upper() == UPPER);
+    ASSERT(START.lower() == LOWER);
+
+    pystd2026::U8String str(START);
+    str.lower_inplace();
+    ASSERT(str == LOWER);
+    // Eszett uppercases to two letters, so this can not be done in place.
+    str.upper_inplace();
+    ASSERT(str == UPPER);
+    str.lower_inplace();
+    ASSERT(str == "the quick brown fox @[`{ jumps över the lazy dög åäö ss end");
+    return 0;
+}
+
+int test_u8_find() {
+    TEST_START;
+    pystd2026::U8String text("a大刀b大刀");
+    pystd2026::U8String sword(daikatana);
+    pystd2026::U8String missing("刀大");
+
+    ASSERT(text.find(sword.view()) == 1);
+    ASSERT(text.rfind(sword.view()) == 8);
+    ASSERT(text.find(missing.view()) == (size_t)-1);
+    ASSERT(text.rfind(missing.view()) == (size_t)-1);
+    return 0;
+}
+
+int test_u8_codepoint_index() {
+    TEST_START;
+    // Mix of one to four byte characters, long enough to be indexed.
+    const char *chars[4] = {"a", "\u00e4", "\u5927", "\U0001F600"};
+    pystd2026::U8String text;
+    pystd2026::Vector<size_t> offsets;
+    for(size_t i = 0; i < 1000; ++i) {
+        offsets.push_back(text.size_bytes());
+        text += pystd2026::U8String(chars[(i + i / 4) % 4]);
+    }
+    ASSERT(text.size_codepoints() == 1000);
+    ASSERT(text.view().size_codepoints() == 1000);
+    for(size_t i = 0; i < 1000; ++i) {
+        ASSERT(text.codepoint_offset(i) == offsets[i]);
+    }
+    ASSERT(text.codepoint_offset(1000) == text.size_bytes());
+    auto slice = text.slice_codepoints(998);
+    ASSERT(slice == "\U0001F600a");
+    ASSERT(text.slice_codepoints(2, 3) == "\u5927\U0001F600\u00e4");
+
+    text.pop_front();
+    ASSERT(text.size_codepoints() == 999);
+    ASSERT(text.codepoint_offset(1) == offsets[2] - 1);
+
+    pystd2026::U8String ascii("abcdef");
+    ASSERT(ascii.codepoint_offset(4) == 4);
+    ASSERT(ascii.slice_codepoints(1, 2) == "bc");
+    pystd2026::U8String sword(daikatana);
+    ASSERT(sword.size_codepoints() == 2);
+    ASSERT(sword.slice_codepoints(1) == "刀");
+    return 0;
+}
+
 int test_u8_strings() {
     TEST_START;
     int failing_subtests = 0;
@@ -368,12 +735,17 @@ int test_u8_strings() {
     failing_subtests += test_u8_reverse_iterator();
     failing_subtests += test_u8_reverse_iterator_cjk();
     failing_subtests += test_u8_split();
+    failing_subtests += test_u8_split_template();
+    failing_subtests += test_u8_split_view();
     failing_subtests += test_u8_append();
     failing_subtests += test_u8_join();
     failing_subtests += test_u8_splice();
     failing_subtests += test_u8_remove();
     failing_subtests += test_u8_pop();
     failing_subtests += test_u8_casing();
+    failing_subtests += test_u8_casing_long();
+    failing_subtests += test_u8_find();
+    failing_subtests += test_u8_codepoint_index();
     return failing_subtests;
 }
 
@@ -536,10 +908,34 @@ int test_vector_uptr() {
     return 0;
 }
 
+struct DefaultMarked {
+    int marker = 42;
+};
+
+int test_vector_append_with_default() {
+    TEST_START;
+    pystd2026::Vector<DefaultMarked> v;
+    // Leave other values in the memory that the new elements reuse.
+    for(int i = 0; i < 10; ++i) {
+        v.push_back(DefaultMarked{7});
+    }
+    for(int i = 0; i < 9; ++i) {
+        v.pop_back();
+    }
+    v.append_with_default(9);
+    ASSERT(v.size() == 10);
+    ASSERT(v[0].marker == 7);
+    for(size_t i = 1; i < v.size(); ++i) {
+        ASSERT(v[i].marker == 42);
+    }
+    return 0;
+}
+
 int test_vector() {
     printf("Testing Vector.\n");
     int failing_subtests = 0;
     failing_subtests += test_vector_simple();
+    failing_subtests += test_vector_append_with_default();
     return failing_subtests;
 }
 
@@ -560,6 +956,140 @@ int test_file_load() {
     auto contents = testfile.load_text();
     ASSERT(contents);
     ASSERT(*contents == "This is a test file.\n");
+    auto raw = testfile.load_bytes();
+    ASSERT(raw);
+    ASSERT(raw->size() == 21);
+    ASSERT(memcmp(raw->data(), "This is a test file.\n", 21) == 0);
+    ASSERT(!(testdir / "nonexisting.txt").load_bytes());
+    return 0;
+}
+
+int test_mmap_options() {
+    TEST_START;
+    pystd2026::Path testdir(PYSTD_TESTDIR);
+    auto testfile = testdir / "testfile.txt";
+    pystd2026::MMapOptions options;
+    options.populate = true;
+    options.access = pystd2026::MMapAccess::Sequential;
+    auto whole = pystd2026::mmap_file(testfile.c_str(), options);
+    ASSERT(whole);
+    ASSERT(pystd2026::CStringView(whole->span()) == "This is a test file.\n");
+
+    options.offset = 5;
+    options.length = 4;
+    options.will_need = true;
+    auto window = pystd2026::mmap_file(testfile.c_str(), options);
+    ASSERT(window);
+    ASSERT(pystd2026::CStringView(window->span()) == "is a");
+    window->advise(pystd2026::MMapAccess::Random);
+
+    options.length = 100;
+    ASSERT(!pystd2026::mmap_file(testfile.c_str(), options));
+    options.offset = 21;
+    options.length = 0;
+    ASSERT(!pystd2026::mmap_file(testfile.c_str(), options));
+
+    const int fd = open(testfile.c_str(), O_RDONLY);
+    ASSERT(fd >= 0);
+    options.offset = 10;
+    auto from_fd = pystd2026::mmap_file(fd);
+    auto tail = pystd2026::mmap_file(fd, options);
+    close(fd);
+    ASSERT(from_fd);
+    ASSERT(tail);
+    ASSERT(pystd2026::CStringView(tail->span()) == "test file.\n");
+    *from_fd = pystd2026::move(*tail);
+    ASSERT(pystd2026::CStringView(from_fd->span()) == "test file.\n");
+    return 0;
+}
+
+int test_writable_mappings() {
+    TEST_START;
+    const char *fname = "pystd2026_mapping_test.bin";
+    {
+        pystd2026::GrowableMapping out(fname, 1);
+        out.append(pystd2026::CStringView("header "));
+        // Goes past the first page several times.
+        for(int i = 0; i < 3000; ++i) {
+            memcpy(out.extend(4), "abcd", 4);
+        }
+        ASSERT(out.size() == 7 + 4 * 3000);
+        out.resize(out.size() - 4 * 2999);
+        out.append(pystd2026::CStringView(" trailer"));
+        out.flush();
+        out.close();
+        out.close();
+        ASSERT(out.span().is_empty());
+        bool closed_thrown = false;
+        try {
+            out.append(pystd2026::CStringView("after close"));
+        } catch(const pystd2026::PyException &) {
+            closed_thrown = true;
+        }
+        ASSERT(closed_thrown);
+    }
+    pystd2026::MMapOptions options;
+    options.writable = true;
+    auto mapped = pystd2026::mmap_file(fname, options);
+    ASSERT(mapped);
+    ASSERT(pystd2026::CStringView(mapped->span()) == "header abcd trailer");
+    mapped->writable_span()[0] = 'H';
+    mapped->flush();
+    auto readonly = pystd2026::mmap_file(fname);
+    ASSERT(readonly);
+    ASSERT(pystd2026::CStringView(readonly->span()) == "Header abcd trailer");
+    bool thrown = false;
+    try {
+        readonly->writable_span();
+    } catch(const pystd2026::PyException &) {
+        thrown = true;
+    }
+    ASSERT(thrown);
+    unlink(fname);
+    return 0;
+}
+
+int test_buffered_writer() {
+    TEST_START;
+    char long_text[200];
+    memset(long_text, 'x', sizeof(long_text));
+    int fds[2];
+    ASSERT(pipe(fds) == 0);
+    {
+        pystd2026::BufferedWriter out(fds[1], 128);
+        out.write("abc", 3);
+        out.write('\n');
+        ASSERT(out.buffered_size() == 4);
+        pystd2026::print(out, "{} {}", 42, pystd2026::CStringView("words"));
+        // Bigger than the buffer, goes out with a single writev.
+        const pystd2026::CStringView long_line(long_text, sizeof(long_text));
+        out.write(long_line);
+        ASSERT(out.buffered_size() == 0);
+        // The last piece is empty and must not add anything.
+        pystd2026::CStringView pieces[4] = {pystd2026::CStringView("one "),
+                                            long_line,
+                                            pystd2026::CStringView(" two"),
+                                            pystd2026::CStringView()};
+        out.write_pieces(pystd2026::Span<const pystd2026::CStringView>(pieces, 4));
+        ASSERT(out.buffered_size() == 4);
+        out.flush();
+        ASSERT(out.buffered_size() == 0);
+        out.write("end", 3);
+    }
+    close(fds[1]);
+    char result[1024];
+    ssize_t total = 0;
+    ssize_t rc;
+    while((rc = read(fds[0], result + total, sizeof(result) - total)) > 0) {
+        total += rc;
+    }
+    close(fds[0]);
+    pystd2026::CString expected("abc\n42 words\n");
+    expected += pystd2026::CString(long_text, sizeof(long_text));
+    expected += "one ";
+    expected += pystd2026::CString(long_text, sizeof(long_text));
+    expected += " twoend";
+    ASSERT(pystd2026::CStringView(result, total) == expected.view());
     return 0;
 }
 
@@ -567,6 +1097,9 @@ int test_files() {
     printf("Testing file access.\n");
     int failing_subtests = 0;
     failing_subtests += test_file_load();
+    failing_subtests += test_mmap_options();
+    failing_subtests += test_writable_mappings();
+    failing_subtests += test_buffered_writer();
     return failing_subtests;
 }
 
@@ -695,12 +1228,55 @@ int test_hashset() {
     return 0;
 }
 
+int test_case_insensitive() {
+    TEST_START;
+    using pystd2026::CStringView;
+    using pystd2026::U8String;
+    ASSERT(pystd2026::equals_ignoring_case(CStringView("Content-Length"),
+                                           CStringView("content-LENGTH")));
+    ASSERT(!pystd2026::equals_ignoring_case(CStringView("Content-Length"),
+                                            CStringView("Content-Lengt")));
+    ASSERT(!pystd2026::equals_ignoring_case(CStringView("[@"), CStringView("{`")));
+    ASSERT(pystd2026::compare_ignoring_case(CStringView("abc"), CStringView("ABD")) < 0);
+    ASSERT(pystd2026::compare_ignoring_case(CStringView("ABC"), CStringView("ab")) > 0);
+    ASSERT(pystd2026::compare_ignoring_case(CStringView("x-forwarded-for-proxy"),
+                                            CStringView("X-FORWARDED-FOR-PROXY")) == 0);
+
+    const U8String greek("ΟΔΥΣΣΕΥΣ went to the KITCHEN");
+    const U8String greek_lower("οδυσσευς went to the kitchen");
+    ASSERT(pystd2026::equals_ignoring_case(greek.view(), greek_lower.view()));
+    ASSERT(pystd2026::compare_ignoring_case(greek.view(), greek_lower.view()) == 0);
+    // Kelvin sign and k have different byte lengths.
+    ASSERT(pystd2026::equals_ignoring_case(U8String("\u212a-long-prefix").view(),
+                                           U8String("k-LONG-PREFIX").view()));
+    ASSERT(!pystd2026::equals_ignoring_case(U8String("ı").view(), U8String("I").view()));
+    ASSERT(!pystd2026::equals_ignoring_case(U8String("ß").view(), U8String("SS").view()));
+    ASSERT(pystd2026::compare_ignoring_case(U8String("äb").view(), U8String("Äc").view()) < 0);
+
+    pystd2026::HashMap<pystd2026::CaseInsensitive<pystd2026::CString>, int> headers;
+    headers[pystd2026::CString("Content-Type")] = 1;
+    headers[pystd2026::CString("HOST")] = 2;
+    ASSERT(headers.size() == 2);
+    ASSERT(*headers.lookup(pystd2026::CString("content-type")) == 1);
+    ASSERT(*headers.lookup(pystd2026::CString("host")) == 2);
+    headers[pystd2026::CString("CONTENT-TYPE")] = 3;
+    ASSERT(headers.size() == 2);
+    ASSERT(*headers.lookup(pystd2026::CString("Content-Type")) == 3);
+
+    pystd2026::HashMap<pystd2026::CaseInsensitive<pystd2026::U8StringView>, int> words;
+    words[greek.view()] = 1;
+    ASSERT(words.contains(greek_lower.view()));
+    ASSERT(!words.contains(U8String("οδυσσευς").view()));
+    return 0;
+}
+
 int test_hashing() {
     int total_errors = 0;
     total_errors += test_hash_computation();
     total_errors += test_custom_hash();
     total_errors += test_hashmap();
     total_errors += test_hashset();
+    total_errors += test_case_insensitive();
     return total_errors;
 }
 
@@ -817,11 +1393,82 @@ int test_format2() {
     return 0;
 }
 
+int test_format_integers() {
+    TEST_START;
+    ASSERT(pystd2026::format("{} {} {}", 0, -12, 34u) == "0 -12 34");
+    ASSERT(pystd2026::format("{}", (int64_t)-9223372036854775807 - 1) == "-9223372036854775808");
+    ASSERT(pystd2026::format("{}", (uint64_t)18446744073709551615u) == "18446744073709551615");
+    ASSERT(pystd2026::format("{:08x}", 0xbeef) == "0000beef");
+    ASSERT(pystd2026::format("{:#X}", 255) == "0XFF");
+    ASSERT(pystd2026::format("{:#010b}", 5) == "0b00000101");
+    ASSERT(pystd2026::format("{:o}", 8) == "10");
+    ASSERT(pystd2026::format("{:+05}", 42) == "+0042");
+    ASSERT(pystd2026::format("{:05}", -42) == "-0042");
+    ASSERT(pystd2026::format("{:<5}|{:^5}|{:*>5}", 1, 2, 3) == "1    |  2  |****3");
+    ASSERT(pystd2026::format("{} {:d}", 'a', 'a') == "a 97");
+    ASSERT(pystd2026::format("{}", true) == "True");
+    return 0;
+}
+
+int test_format_floats() {
+    TEST_START;
+    ASSERT(pystd2026::format("{}", 0.1) == "0.1");
+    ASSERT(pystd2026::format("{}", 1.0) == "1.0");
+    ASSERT(pystd2026::format("{}", -0.0) == "-0.0");
+    ASSERT(pystd2026::format("{}", 123456.5) == "123456.5");
+    ASSERT(pystd2026::format("{}", 1e15) == "1000000000000000.0");
+    ASSERT(pystd2026::format("{}", 1e16) == "1e+16");
+    ASSERT(pystd2026::format("{}", 0.0001) == "0.0001");
+    ASSERT(pystd2026::format("{}", 1.5e-5) == "1.5e-05");
+    ASSERT(pystd2026::format("{}", 5e-324) == "5e-324");
+    ASSERT(pystd2026::format("{}", 1.7976931348623157e308) == "1.7976931348623157e+308");
+    ASSERT(pystd2026::format("{}", 0.3f) == "0.30000001192092896");
+    ASSERT(pystd2026::format("{} {}", INFINITY, -INFINITY) == "inf -inf");
+    ASSERT(pystd2026::format("{:.3f}", 3.14159) == "3.142");
+    ASSERT(pystd2026::format("{:+.2e}", 1234.5) == "+1.23e+03");
+    ASSERT(pystd2026::format("{:.1%}", 0.25) == "25.0%");
+    ASSERT(pystd2026::format("{:08.2f}", -1.5) == "-0001.50");
+    return 0;
+}
+
+int test_format_strings() {
+    TEST_START;
+    pystd2026::CString cstr("bytes");
+    pystd2026::U8String u8str("大刀");
+    ASSERT(pystd2026::format("{}-{}-{}", "lit", cstr, u8str) == "lit-bytes-大刀");
+    ASSERT(pystd2026::format("[{:>7}]", cstr.view()) == "[  bytes]");
+    ASSERT(pystd2026::format("[{:^6}]", u8str.view()) == "[  大刀  ]");
+    ASSERT(pystd2026::format("{{{}}}", 1) == "{1}");
+    ASSERT(pystd2026::format("no fields") == "no fields");
+
+    pystd2026::U8String u8out("x=");
+    pystd2026::format_to(u8out, "{} {}", 5, u8str);
+    ASSERT(u8out == "x=5 大刀");
+    ASSERT(u8out.size_codepoints() == 6);
+    bool thrown = false;
+    try {
+        pystd2026::format_to(u8out, "{}", "\xff");
+    } catch(const pystd2026::PyException &) {
+        thrown = true;
+    }
+    ASSERT(thrown);
+    ASSERT(u8out == "x=5 大刀");
+
+    pystd2026::Bytes bytes;
+    pystd2026::format_to(bytes, "{}:{}", 1, 2);
+    ASSERT(bytes.size() == 3);
+    ASSERT(memcmp(bytes.data(), "1:2", 3) == 0);
+    return 0;
+}
+
 int test_format() {
     printf("Testing format.\n");
     int failing_subtests = 0;
     failing_subtests += test_format1();
     failing_subtests += test_format2();
+    failing_subtests += test_format_integers();
+    failing_subtests += test_format_floats();
+    failing_subtests += test_format_strings();
     return failing_subtests;
 }
 
@@ -1021,6 +1668,19 @@ int test_uppercasing() {
     ASSERT(rc.codepoints[1] == 0);
     ASSERT(rc.codepoints[2] == 0);
 
+    memset(&rc, 42, sizeof(rc));
+    rc = pystd2026::uppercase_unicode(1078); // ж
+    ASSERT(rc.codepoints[0] == 1046);        // Ж
+    ASSERT(rc.codepoints[1] == 0);
+    ASSERT(rc.codepoints[2] == 0);
+
+    // Past the end of the case mapping tables.
+    memset(&rc, 42, sizeof(rc));
+    rc = pystd2026::uppercase_unicode(0x10FFFF);
+    ASSERT(rc.codepoints[0] == 0x10FFFF);
+    ASSERT(rc.codepoints[1] == 0);
+    ASSERT(rc.codepoints[2] == 0);
+
     return 0;
 }
 
@@ -1058,11 +1718,38 @@ int test_lowercasing() {
     return 0;
 }
 
+int test_unicode_properties() {
+    TEST_START;
+    ASSERT(pystd2026::unicode_category('a') == pystd2026::UnicodeCategory::Ll);
+    ASSERT(pystd2026::unicode_category(926) == pystd2026::UnicodeCategory::Lu); // Ξ
+    ASSERT(pystd2026::unicode_category(0x5927) == pystd2026::UnicodeCategory::Lo); // 大
+    ASSERT(pystd2026::unicode_category('7') == pystd2026::UnicodeCategory::Nd);
+    ASSERT(pystd2026::unicode_category(0x10FFFF) == pystd2026::UnicodeCategory::Cn);
+    ASSERT(pystd2026::unicode_category(0x110000) == pystd2026::UnicodeCategory::Cn);
+
+    ASSERT(pystd2026::is_unicode_whitespace(' '));
+    ASSERT(pystd2026::is_unicode_whitespace(0x3000));
+    ASSERT(pystd2026::is_unicode_whitespace(0x85));
+    ASSERT(!pystd2026::is_unicode_whitespace('a'));
+    ASSERT(!pystd2026::is_unicode_whitespace(0x200B)); // Zero width space.
+
+    ASSERT(pystd2026::is_unicode_alpha('a'));
+    ASSERT(pystd2026::is_unicode_alpha(0x5927));
+    ASSERT(!pystd2026::is_unicode_alpha('7'));
+
+    ASSERT(pystd2026::is_unicode_numeric('7'));
+    ASSERT(pystd2026::is_unicode_numeric(0x4E00)); // 一
+    ASSERT(pystd2026::is_unicode_numeric(0xBD)); // ½
+    ASSERT(!pystd2026::is_unicode_numeric('a'));
+    return 0;
+}
+
 int test_unicode() {
     printf("Testing partition.\n");
     int failing_subtests = 0;
     failing_subtests += test_uppercasing();
     failing_subtests += test_lowercasing();
+    failing_subtests += test_unicode_properties();
     return failing_subtests;
 }
 
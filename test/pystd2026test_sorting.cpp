@@ -133,6 +133,22 @@ int test_introsort_int() {
     return failing_subtests;
 }
 
+int test_introsort_duplicates() {
+    TEST_START;
+    // Lots of equal elements can leave nothing to
+    // sort on the right side of the pivot.
+    const int NUM_ENTRIES = 1000;
+    pystd2026::Vector<SortStruct> items;
+    for(int i = 0; i < NUM_ENTRIES; ++i) {
+        items.push_back(SortStruct{(i * 7) % 3, i});
+    }
+    pystd2026::introsort(items.begin(), items.end());
+    for(int i = 1; i < NUM_ENTRIES; ++i) {
+        ASSERT(items[i - 1].x <= items[i].x);
+    }
+    return 0;
+}
+
 int test_radixsort() {
     TEST_START;
 
@@ -264,6 +280,7 @@ int test_sort_algorithms() {
     failing_subtests += test_mergesort_int();
     failing_subtests += test_mergesort();
     failing_subtests += test_introsort_int();
+    failing_subtests += test_introsort_duplicates();
     failing_subtests += test_radixsort();
     failing_subtests += test_bucketsort();
     failing_subtests += test_shellsort();
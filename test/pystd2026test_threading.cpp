@@ -3,6 +3,7 @@
 
 #include <pystd2026_threading.hpp>
 #include <pystd_testconfig.hpp>
+#include <sched.h>
 
 int breakpoint_opportunity(int number) { return number; }
 
@@ -62,11 +63,802 @@ int test_thread() {
     return 0;
 }
 
+int test_thread_pool() {
+    TEST_START;
+    int64_t counter = 0;
+    {
+        pystd2026::ThreadPool pool(4);
+        ASSERT(pool.num_workers() == 4);
+        for(int i = 0; i < 10000; ++i) {
+            pool.submit([&counter, i] { __atomic_add_fetch(&counter, i, __ATOMIC_RELAXED); });
+        }
+        pool.wait_idle();
+        ASSERT(counter == 49995000);
+        // The destructor must wait for tasks submitted after this.
+        for(int i = 0; i < 100; ++i) {
+            pool.submit([&counter] { __atomic_add_fetch(&counter, 1, __ATOMIC_RELAXED); });
+        }
+    }
+    ASSERT(counter == 49995100);
+    return 0;
+}
+
+int test_thread_pool_nested() {
+    TEST_START;
+    pystd2026::ThreadPool pool(3);
+    int64_t leaves = 0;
+    // More children than fit in one worker's deque.
+    pool.submit([&pool, &leaves] {
+        for(int i = 0; i < 3000; ++i) {
+            pool.submit([&pool, &leaves] {
+                for(int j = 0; j < 4; ++j) {
+                    pool.submit([&leaves] { __atomic_add_fetch(&leaves, 1, __ATOMIC_RELAXED); });
+                }
+            });
+        }
+    });
+    pool.wait_idle();
+    ASSERT(leaves == 12000);
+
+    // Callables too big or complex to store inline.
+    pystd2026::CString text("heap");
+    pystd2026::Mutex m;
+    pystd2026::CString result;
+    for(int i = 0; i < 10; ++i) {
+        pool.submit([text, &m, &result] {
+            pystd2026::LockGuard<pystd2026::Mutex> lg(m);
+            result += text;
+        });
+    }
+    pool.wait_idle();
+    ASSERT(result.size() == 40);
+    ASSERT(!pool.run_pending_task());
+    return 0;
+}
+
+int test_parallel_for() {
+    TEST_START;
+    pystd2026::ThreadPool pool(4);
+    pystd2026::Vector<int64_t> values;
+    for(int64_t i = 0; i < 100000; ++i) {
+        values.push_back(i);
+    }
+    pystd2026::Span<int64_t> span(values.data(), values.size());
+    pystd2026::parallel_for(pool, span, [](int64_t &v) { v *= 2; });
+    for(size_t i = 0; i < values.size(); ++i) {
+        ASSERT(values[i] == 2 * (int64_t)i);
+    }
+
+    int64_t sum = 0;
+    pystd2026::parallel_for(pool, pystd2026::Range(3, 100003, 7), [&sum](int64_t v) {
+        __atomic_add_fetch(&sum, v, __ATOMIC_RELAXED);
+    });
+    int64_t expected = 0;
+    for(int64_t v = 3; v < 100003; v += 7) {
+        expected += v;
+    }
+    ASSERT(sum == expected);
+
+    pystd2026::parallel_for(pool, pystd2026::Range(0), [](int64_t) { abort(); });
+    return 0;
+}
+
+int test_load_many() {
+    TEST_START;
+    pystd2026::Path testdir(PYSTD_TESTDIR);
+    pystd2026::Vector<pystd2026::Path> paths;
+    for(int i = 0; i < 100; ++i) {
+        paths.push_back(testdir / (i % 10 == 3 ? "nonexisting.txt" : "testfile.txt"));
+    }
+    pystd2026::ThreadPool pool(4);
+    pystd2026::Span<pystd2026::Path> path_span(paths.data(), paths.size());
+    auto contents = pystd2026::load_many(pool, path_span);
+    ASSERT(contents.size() == paths.size());
+    for(size_t i = 0; i < contents.size(); ++i) {
+        if(i % 10 == 3) {
+            ASSERT(!contents[i]);
+        } else {
+            ASSERT(contents[i]);
+            ASSERT(contents[i]->size() == 21);
+            ASSERT(memcmp(contents[i]->data(), "This is a test file.\n", 21) == 0);
+        }
+    }
+    auto single = pystd2026::load_many(pystd2026::Span<pystd2026::Path>(paths.data(), 1), 2);
+    ASSERT(single.size() == 1);
+    ASSERT(single[0]);
+    ASSERT(pystd2026::load_many(pool, pystd2026::Span<pystd2026::Path>()).is_empty());
+    return 0;
+}
+
+int test_parallel_reduce() {
+    TEST_START;
+    pystd2026::Vector<double> values;
+    for(int i = 0; i < 300001; ++i) {
+        values.push_back(1.0 / (i + 1));
+    }
+    pystd2026::Span<double> span(values.data(), values.size());
+    auto square = [](double v) { return v * v; };
+    auto add = [](double a, double b) { return a + b; };
+    double one_worker;
+    double many_workers;
+    {
+        pystd2026::ThreadPool pool(1);
+        one_worker = pystd2026::parallel_reduce(pool, span, 0.0, square, add);
+    }
+    {
+        pystd2026::ThreadPool pool(5);
+        many_workers = pystd2026::parallel_reduce(pool, span, 0.0, square, add);
+    }
+    // Bitwise equal, the order of additions must not change.
+    ASSERT(memcmp(&one_worker, &many_workers, sizeof(double)) == 0);
+    ASSERT(one_worker > 1.6449 && one_worker < 1.6450);
+
+    // Non-commutative combine must see chunks in order.
+    pystd2026::Vector<int> digits;
+    for(int i = 0; i < 5000; ++i) {
+        digits.push_back(i % 10);
+    }
+    pystd2026::Span<int> digit_span(digits.data(), digits.size());
+    auto as_string = [](int d) {
+        pystd2026::CString s;
+        s += (char)('0' + d);
+        return s;
+    };
+    auto concatenate = [](pystd2026::CString a, const pystd2026::CString &b) {
+        a += b;
+        return a;
+    };
+    const auto joined = pystd2026::parallel_reduce(
+        digit_span, pystd2026::CString(">"), as_string, concatenate);
+    ASSERT(joined.size() == 5001);
+    ASSERT(joined[0] == '>');
+    for(size_t i = 1; i < joined.size(); ++i) {
+        ASSERT(joined[i] == (char)('0' + (i - 1) % 10));
+    }
+    return 0;
+}
+
+int test_future() {
+    TEST_START;
+    pystd2026::ThreadPool pool(2);
+    auto answer = pystd2026::async(pool, [] { return 42; });
+    auto r = answer.get();
+    ASSERT(r.has_value());
+    ASSERT(r.value() == 42);
+    ASSERT(!answer.is_valid());
+
+    auto failing = pystd2026::async(pool, []() -> int {
+        throw pystd2026::PyException("Task failed.");
+    });
+    auto failed = failing.get();
+    ASSERT(failed.has_error());
+    ASSERT(failed.error().what() == "Task failed.");
+
+    auto chained = pystd2026::async(pool, [] { return 20; })
+                       .then(pool, [](int v) { return v + 1; })
+                       .then(pool, [](int v) {
+                           pystd2026::CString s;
+                           s += (char)('0' + v / 10);
+                           s += (char)('0' + v % 10);
+                           return s;
+                       });
+    auto chained_result = chained.get();
+    ASSERT(chained_result.has_value());
+    ASSERT(chained_result.value() == "21");
+
+    auto skipped = pystd2026::async(pool, []() -> int {
+        throw pystd2026::PyException("Early failure.");
+    }).then(pool, [](int) -> int { abort(); });
+    ASSERT(skipped.get().error().what() == "Early failure.");
+
+    pystd2026::Future<int> broken;
+    {
+        pystd2026::Promise<int> promise;
+        broken = promise.get_future();
+    }
+    ASSERT(broken.is_ready());
+    ASSERT(broken.get().has_error());
+
+    // A task that waits for another one on a single worker.
+    pystd2026::ThreadPool single(1);
+    auto outer = pystd2026::async(single, [&single] {
+        auto inner = pystd2026::async(single, [] { return 5; });
+        return inner.get(single).value() * 2;
+    });
+    ASSERT(outer.get().value() == 10);
+    return 0;
+}
+
+int test_when_all() {
+    TEST_START;
+    pystd2026::ThreadPool pool(3);
+    pystd2026::Vector<pystd2026::Future<int64_t>> futures;
+    for(int64_t i = 0; i < 50; ++i) {
+        futures.push_back(pystd2026::async(pool, [i] {
+            int64_t total = 0;
+            for(int64_t j = 0; j <= i * 1000; ++j) {
+                total += j;
+            }
+            return total;
+        }));
+    }
+    auto all = pystd2026::when_all(pystd2026::move(futures)).get();
+    ASSERT(all.has_value());
+    ASSERT(all.value().size() == 50);
+    for(int64_t i = 0; i < 50; ++i) {
+        ASSERT(all.value()[i] == (i * 1000) * (i * 1000 + 1) / 2);
+    }
+
+    pystd2026::Vector<pystd2026::Future<int>> mixed;
+    mixed.push_back(pystd2026::async(pool, [] { return 1; }));
+    mixed.push_back(pystd2026::async(pool, []() -> int {
+        throw pystd2026::PyException("Second.");
+    }));
+    mixed.push_back(pystd2026::async(pool, []() -> int {
+        throw pystd2026::PyException("Third.");
+    }));
+    auto mixed_result = pystd2026::when_all(pystd2026::move(mixed)).get();
+    ASSERT(mixed_result.has_error());
+    ASSERT(mixed_result.error().what() == "Second.");
+
+    auto empty = pystd2026::when_all(pystd2026::Vector<pystd2026::Future<int>>{});
+    ASSERT(empty.is_ready());
+    ASSERT(empty.get().value().is_empty());
+    return 0;
+}
+
+int test_condition_variable() {
+    TEST_START;
+    struct Queue {
+        pystd2026::Mutex m;
+        pystd2026::ConditionVariable cv;
+        pystd2026::Vector<int> items;
+        bool done = false;
+        int64_t consumed_sum = 0;
+    } q;
+    auto consumer = [](void *ctx) -> void * {
+        auto *q = static_cast<Queue *>(ctx);
+        pystd2026::LockGuard<pystd2026::Mutex> lg(q->m);
+        while(true) {
+            q->cv.wait(lg, [q] { return !q->items.is_empty() || q->done; });
+            if(q->items.is_empty()) {
+                return nullptr;
+            }
+            q->consumed_sum += q->items.back();
+            q->items.pop_back();
+        }
+    };
+    {
+        pystd2026::Thread c1(consumer, &q);
+        pystd2026::Thread c2(consumer, &q);
+        for(int i = 1; i <= 2000; ++i) {
+            pystd2026::LockGuard<pystd2026::Mutex> lg(q.m);
+            q.items.push_back(i);
+            q.cv.notify_one();
+        }
+        pystd2026::LockGuard<pystd2026::Mutex> lg(q.m);
+        q.done = true;
+        q.cv.notify_all();
+    }
+    ASSERT(q.consumed_sum == 2001000);
+    return 0;
+}
+
+int test_semaphore() {
+    TEST_START;
+    pystd2026::Semaphore sem(2);
+    ASSERT(sem.try_acquire());
+    ASSERT(sem.try_acquire());
+    ASSERT(!sem.try_acquire());
+    sem.release();
+    ASSERT(sem.try_acquire());
+
+    struct Context {
+        pystd2026::Semaphore items{0};
+        int64_t received = 0;
+    } ctx;
+    auto receiver = [](void *p) -> void * {
+        auto *c = static_cast<Context *>(p);
+        for(int i = 0; i < 1000; ++i) {
+            c->items.acquire();
+            __atomic_add_fetch(&c->received, 1, __ATOMIC_RELAXED);
+        }
+        return nullptr;
+    };
+    {
+        pystd2026::Thread r1(receiver, &ctx);
+        pystd2026::Thread r2(receiver, &ctx);
+        for(int i = 0; i < 1000; ++i) {
+            ctx.items.release(2);
+        }
+    }
+    ASSERT(ctx.received == 2000);
+    ASSERT(!ctx.items.try_acquire());
+    return 0;
+}
+
+int test_latch_and_barrier() {
+    TEST_START;
+    pystd2026::Latch latch(3);
+    ASSERT(!latch.try_wait());
+    latch.count_down(2);
+    ASSERT(!latch.try_wait());
+    latch.arrive_and_wait();
+    ASSERT(latch.try_wait());
+
+    const int NUM_THREADS = 4;
+    const int NUM_ROUNDS = 200;
+    struct Context {
+        pystd2026::Barrier barrier{NUM_THREADS};
+        pystd2026::Latch started{NUM_THREADS};
+        int64_t arrivals[NUM_ROUNDS] = {};
+        int mismatches = 0;
+    } ctx;
+    auto worker = [](void *p) -> void * {
+        auto *c = static_cast<Context *>(p);
+        c->started.arrive_and_wait();
+        for(int round = 0; round < NUM_ROUNDS; ++round) {
+            __atomic_add_fetch(&c->arrivals[round], 1, __ATOMIC_RELAXED);
+            c->barrier.arrive_and_wait();
+            // Everyone must have arrived for this round.
+            if(__atomic_load_n(&c->arrivals[round], __ATOMIC_RELAXED) != NUM_THREADS) {
+                __atomic_add_fetch(&c->mismatches, 1, __ATOMIC_RELAXED);
+            }
+        }
+        return nullptr;
+    };
+    {
+        pystd2026::Thread t1(worker, &ctx);
+        pystd2026::Thread t2(worker, &ctx);
+        pystd2026::Thread t3(worker, &ctx);
+        pystd2026::Thread t4(worker, &ctx);
+    }
+    ASSERT(ctx.mismatches == 0);
+    return 0;
+}
+
+int test_thread_callable() {
+    TEST_START;
+    int64_t total = 0;
+    {
+        pystd2026::Thread t1([&total] { __atomic_add_fetch(&total, 1, __ATOMIC_RELAXED); });
+        pystd2026::Thread t2([&total] { __atomic_add_fetch(&total, 2, __ATOMIC_RELAXED); });
+    }
+    ASSERT(total == 3);
+
+    // A capture that owns memory is freed by the thread.
+    pystd2026::CString message("from the thread");
+    bool matched = false;
+    {
+        pystd2026::Thread t([message = pystd2026::move(message), &matched] {
+            matched = message == "from the thread";
+        });
+    }
+    ASSERT(matched);
+    return 0;
+}
+
+int test_thread_options() {
+    TEST_START;
+    pystd2026::ThreadOptions options;
+    options.name = pystd2026::CString("pystd-worker");
+    options.stack_size = 1024 * 1024;
+    options.cpu_affinity.push_back(0);
+    struct Result {
+        char name[16] = {};
+        int cpu = -1;
+        size_t stack_size = 0;
+    } result;
+    {
+        pystd2026::Thread t(
+            [&result] {
+                pthread_attr_t attr;
+                pthread_getattr_np(pthread_self(), &attr);
+                pthread_attr_getstacksize(&attr, &result.stack_size);
+                pthread_attr_destroy(&attr);
+                result.cpu = sched_getcpu();
+                // The name is set after the thread starts, so poll for it.
+                while(strcmp(result.name, "pystd-worker") != 0) {
+                    pthread_getname_np(pthread_self(), result.name, sizeof(result.name));
+                    sched_yield();
+                }
+            },
+            options);
+    }
+    ASSERT(strcmp(result.name, "pystd-worker") == 0);
+    ASSERT(result.cpu == 0);
+    ASSERT(result.stack_size >= 1024 * 1024);
+
+    pystd2026::ThreadOptions bad_name;
+    bad_name.name = pystd2026::CString("a name that is far too long");
+    bool threw = false;
+    try {
+        pystd2026::Thread t([] {}, bad_name);
+    } catch(const pystd2026::PyException &) {
+        threw = true;
+    }
+    ASSERT(threw);
+
+    try {
+        auto cpus = pystd2026::numa_node_cpus(0);
+        ASSERT(!cpus.is_empty());
+    } catch(const pystd2026::PyException &) {
+        // No NUMA information in sysfs.
+    }
+    return 0;
+}
+
+int test_atomic() {
+    TEST_START;
+    pystd2026::Atomic<int64_t> counter(5);
+    ASSERT(counter.load() == 5);
+    ASSERT(counter.fetch_add(3, pystd2026::MemoryOrder::Relaxed) == 5);
+    ASSERT(counter.fetch_sub(1) == 8);
+    ASSERT(counter.exchange(100) == 7);
+    int64_t expected = 99;
+    ASSERT(!counter.compare_exchange_strong(expected, 0));
+    ASSERT(expected == 100);
+    ASSERT(counter.compare_exchange_strong(expected, 0));
+    ASSERT(counter.load(pystd2026::MemoryOrder::Acquire) == 0);
+
+    pystd2026::Atomic<uint32_t> bits;
+    bits.fetch_or(0b1010);
+    ASSERT(bits.fetch_and(0b0011) == 0b1010);
+    ASSERT(bits.fetch_xor(0b0001) == 0b0010);
+    ASSERT(bits.load() == 0b0011);
+
+    int target = 0;
+    pystd2026::Atomic<int *> ptr;
+    ASSERT(ptr.load() == nullptr);
+    ptr.store(&target, pystd2026::MemoryOrder::Release);
+    ASSERT(ptr.load() == &target);
+    return 0;
+}
+
+template<typename LockType> int check_lock_counts() {
+    const int NUM_ITERATIONS = 20000;
+    struct Context {
+        LockType lock;
+        int64_t counter = 0;
+    } ctx;
+    auto worker = [](void *p) -> void * {
+        auto *c = static_cast<Context *>(p);
+        for(int i = 0; i < NUM_ITERATIONS; ++i) {
+            pystd2026::LockGuard<LockType> lg(c->lock);
+            ++c->counter;
+        }
+        return nullptr;
+    };
+    {
+        pystd2026::Thread t1(worker, &ctx);
+        pystd2026::Thread t2(worker, &ctx);
+        pystd2026::Thread t3(worker, &ctx);
+    }
+    ASSERT(ctx.counter == 3 * NUM_ITERATIONS);
+    ASSERT(ctx.lock.try_lock());
+    ASSERT(!ctx.lock.try_lock());
+    ctx.lock.unlock();
+    return 0;
+}
+
+int test_spinlock() {
+    TEST_START;
+    return check_lock_counts<pystd2026::SpinLock>();
+}
+
+int test_fast_mutex() {
+    TEST_START;
+    return check_lock_counts<pystd2026::FastMutex>();
+}
+
+template<typename LockType> int check_readers_and_writers() {
+    const int NUM_ITERATIONS = 5000;
+    // Writers keep the two values equal, readers must never see them differ.
+    struct Context {
+        LockType lock;
+        int64_t a = 0;
+        int64_t b = 0;
+        int torn_reads = 0;
+    } ctx;
+    auto writer = [](void *p) -> void * {
+        auto *c = static_cast<Context *>(p);
+        for(int i = 0; i < NUM_ITERATIONS; ++i) {
+            pystd2026::LockGuard<LockType> lg(c->lock);
+            ++c->a;
+            ++c->b;
+        }
+        return nullptr;
+    };
+    auto reader = [](void *p) -> void * {
+        auto *c = static_cast<Context *>(p);
+        for(int i = 0; i < 4 * NUM_ITERATIONS; ++i) {
+            pystd2026::SharedLockGuard<LockType> lg(c->lock);
+            if(c->a != c->b) {
+                __atomic_add_fetch(&c->torn_reads, 1, __ATOMIC_RELAXED);
+            }
+        }
+        return nullptr;
+    };
+    {
+        pystd2026::Thread w1(writer, &ctx);
+        pystd2026::Thread w2(writer, &ctx);
+        pystd2026::Thread r1(reader, &ctx);
+        pystd2026::Thread r2(reader, &ctx);
+        pystd2026::Thread r3(reader, &ctx);
+    }
+    ASSERT(ctx.torn_reads == 0);
+    ASSERT(ctx.a == 2 * NUM_ITERATIONS);
+    return 0;
+}
+
+int test_shared_mutex() {
+    TEST_START;
+    pystd2026::SharedMutex m;
+    ASSERT(m.try_lock_shared());
+    ASSERT(m.try_lock_shared());
+    ASSERT(!m.try_lock());
+    m.unlock_shared();
+    m.unlock_shared();
+    ASSERT(m.try_lock());
+    ASSERT(!m.try_lock_shared());
+    m.unlock();
+    return check_readers_and_writers<pystd2026::SharedMutex>();
+}
+
+int test_big_reader_lock() {
+    TEST_START;
+    return check_readers_and_writers<pystd2026::BigReaderLock>();
+}
+
+struct EpochNode {
+    uint32_t alive;
+    int64_t a;
+    int64_t b;
+};
+
+// Marks the node dead instead of freeing it, so that readers can
+// detect use after reclamation.
+void poison_epoch_node(void *p) {
+    __atomic_store_n(&static_cast<EpochNode *>(p)->alive, 0, __ATOMIC_SEQ_CST);
+}
+
+int test_epoch_domain() {
+    TEST_START;
+    const int NUM_NODES = 10000;
+    struct Context {
+        pystd2026::EpochDomain domain;
+        EpochNode nodes[NUM_NODES];
+        EpochNode *current;
+        uint32_t readers_started = 0;
+        uint32_t writer_done = 0;
+        int64_t bad_reads = 0;
+    } ctx;
+    for(int i = 0; i < NUM_NODES; ++i) {
+        ctx.nodes[i] = EpochNode{1, i, i};
+    }
+
+    ctx.current = &ctx.nodes[0];
+    ctx.domain.retire(&ctx.nodes[0], poison_epoch_node);
+    ASSERT(ctx.domain.num_retired() == 1);
+    {
+        pystd2026::EpochReadGuard outer(ctx.domain);
+        pystd2026::EpochReadGuard inner(ctx.domain);
+    }
+    ctx.domain.collect();
+    ASSERT(ctx.domain.num_retired() == 0);
+    ASSERT(ctx.nodes[0].alive == 0);
+
+    ctx.current = &ctx.nodes[1];
+    auto writer = [](void *p) -> void * {
+        auto *c = static_cast<Context *>(p);
+        while(__atomic_load_n(&c->readers_started, __ATOMIC_SEQ_CST) < 3) {
+            sched_yield();
+        }
+        for(int i = 2; i < NUM_NODES; ++i) {
+            auto *old = __atomic_exchange_n(&c->current, &c->nodes[i], __ATOMIC_SEQ_CST);
+            c->domain.retire(old, poison_epoch_node);
+        }
+        __atomic_store_n(&c->writer_done, 1, __ATOMIC_SEQ_CST);
+        return nullptr;
+    };
+    auto reader = [](void *p) -> void * {
+        auto *c = static_cast<Context *>(p);
+        __atomic_add_fetch(&c->readers_started, 1, __ATOMIC_SEQ_CST);
+        while(!__atomic_load_n(&c->writer_done, __ATOMIC_SEQ_CST)) {
+            pystd2026::EpochReadGuard guard(c->domain);
+            auto *node = __atomic_load_n(&c->current, __ATOMIC_ACQUIRE);
+            // Stay in the read section long enough for the writer to
+            // retire whole batches behind our back.
+            for(int i = 0; i < 10; ++i) {
+                if(__atomic_load_n(&node->alive, __ATOMIC_SEQ_CST) != 1 || node->a != node->b) {
+                    __atomic_add_fetch(&c->bad_reads, 1, __ATOMIC_RELAXED);
+                }
+                sched_yield();
+            }
+        }
+        return nullptr;
+    };
+    {
+        pystd2026::Thread w(writer, &ctx);
+        pystd2026::Thread r1(reader, &ctx);
+        pystd2026::Thread r2(reader, &ctx);
+        pystd2026::Thread r3(reader, &ctx);
+    }
+    ASSERT(ctx.bad_reads == 0);
+    ctx.domain.collect();
+    for(int i = 0; i < NUM_NODES - 1; ++i) {
+        ASSERT(ctx.nodes[i].alive == 0);
+    }
+    ASSERT(ctx.nodes[NUM_NODES - 1].alive == 1);
+    return 0;
+}
+
+int test_spsc_queue() {
+    TEST_START;
+    pystd2026::SpscQueue<pystd2026::CString> strings(3);
+    ASSERT(strings.capacity() == 4);
+    ASSERT(!strings.try_pop());
+    // Go around the ring a few times.
+    for(int round = 0; round < 3; ++round) {
+        ASSERT(strings.try_push(pystd2026::CString("a")));
+        ASSERT(strings.try_push(pystd2026::CString("b")));
+        auto first = strings.try_pop();
+        ASSERT(first);
+        ASSERT(*first == "a");
+        auto second = strings.try_pop();
+        ASSERT(second);
+        ASSERT(*second == "b");
+    }
+    ASSERT(strings.try_push(pystd2026::CString("a")));
+    ASSERT(strings.try_push(pystd2026::CString("b")));
+    ASSERT(strings.try_push(pystd2026::CString("c")));
+    pystd2026::CString batch[2]{pystd2026::CString("d"), pystd2026::CString("e")};
+    ASSERT(strings.try_push_batch(pystd2026::Span<pystd2026::CString>(batch, 2)) == 1);
+    pystd2026::CString out[5];
+    ASSERT(strings.try_pop_batch(pystd2026::Span<pystd2026::CString>(out, 5)) == 4);
+    ASSERT(out[0] == "a");
+    ASSERT(out[3] == "d");
+    // Leave something in the queue for the destructor.
+    ASSERT(strings.try_push(pystd2026::CString("left over")));
+
+    const int64_t NUM_ITEMS = 100000;
+    struct Context {
+        pystd2026::SpscQueue<int64_t> queue{64};
+    } ctx;
+    auto producer = [](void *p) -> void * {
+        auto *c = static_cast<Context *>(p);
+        int64_t next = 1;
+        int64_t batch[16];
+        while(next <= NUM_ITEMS) {
+            int64_t count = 0;
+            for(; count < 16 && next + count <= NUM_ITEMS; ++count) {
+                batch[count] = next + count;
+            }
+            auto pushed = c->queue.try_push_batch(pystd2026::Span<int64_t>(batch, count));
+            next += pushed;
+            if(pushed == 0) {
+                sched_yield();
+            }
+        }
+        return nullptr;
+    };
+    int64_t expected = 1;
+    bool in_order = true;
+    {
+        pystd2026::Thread t(producer, &ctx);
+        int64_t received[8];
+        while(expected <= NUM_ITEMS) {
+            auto count = ctx.queue.try_pop_batch(pystd2026::Span<int64_t>(received, 8));
+            if(count == 0) {
+                sched_yield();
+            }
+            for(size_t i = 0; i < count; ++i) {
+                in_order = in_order && received[i] == expected;
+                ++expected;
+            }
+        }
+    }
+    ASSERT(in_order);
+    ASSERT(!ctx.queue.try_pop());
+    return 0;
+}
+
+int test_mpmc_queue() {
+    TEST_START;
+    pystd2026::MpmcQueue<pystd2026::CString> strings(4);
+    ASSERT(!strings.try_pop());
+    ASSERT(strings.try_push(pystd2026::CString("a")));
+    pystd2026::CString batch[4]{pystd2026::CString("b"),
+                                pystd2026::CString("c"),
+                                pystd2026::CString("d"),
+                                pystd2026::CString("e")};
+    ASSERT(strings.try_push_batch(pystd2026::Span<pystd2026::CString>(batch, 4)) == 3);
+    ASSERT(!strings.try_push(pystd2026::CString("f")));
+    auto first = strings.try_pop();
+    ASSERT(first);
+    ASSERT(*first == "a");
+    pystd2026::CString out[2];
+    ASSERT(strings.try_pop_batch(pystd2026::Span<pystd2026::CString>(out, 2)) == 2);
+    ASSERT(out[0] == "b");
+    ASSERT(out[1] == "c");
+
+    const int64_t ITEMS_PER_PRODUCER = 50000;
+    struct Context {
+        pystd2026::MpmcQueue<int64_t> queue{128};
+        int64_t popped = 0;
+        int64_t sum = 0;
+    } ctx;
+    auto producer = [](void *p) -> void * {
+        auto *c = static_cast<Context *>(p);
+        for(int64_t i = 1; i <= ITEMS_PER_PRODUCER;) {
+            const int64_t previous = i;
+            if(i % 2 == 0) {
+                int64_t pair[2] = {i, i + 1};
+                const size_t count = i < ITEMS_PER_PRODUCER ? 2 : 1;
+                auto pushed = c->queue.try_push_batch(pystd2026::Span<int64_t>(pair, count));
+                i += pushed;
+            } else if(c->queue.try_push(i)) {
+                ++i;
+            }
+            if(i == previous) {
+                sched_yield();
+            }
+        }
+        return nullptr;
+    };
+    auto consumer = [](void *p) -> void * {
+        auto *c = static_cast<Context *>(p);
+        int64_t local_sum = 0;
+        int64_t buffer[4];
+        while(__atomic_load_n(&c->popped, __ATOMIC_RELAXED) < 2 * ITEMS_PER_PRODUCER) {
+            auto count = c->queue.try_pop_batch(pystd2026::Span<int64_t>(buffer, 4));
+            if(count == 0) {
+                sched_yield();
+            }
+            for(size_t i = 0; i < count; ++i) {
+                local_sum += buffer[i];
+            }
+            __atomic_add_fetch(&c->popped, count, __ATOMIC_RELAXED);
+        }
+        __atomic_add_fetch(&c->sum, local_sum, __ATOMIC_RELAXED);
+        return nullptr;
+    };
+    {
+        pystd2026::Thread p1(producer, &ctx);
+        pystd2026::Thread p2(producer, &ctx);
+        pystd2026::Thread c1(consumer, &ctx);
+        pystd2026::Thread c2(consumer, &ctx);
+    }
+    ASSERT(ctx.sum == 2 * (ITEMS_PER_PRODUCER * (ITEMS_PER_PRODUCER + 1) / 2));
+    ASSERT(!ctx.queue.try_pop());
+    return 0;
+}
+
 int test_threading() {
     printf("Testing threading.\n");
     int failing_subtests = 0;
     failing_subtests += test_mutex();
     failing_subtests += test_thread();
+    failing_subtests += test_thread_callable();
+    failing_subtests += test_thread_options();
+    failing_subtests += test_atomic();
+    failing_subtests += test_spinlock();
+    failing_subtests += test_fast_mutex();
+    failing_subtests += test_shared_mutex();
+    failing_subtests += test_big_reader_lock();
+    failing_subtests += test_epoch_domain();
+    failing_subtests += test_spsc_queue();
+    failing_subtests += test_mpmc_queue();
+    failing_subtests += test_condition_variable();
+    failing_subtests += test_semaphore();
+    failing_subtests += test_latch_and_barrier();
+    failing_subtests += test_thread_pool();
+    failing_subtests += test_thread_pool_nested();
+    failing_subtests += test_parallel_for();
+    failing_subtests += test_parallel_reduce();
+    failing_subtests += test_load_many();
+    failing_subtests += test_future();
+    failing_subtests += test_when_all();
     return failing_subtests;
 }
 
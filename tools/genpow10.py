@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+
+# Generates the power of ten tables used for converting floating point
+# numbers to and from decimal in src/pystd2026_tables.cpp. Both hold
+# 128 bit values with the top bit set, split in a high and a low half.
+#
+# pow10_significands is used for formatting. For every k in
+# [POW10_MIN_EXPONENT, POW10_MAX_EXPONENT] it stores ceil(10^k / 2^e)
+# where e = floor(log2(10^k)) - 127.
+#
+# pow5_significands is used for parsing with the Eisel-Lemire algorithm
+# and follows the layout of the fast_float library. For q >= 0 it stores
+# 5^q truncated to 128 bits. For q < 0 it stores an approximation of
+# 2^b / 5^-q that is never too small before truncation.
+
+from fractions import Fraction
+
+POW10_MIN_EXPONENT = -292
+POW10_MAX_EXPONENT = 326
+
+POW5_MIN_EXPONENT = -342
+POW5_MAX_EXPONENT = 308
+
+def floor_log2(value):
+    e = value.numerator.bit_length() - value.denominator.bit_length()
+    if Fraction(2) ** e > value:
+        e -= 1
+    return e
+
+pow10 = []
+for k in range(POW10_MIN_EXPONENT, POW10_MAX_EXPONENT + 1):
+    value = Fraction(10) ** k
+    e = floor_log2(value) - 127
+    scaled = value / Fraction(2) ** e
+    pow10.append(-(-scaled.numerator // scaled.denominator))
+
+pow5 = []
+for q in range(POW5_MIN_EXPONENT, 0):
+    power5 = 5 ** -q
+    z = power5.bit_length()
+    if q >= -27:
+        c = 2 ** (z + 127) // power5 + 1
+    else:
+        c = 2 ** (2 * z + 2 * 64) // power5 + 1
+        while c >= 2 ** 128:
+            c //= 2
+    pow5.append(c)
+for q in range(0, POW5_MAX_EXPONENT + 1):
+    power5 = 5 ** q
+    while power5 < 2 ** 127:
+        power5 *= 2
+    while power5 >= 2 ** 128:
+        power5 //= 2
+    pow5.append(power5)
+
+for g in pow10 + pow5:
+    assert(2 ** 127 <= g < 2 ** 128)
+
+def print_array(name, size_define, values):
+    print(f'const Pow10Entry {name}[{size_define}] = {{')
+    for g in values:
+        print(f'    {{0x{g >> 64:016x}, 0x{g & (2 ** 64 - 1):016x}}},')
+    print('};')
+
+print('// Header')
+print('#define POW10_MIN_EXPONENT', POW10_MIN_EXPONENT)
+print('#define POW10_MAX_EXPONENT', POW10_MAX_EXPONENT)
+print('#define POW10_ENTRIES', len(pow10))
+print('#define POW5_MIN_EXPONENT', POW5_MIN_EXPONENT)
+print('#define POW5_MAX_EXPONENT', POW5_MAX_EXPONENT)
+print('#define POW5_ENTRIES', len(pow5))
+print()
+
+print('// Source')
+print('// clang-format off')
+print_array('pow10_significands', 'POW10_ENTRIES', pow10)
+print()
+print_array('pow5_significands', 'POW5_ENTRIES', pow5)
+print('// clang-format on')
@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+
+# Generates the Unicode property tables in src/pystd2026_tables.cpp.
+#
+# Every codepoint has a one byte property value:
+#
+# - bits 0-4 hold the general category as a UnicodeCategory index
+# - bit 5 is set if the codepoint has the White_Space property
+# - bit 6 is set if the codepoint is numeric, as in Python's str.isnumeric()
+#
+# The values are stored in a three level trie. Stage1 is indexed with
+# codepoint >> 9 and gives a block in stage2. Stage2 is indexed with bits
+# 4-8 of the codepoint and gives a block in stage3, which is indexed with
+# the low four bits and holds the actual property values.
+
+import sys, unicodedata
+
+# Must be in the same order as UnicodeCategory in pystd2026.hpp.
+categories = ['Lu', 'Ll', 'Lt', 'Lm', 'Lo',
+              'Mn', 'Mc', 'Me',
+              'Nd', 'Nl', 'No',
+              'Pc', 'Pd', 'Ps', 'Pe', 'Pi', 'Pf', 'Po',
+              'Sm', 'Sc', 'Sk', 'So',
+              'Zs', 'Zl', 'Zp',
+              'Cc', 'Cf', 'Cs', 'Co', 'Cn']
+
+# Python has no accessor for White_Space, so this is copied from PropList.txt.
+whitespace = set(list(range(0x9, 0xE)) +
+                 [0x20, 0x85, 0xA0, 0x1680] +
+                 list(range(0x2000, 0x200B)) +
+                 [0x2028, 0x2029, 0x202F, 0x205F, 0x3000])
+
+WHITESPACE_BIT = 1 << 5
+NUMERIC_BIT = 1 << 6
+
+STAGE2_SHIFT = 4
+STAGE1_SHIFT = 9
+
+def dedup(values, block_size):
+    indexes = []
+    blocks = {}
+    storage = []
+    for i in range(0, len(values), block_size):
+        block = tuple(values[i:i + block_size])
+        if block not in blocks:
+            blocks[block] = len(blocks)
+            storage += block
+        indexes.append(blocks[block])
+    return indexes, storage
+
+def print_array(ctype, name, size_define, values, per_line):
+    print(f'const {ctype} {name}[{size_define}] = {{')
+    for i in range(0, len(values), per_line):
+        print('    ' + ', '.join([str(v) for v in values[i:i+per_line]]) + ',')
+    print('};')
+
+properties = []
+for i in range(0x110000):
+    c = chr(i)
+    value = categories.index(unicodedata.category(c))
+    if i in whitespace:
+        value |= WHITESPACE_BIT
+    if c.isnumeric():
+        value |= NUMERIC_BIT
+    properties.append(value)
+
+stage2, stage3 = dedup(properties, 1 << STAGE2_SHIFT)
+stage1, stage2 = dedup(stage2, 1 << (STAGE1_SHIFT - STAGE2_SHIFT))
+
+assert(len(stage2) // (1 << (STAGE1_SHIFT - STAGE2_SHIFT)) < 256)
+assert(len(stage3) // (1 << STAGE2_SHIFT) < 65536)
+
+print('// Header')
+print('#define UNICODE_PROPERTY_STAGE1_ENTRIES', len(stage1))
+print('#define UNICODE_PROPERTY_STAGE2_ENTRIES', len(stage2))
+print('#define UNICODE_PROPERTY_STAGE3_ENTRIES', len(stage3))
+print()
+
+print('// Source')
+print('// clang-format off')
+print_array('uint8_t', 'unicode_property_stage1', 'UNICODE_PROPERTY_STAGE1_ENTRIES', stage1, 16)
+print()
+print_array('uint16_t', 'unicode_property_stage2', 'UNICODE_PROPERTY_STAGE2_ENTRIES', stage2, 16)
+print()
+print_array('uint8_t', 'unicode_property_stage3', 'UNICODE_PROPERTY_STAGE3_ENTRIES', stage3, 16)
+print('// clang-format on')
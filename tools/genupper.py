@@ -1,47 +1,87 @@
 #!/usr/bin/env python3
 
+# Generates the uppercasing tables in src/pystd2026_tables.cpp.
+#
+# Single codepoint mappings are stored in three stages:
+#
+# - stage1 is indexed with codepoint >> BLOCK_SHIFT and gives a block number
+# - stage2 holds deduplicated blocks of 1 << BLOCK_SHIFT entries, each
+#   entry being an index into the delta table
+# - the delta table holds the difference between the converted
+#   and the original codepoint
+#
+# Delta index 0 means that the codepoint converts to itself and
+# index 1 means it converts to multiple codepoints, which are looked
+# up from the (short) multichar table.
+
 import sys
 
-print('Multiple chars.')
+BLOCK_SHIFT = 6
+BLOCK_SIZE = 1 << BLOCK_SHIFT
+
+def print_array(ctype, name, size_define, values, per_line):
+    print(f'const {ctype} {name}[{size_define}] = {{')
+    for i in range(0, len(values), per_line):
+        print('    ' + ', '.join([str(v) for v in values[i:i+per_line]]) + ',')
+    print('};')
 
 multichars = []
+delta_indexes = {}
+deltas = [0, 0]
 
 for i in range(0x110000):
     string = chr(i)
     assert(len(string) == 1)
-    upstring = string.upper()
-    if len(upstring) != 1:
-        multichars.append((i, upstring))
+    converted = string.upper()
+    if len(converted) != 1:
+        multichars.append((i, converted))
+        delta_indexes[i] = 1
+    elif i >= 128 and converted != string:
+        delta = ord(converted) - i
+        if delta not in deltas:
+            deltas.append(delta)
+        delta_indexes[i] = deltas.index(delta)
 
-print('// clang-format off')
+num_codepoints = max(delta_indexes.keys()) + 1
+num_codepoints = (num_codepoints + BLOCK_SIZE - 1) // BLOCK_SIZE * BLOCK_SIZE
+
+stage1 = []
+stage2 = []
+block_numbers = {}
+for block_start in range(0, num_codepoints, BLOCK_SIZE):
+    block = tuple(delta_indexes.get(block_start + j, 0) for j in range(BLOCK_SIZE))
+    if block not in block_numbers:
+        block_numbers[block] = len(block_numbers)
+        stage2 += block
+    stage1.append(block_numbers[block])
+
+assert(len(block_numbers) < 256)
+assert(len(deltas) < 256)
+
+print('// Header')
+print('#define UPPERCASING_NUM_CODEPOINTS', num_codepoints)
+print('#define UPPERCASING_STAGE1_ENTRIES', len(stage1))
+print('#define UPPERCASING_STAGE2_ENTRIES', len(stage2))
+print('#define UPPERCASING_DELTA_ENTRIES', len(deltas))
 print('#define NUM_UPPERCASING_MULTICHAR_ENTRIES', len(multichars))
+print()
+
+print('// Source')
+print('// clang-format off')
 print('const UnicodeConversionMultiChar uppercasing_multi[NUM_UPPERCASING_MULTICHAR_ENTRIES] = {')
-for i, upstring in multichars:
+for i, converted in multichars:
     definition = f'    {{{i}, {{'
-    entry = [ord(c) for c in upstring]
+    entry = [ord(c) for c in converted]
     while len(entry) < 3:
         entry.append(0)
     definition += ', '.join(['%d' % c for c in entry])
     definition += '}},'
     print(definition)
 print('};')
+print()
+print_array('uint8_t', 'uppercasing_stage1', 'UPPERCASING_STAGE1_ENTRIES', stage1, 16)
+print()
+print_array('uint8_t', 'uppercasing_stage2', 'UPPERCASING_STAGE2_ENTRIES', stage2, 16)
+print()
+print_array('int32_t', 'uppercasing_deltas', 'UPPERCASING_DELTA_ENTRIES', deltas, 8)
 print('// clang-format on')
-
-print('\nDifferences')
-print('// clang-format off')
-diffs = []
-for i in range(128, 0x110000):
-    string = chr(i)
-    assert(len(string) == 1)
-    upstring = string.upper()
-    if len(upstring) == 1:
-        if upstring != string:
-            diffs.append((i, ord(upstring)))
-
-print('#define NUM_UPPERCASING_SINGLE_ENTRIES', len(diffs))
-print('const UnicodeConversionSingleChar uppercasing_single[NUM_UPPERCASING_SINGLE_ENTRIES] = {')
-for from_cp, to_cp in diffs:
-    print(f'    {{{from_cp}, {to_cp}}},')
-print('};')
-print('// clang-format on')
-
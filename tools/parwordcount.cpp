@@ -0,0 +1,240 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 Jussi Pakkanen
+
+// Parallel version of wordcount with identical output, apart from the
+// order of words that have the same count and length. The input is split
+// into chunks at whitespace, each chunk is counted into a map of its own,
+// the maps are merged pairwise and the results are sorted in slices that
+// are then merged pairwise.
+
+#include <stdio.h>
+#include <pystd2026_hashtable.hpp>
+#include <pystd2026_format.hpp>
+#include <pystd2026_introsort.hpp>
+#include <pystd2026_threading.hpp>
+
+struct WordCount {
+    pystd2026::U8StringView word;
+    size_t count = 0;
+
+    int operator<=>(const WordCount &o) const {
+        auto diff = (int64_t)o.count - (int64_t)count;
+        if(diff != 0) {
+            return diff;
+        }
+        return (int64_t)o.word.size_bytes() - (int64_t)word.size_bytes();
+    }
+
+    bool operator==(const WordCount &o) const { return (*this <=> o) == 0; }
+};
+
+typedef pystd2026::HashMap<pystd2026::U8StringView, size_t> CountMap;
+
+struct Chunk {
+    const char *begin;
+    const char *end;
+    CountMap counts;
+    bool failed = false;
+};
+
+namespace {
+
+bool is_word_separator(char c) { return pystd2026::IsAsciiWhitespace::ascii_bitmap.contains(c); }
+
+// Moves every split point forward to the next separator so that no word
+// is cut in two. Splitting at an ASCII character also keeps every chunk
+// valid UTF-8 if the whole file is.
+pystd2026::Vector<Chunk> split_into_chunks(pystd2026::Span<const char> bytes, size_t num_chunks) {
+    pystd2026::Vector<Chunk> chunks;
+    const char *const file_end = bytes.data() + bytes.size();
+    const char *begin = bytes.data();
+    for(size_t i = 1; i <= num_chunks && begin < file_end; ++i) {
+        const char *end = i == num_chunks ? file_end : bytes.data() + bytes.size() / num_chunks * i;
+        if(end < begin) {
+            end = begin;
+        }
+        while(end < file_end && !is_word_separator(*end)) {
+            ++end;
+        }
+        if(end > begin) {
+            chunks.push_back(Chunk{begin, end, CountMap(), false});
+        }
+        begin = end;
+    }
+    return chunks;
+}
+
+void count_chunk(Chunk &chunk) {
+    try {
+        auto text = pystd2026::U8StringView(chunk.begin, chunk.end - chunk.begin);
+        pystd2026::WhitespaceTokenizer tokenizer(text);
+        pystd2026::Vector<pystd2026::U8StringView> words;
+        const size_t batch_size = 1024;
+        words.reserve(batch_size);
+        while(tokenizer.next_batch(words, batch_size) > 0) {
+            for(const auto &word : words) {
+                ++chunk.counts[word];
+            }
+            words.clear();
+        }
+    } catch(const pystd2026::PyException &) {
+        chunk.failed = true;
+    }
+}
+
+// Merges the smaller map into the bigger one, which ends up in target.
+void merge_counts(CountMap &target, CountMap &source) {
+    if(target.size() < source.size()) {
+        CountMap tmp = pystd2026::move(target);
+        target = pystd2026::move(source);
+        source = pystd2026::move(tmp);
+    }
+    for(const auto &item : source) {
+        target[*item.key] += *item.value;
+    }
+    source = CountMap();
+}
+
+// Moves the elements of two sorted runs into one sorted output run.
+void merge_runs(WordCount *first,
+                WordCount *first_end,
+                WordCount *second,
+                WordCount *second_end,
+                WordCount *out) {
+    while(first < first_end && second < second_end) {
+        if(*second < *first) {
+            *out++ = pystd2026::move(*second++);
+        } else {
+            *out++ = pystd2026::move(*first++);
+        }
+    }
+    while(first < first_end) {
+        *out++ = pystd2026::move(*first++);
+    }
+    while(second < second_end) {
+        *out++ = pystd2026::move(*second++);
+    }
+}
+
+// Sorts slices in parallel and then merges neighbouring runs in
+// parallel until one run is left. Returns the buffer holding it.
+pystd2026::Vector<WordCount> *
+parallel_sort(pystd2026::ThreadPool &pool,
+              pystd2026::Vector<WordCount> &stats,
+              pystd2026::Vector<WordCount> &scratch,
+              size_t num_slices) {
+    pystd2026::Vector<size_t> run_starts;
+    for(size_t i = 0; i < num_slices; ++i) {
+        run_starts.push_back(stats.size() / num_slices * i);
+    }
+    run_starts.push_back(stats.size());
+    for(size_t i = 0; i + 1 < run_starts.size(); ++i) {
+        WordCount *begin = stats.data() + run_starts[i];
+        WordCount *end = stats.data() + run_starts[i + 1];
+        pool.submit([begin, end] { pystd2026::introsort(begin, end); });
+    }
+    pool.wait_idle();
+
+    scratch.append_with_default(stats.size());
+    auto *source = &stats;
+    auto *destination = &scratch;
+    while(run_starts.size() > 2) {
+        pystd2026::Vector<size_t> merged_starts;
+        for(size_t i = 0; i + 1 < run_starts.size(); i += 2) {
+            WordCount *src = source->data();
+            WordCount *dst = destination->data();
+            const size_t begin = run_starts[i];
+            const size_t mid = run_starts[i + 1];
+            const size_t end = i + 2 < run_starts.size() ? run_starts[i + 2] : mid;
+            pool.submit([src, dst, begin, mid, end] {
+                merge_runs(src + begin, src + mid, src + mid, src + end, dst + begin);
+            });
+            merged_starts.push_back(begin);
+        }
+        merged_starts.push_back(stats.size());
+        pool.wait_idle();
+        run_starts = pystd2026::move(merged_starts);
+        auto *tmp = source;
+        source = destination;
+        destination = tmp;
+    }
+    return source;
+}
+
+} // namespace
+
+int file_main(int argc, char **argv) {
+    if(argc != 2 && argc != 3) {
+        printf("%s <infile> [num_threads]\n", argv[0]);
+        return 0;
+    }
+    try {
+        size_t num_threads = 0;
+        if(argc == 3) {
+            auto parsed = pystd2026::parse_int<uint32_t>(argv[2]);
+            if(!parsed) {
+                printf("Invalid thread count.\n");
+                return 1;
+            }
+            num_threads = parsed.value();
+        }
+        pystd2026::ThreadPool pool(num_threads);
+        // Populating would fault in the whole file on this thread, let
+        // the kernel read ahead while the workers start instead.
+        pystd2026::MMapOptions options;
+        options.will_need = true;
+        pystd2026::Optional<pystd2026::MMapping> mmap_o = pystd2026::mmap_file(argv[1], options);
+        if(!mmap_o) {
+            printf("Could not open input file.\n");
+            return 1;
+        }
+        auto &mmap = *mmap_o;
+        // More chunks than workers evens out the load.
+        const size_t num_chunks = 4 * pool.num_workers();
+        auto chunks = split_into_chunks(mmap.span(), num_chunks);
+        for(auto &chunk : chunks) {
+            Chunk *c = &chunk;
+            pool.submit([c] { count_chunk(*c); });
+        }
+        pool.wait_idle();
+        for(const auto &chunk : chunks) {
+            if(chunk.failed) {
+                printf("Input file is not valid UTF-8.\n");
+                return 1;
+            }
+        }
+
+        for(size_t stride = 1; stride < chunks.size(); stride *= 2) {
+            for(size_t i = 0; i + stride < chunks.size(); i += 2 * stride) {
+                CountMap *target = &chunks[i].counts;
+                CountMap *source = &chunks[i + stride].counts;
+                pool.submit([target, source] { merge_counts(*target, *source); });
+            }
+            pool.wait_idle();
+        }
+
+        pystd2026::Vector<WordCount> stats;
+        pystd2026::Vector<WordCount> scratch;
+        pystd2026::Vector<WordCount> *sorted = &stats;
+        if(!chunks.is_empty()) {
+            auto &counts = chunks[0].counts;
+            stats.reserve(counts.size());
+            for(const auto &item : counts) {
+                stats.push_back(WordCount{*item.key, *item.value});
+            }
+            sorted = parallel_sort(pool, stats, scratch, num_chunks);
+        }
+        pystd2026::BufferedWriter out(fileno(stdout));
+        for(const auto &i : *sorted) {
+            pystd2026::print(out, "{} {}", i.count, i.word);
+        }
+        out.flush();
+    } catch(const pystd2026::PyException &e) {
+        printf("%s\n", e.what().c_str());
+        return 1;
+    }
+
+    return 0;
+}
+
+int main(int argc, char **argv) { return file_main(argc, argv); }
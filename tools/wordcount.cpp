@@ -3,6 +3,7 @@
 
 #include <stdio.h>
 #include <pystd2026_hashtable.hpp>
+#include <pystd2026_format.hpp>
 #include <pystd2026_introsort.hpp>
 #include <assert.h>
 
@@ -28,7 +29,11 @@ int file_main(int argc, char **argv) {
     }
     try {
         pystd2026::HashMap<pystd2026::U8StringView, size_t> counts;
-        pystd2026::Optional<pystd2026::MMapping> mmap_o = pystd2026::mmap_file(argv[1]);
+        // The file is read once from start to end.
+        pystd2026::MMapOptions options;
+        options.populate = true;
+        options.access = pystd2026::MMapAccess::Sequential;
+        pystd2026::Optional<pystd2026::MMapping> mmap_o = pystd2026::mmap_file(argv[1], options);
         if(!mmap_o) {
             printf("Could not open input file.\n");
             return 1;
@@ -37,8 +42,15 @@ int file_main(int argc, char **argv) {
         auto bytes = mmap.span();
         auto file_as_u8 = pystd2026::U8StringView(bytes.data(), bytes.size_bytes());
 
-        for(const auto &word : pystd2026::Loopsume(file_as_u8.split_ascii())) {
-            ++counts[word];
+        pystd2026::WhitespaceTokenizer tokenizer(file_as_u8);
+        pystd2026::Vector<pystd2026::U8StringView> words;
+        const size_t batch_size = 1024;
+        words.reserve(batch_size);
+        while(tokenizer.next_batch(words, batch_size) > 0) {
+            for(const auto &word : words) {
+                ++counts[word];
+            }
+            words.clear();
         }
         pystd2026::Vector<WordCount> stats;
         stats.reserve(counts.size());
@@ -46,9 +58,11 @@ int file_main(int argc, char **argv) {
             stats.push_back(WordCount{*item.key, *item.value});
         }
         pystd2026::introsort(stats.begin(), stats.end());
+        pystd2026::BufferedWriter out(fileno(stdout));
         for(const auto &i : stats) {
-            printf("%d %.*s\n", (int)i.count, (int)i.word.size_bytes(), i.word.data());
+            pystd2026::print(out, "{} {}", i.count, i.word);
         }
+        out.flush();
     } catch(const pystd2026::PyException &e) {
         printf("%s\n", e.what().c_str());
         return 1;
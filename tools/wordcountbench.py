@@ -0,0 +1,78 @@
+#!/usr/bin/env python3
+
+# SPDX-License-Identifier: Apache-2.0
+# Copyright 2026 Jussi Pakkanen
+
+# Measures the throughput of the word counters in MB/s. If no input
+# file is given, a synthetic one is generated. The stdlib counter is
+# only measured if it has been built with others/build.sh.
+
+import os, sys, subprocess, time, random, tempfile
+
+NUM_TRIES = 3
+GENERATED_SIZE = 64 * 1024 * 1024
+
+def generate_input(fname):
+    rng = random.Random(42)
+    letters = 'abcdefghijklmnopqrstuvwxyz'
+    vocabulary = []
+    for i in range(50000):
+        wordlen = rng.randint(1, 12)
+        vocabulary.append(''.join(rng.choice(letters) for _ in range(wordlen)))
+    # A skewed distribution like natural text, where a few words dominate.
+    weights = [1.0 / (i + 1) for i in range(len(vocabulary))]
+    lines = []
+    for i in range(10000):
+        lines.append(' '.join(rng.choices(vocabulary, weights, k=12)))
+    block = ('\n'.join(lines) + '\n').encode('utf-8')
+    with open(fname, 'wb') as f:
+        written = 0
+        while written < GENERATED_SIZE:
+            f.write(block)
+            written += len(block)
+
+def measure(cmd):
+    fastest_time = 1000000.0
+    output = None
+    for i in range(NUM_TRIES):
+        starttime = time.perf_counter()
+        pc = subprocess.run(cmd, stdout=subprocess.PIPE)
+        endtime = time.perf_counter()
+        if pc.returncode != 0:
+            sys.exit(f'Command failed: {" ".join(cmd)}')
+        fastest_time = min(fastest_time, endtime - starttime)
+        output = pc.stdout
+    return fastest_time, output
+
+def run_benchmarks(wordcount, parwordcount, infile):
+    source_root = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+    others = os.path.join(source_root, 'others')
+    counters = [('wordcount', [wordcount, infile]),
+                ('parwordcount', [parwordcount, infile]),
+                ('pycounter', [sys.executable, os.path.join(others, 'pycounter.py'), infile])]
+    stdlibcounter = os.path.join(others, 'stdlibcounter')
+    if os.path.exists(stdlibcounter):
+        counters.append(('stdlibcounter', [stdlibcounter, infile]))
+
+    megabytes = os.stat(infile).st_size / (1024 * 1024)
+    outputs = {}
+    print(f'Input size {megabytes:.1f} MB, fastest of {NUM_TRIES} runs.\n')
+    for name, cmd in counters:
+        runtime, output = measure(cmd)
+        outputs[name] = output
+        print(f'{name:15} {runtime:8.3f} s {megabytes / runtime:10.1f} MB/s')
+
+    # Words with the same count and length may come out in any order.
+    if sorted(outputs['wordcount'].split(b'\n')) != sorted(outputs['parwordcount'].split(b'\n')):
+        sys.exit('Parallel wordcount output differs from the serial one.')
+
+if __name__ == "__main__":
+    if len(sys.argv) not in (3, 4):
+        sys.exit(f'{sys.argv[0]} <wordcount> <parwordcount> [infile]')
+    if len(sys.argv) == 4:
+        run_benchmarks(sys.argv[1], sys.argv[2], sys.argv[3])
+    else:
+        with tempfile.TemporaryDirectory() as tmpdir:
+            infile = os.path.join(tmpdir, 'words.txt')
+            generate_input(infile)
+            run_benchmarks(sys.argv[1], sys.argv[2], infile)
@@ -28,9 +28,12 @@ int file_main(int argc, char **argv) {
         };
         file_view.split(adder, &words);
         pystd2026::introsort(words.begin(), words.end());
+        pystd2026::BufferedWriter out(fileno(stdout));
         for(const auto &w : words) {
-            printf("%s\n", w.c_str());
+            out.write(w.view());
+            out.write('\n');
         }
+        out.flush();
     } catch(const pystd2026::PyException &e) {
         printf("%s\n", e.what().c_str());
         return 1;